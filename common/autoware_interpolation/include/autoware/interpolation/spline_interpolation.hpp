@@ -36,28 +36,53 @@ std::vector<double> splineByAkima(
   const std::vector<double> & base_keys, const std::vector<double> & base_values,
   const std::vector<double> & query_keys);
 
+enum class SplineType { CUBIC, AKIMA };
+
 // non-static 1-dimensional spline interpolation
 //
 // Usage:
 // ```
-// SplineInterpolation spline;
 // // memorize pre-interpolation result internally
-// spline.calcSplineCoefficients(base_keys, base_values);
-// const auto interpolation_result1 = spline.getSplineInterpolatedValues(
-//   base_keys, query_keys1);
-// const auto interpolation_result2 = spline.getSplineInterpolatedValues(
-//   base_keys, query_keys2);
+// SplineInterpolation spline(base_keys, base_values);
+// const auto interpolation_result1 = spline.getSplineInterpolatedValues(query_keys1);
+// const auto interpolation_result2 = spline.getSplineInterpolatedValues(query_keys2);
+//
+// // several channels on the same base keys
+// const auto splines = SplineInterpolation::createSplines(base_keys, {base_xs, base_ys});
+// const auto query = splines.front().locateQueryKeys(query_keys);
+// const auto xs = splines.at(0).getSplineInterpolatedValues(query);
+// const auto ys = splines.at(1).getSplineInterpolatedValues(query);
 // ```
 class SplineInterpolation
 {
 public:
+  //!< @brief query keys located in the base keys
+  //!< @details It can be shared by the splines with the same base keys to evaluate them without
+  //            searching the base keys again.
+  struct Query
+  {
+    std::vector<Eigen::Index> indices;  // index of the base key interval of each query key
+    std::vector<double> offsets;        // query key - base key at the start of the interval
+  };
+
   SplineInterpolation() = default;
   SplineInterpolation(
-    const std::vector<double> & base_keys, const std::vector<double> & base_values)
+    const std::vector<double> & base_keys, const std::vector<double> & base_values,
+    const SplineType type = SplineType::CUBIC)
   {
-    calcSplineCoefficients(base_keys, base_values);
+    calcSplineCoefficients(base_keys, base_values, type);
   }
 
+  //!< @brief create the splines of several channels with the same base keys
+  //!< @details The tridiagonal matrix of the cubic spline only depends on the base keys, so it is
+  //            factorized once for all the channels.
+  static std::vector<SplineInterpolation> createSplines(
+    const std::vector<double> & base_keys, const std::vector<std::vector<double>> & base_values,
+    const SplineType type = SplineType::CUBIC);
+
+  //!< @brief locate sorted query keys in the base keys
+  Query locateQueryKeys(const std::vector<double> & query_keys) const;
+
   //!< @brief get values of spline interpolation on designated sampling points.
   //!< @details Assuming that query_keys are t vector for sampling, and interpolation is for x,
   //            meaning that spline interpolation was applied to x(t),
@@ -77,6 +102,11 @@ public:
   std::vector<double> getSplineInterpolatedQuadDiffValues(
     const std::vector<double> & query_keys) const;
 
+  //!< @brief same as above, but evaluated on the query located by a spline with the same base keys
+  std::vector<double> getSplineInterpolatedValues(const Query & query) const;
+  std::vector<double> getSplineInterpolatedDiffValues(const Query & query) const;
+  std::vector<double> getSplineInterpolatedQuadDiffValues(const Query & query) const;
+
   size_t getSize() const { return base_keys_.size(); }
 
 private:
@@ -88,9 +118,10 @@ private:
   std::vector<double> base_keys_;
 
   void calcSplineCoefficients(
-    const std::vector<double> & base_keys, const std::vector<double> & base_values);
+    const std::vector<double> & base_keys, const std::vector<double> & base_values,
+    const SplineType type);
 
-  Eigen::Index get_index(const double & key) const;
+  void validateQuery(const Query & query) const;
 };
 }  // namespace autoware::interpolation
 
@@ -15,37 +15,71 @@
 #include "autoware/interpolation/spline_interpolation.hpp"
 
 #include <cstdint>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace autoware::interpolation
 {
-Eigen::VectorXd solve_tridiagonal_matrix_algorithm(
+namespace
+{
+// forward sweep of the Thomas algorithm. It only depends on the matrix, so it is shared by the
+// systems with the same matrix and different right hand sides.
+struct TridiagonalFactorization
+{
+  Eigen::VectorXd a;
+  double b0{};
+  Eigen::VectorXd c_prime;
+  Eigen::VectorXd inv_pivot;
+};
+
+TridiagonalFactorization factorize_tridiagonal_matrix(
   const Eigen::Ref<const Eigen::VectorXd> & a, const Eigen::Ref<const Eigen::VectorXd> & b,
-  const Eigen::Ref<const Eigen::VectorXd> & c, const Eigen::Ref<const Eigen::VectorXd> & d)
+  const Eigen::Ref<const Eigen::VectorXd> & c)
+{
+  const auto n = b.size();
+
+  TridiagonalFactorization factorization;
+  factorization.a = a;
+  factorization.b0 = b(0);
+  factorization.c_prime = Eigen::VectorXd::Zero(n);
+  factorization.inv_pivot = Eigen::VectorXd::Zero(n);
+  if (n == 1) {
+    return factorization;
+  }
+
+  factorization.c_prime(0) = c(0) / b(0);
+  for (auto i = 1; i < n; i++) {
+    const double m = 1.0 / (b(i) - a(i - 1) * factorization.c_prime(i - 1));
+    factorization.inv_pivot(i) = m;
+    factorization.c_prime(i) = i < n - 1 ? c(i) * m : 0;
+  }
+  return factorization;
+}
+
+Eigen::VectorXd solve_factorized_tridiagonal_matrix(
+  const TridiagonalFactorization & factorization, const Eigen::Ref<const Eigen::VectorXd> & d)
 {
   const auto n = d.size();
 
   if (n == 1) {
-    return d.array() / b.array();
+    return d.array() / factorization.b0;
   }
 
-  Eigen::VectorXd c_prime = Eigen::VectorXd::Zero(n);
-  Eigen::VectorXd d_prime = Eigen::VectorXd::Zero(n);
-  Eigen::VectorXd x = Eigen::VectorXd::Zero(n);
+  const auto & a = factorization.a;
+  const auto & c_prime = factorization.c_prime;
+  const auto & inv_pivot = factorization.inv_pivot;
+  Eigen::VectorXd d_prime(n);
+  Eigen::VectorXd x(n);
 
   // Forward sweep
-  c_prime(0) = c(0) / b(0);
-  d_prime(0) = d(0) / b(0);
-
+  d_prime(0) = d(0) / factorization.b0;
   for (auto i = 1; i < n; i++) {
-    const double m = 1.0 / (b(i) - a(i - 1) * c_prime(i - 1));
-    c_prime(i) = i < n - 1 ? c(i) * m : 0;
-    d_prime(i) = (d(i) - a(i - 1) * d_prime(i - 1)) * m;
+    d_prime(i) = (d(i) - a(i - 1) * d_prime(i - 1)) * inv_pivot(i);
   }
 
   // Back substitution
   x(n - 1) = d_prime(n - 1);
-
   for (int64_t i = n - 2; i >= 0; i--) {
     x(i) = d_prime(i) - c_prime(i) * x(i + 1);
   }
@@ -53,193 +87,314 @@ Eigen::VectorXd solve_tridiagonal_matrix_algorithm(
   return x;
 }
 
-std::vector<double> spline(
-  const std::vector<double> & base_keys, const std::vector<double> & base_values,
-  const std::vector<double> & query_keys)
+struct SplineCoefficients
 {
-  // calculate spline coefficients
-  SplineInterpolation interpolator(base_keys, base_values);
+  Eigen::VectorXd a;
+  Eigen::VectorXd b;
+  Eigen::VectorXd c;
+  Eigen::VectorXd d;
+};
+
+// natural cubic spline. The part depending only on the base keys is computed in the constructor.
+class CubicSplineSolver
+{
+public:
+  explicit CubicSplineSolver(const std::vector<double> & base_keys)
+  : x_(Eigen::Map<const Eigen::VectorXd>(
+      base_keys.data(), static_cast<Eigen::Index>(base_keys.size())))
+  {
+    const auto n = x_.size();
+    h_ = x_.segment(1, n - 1) - x_.segment(0, n - 1);
+    if (n == 2) {
+      return;
+    }
 
-  // interpolate base_keys at query_keys
-  return interpolator.getSplineInterpolatedValues(query_keys);
-}
+    // Create Tridiagonal matrix
+    const Eigen::VectorXd a = h_.segment(1, n - 3);
+    const Eigen::VectorXd b = 2 * (h_.segment(0, n - 2) + h_.segment(1, n - 2));
+    const Eigen::VectorXd c = h_.segment(1, n - 3);
+    factorization_ = factorize_tridiagonal_matrix(a, b, c);
+  }
 
-std::vector<double> splineByAkima(
-  const std::vector<double> & base_keys, const std::vector<double> & base_values,
-  const std::vector<double> & query_keys)
+  SplineCoefficients solve(const std::vector<double> & base_values) const
+  {
+    const auto & x = x_;
+    const Eigen::VectorXd y = Eigen::Map<const Eigen::VectorXd>(
+      base_values.data(), static_cast<Eigen::Index>(base_values.size()));
+
+    const auto n = x.size();
+
+    SplineCoefficients coefficients;
+    if (n == 2) {
+      coefficients.a = Eigen::VectorXd::Zero(1);
+      coefficients.b = Eigen::VectorXd::Zero(1);
+      coefficients.c = Eigen::VectorXd::Zero(1);
+      coefficients.d = Eigen::VectorXd::Zero(1);
+      coefficients.c[0] = (y[1] - y[0]) / (x[1] - x[0]);
+      coefficients.d[0] = y[0];
+      return coefficients;
+    }
+
+    Eigen::VectorXd v(n);
+    const Eigen::VectorXd y_diff = y.segment(1, n - 1) - y.segment(0, n - 1);
+    const Eigen::VectorXd d = 6 * (y_diff.segment(1, n - 2).array() / h_.tail(n - 2).array() -
+                                   y_diff.segment(0, n - 2).array() / h_.head(n - 2).array());
+
+    // Solve tridiagonal matrix
+    v.segment(1, n - 2) = solve_factorized_tridiagonal_matrix(factorization_, d);
+    v[0] = 0;
+    v[n - 1] = 0;
+
+    // Calculate spline coefficients
+    coefficients.a =
+      (v.tail(n - 1) - v.head(n - 1)).array() / 6.0 / (x.tail(n - 1) - x.head(n - 1)).array();
+    coefficients.b = v.segment(0, n - 1) / 2.0;
+    coefficients.c =
+      (y.tail(n - 1) - y.head(n - 1)).array() / (x.tail(n - 1) - x.head(n - 1)).array() -
+      (x.tail(n - 1) - x.head(n - 1)).array() *
+        (2 * v.segment(0, n - 1).array() + v.segment(1, n - 1).array()) / 6.0;
+    coefficients.d = y.head(n - 1);
+    return coefficients;
+  }
+
+private:
+  Eigen::VectorXd x_;
+  Eigen::VectorXd h_;
+  TridiagonalFactorization factorization_;
+};
+
+SplineCoefficients calc_akima_spline_coefficients(
+  const std::vector<double> & base_keys, const std::vector<double> & base_values)
 {
   constexpr double epsilon = 1e-5;
 
+  const size_t n = base_keys.size();
+
   // calculate m
-  std::vector<double> m_values;
-  for (size_t i = 0; i < base_keys.size() - 1; ++i) {
-    const double m_val =
-      (base_values.at(i + 1) - base_values.at(i)) / (base_keys.at(i + 1) - base_keys.at(i));
-    m_values.push_back(m_val);
+  std::vector<double> m_values(n - 1);
+  for (size_t i = 0; i < n - 1; ++i) {
+    m_values[i] = (base_values[i + 1] - base_values[i]) / (base_keys[i + 1] - base_keys[i]);
   }
 
   // calculate s
-  std::vector<double> s_values;
-  for (size_t i = 0; i < base_keys.size(); ++i) {
-    if (i == 0) {
-      s_values.push_back(m_values.front());
-      continue;
-    } else if (i == base_keys.size() - 1) {
-      s_values.push_back(m_values.back());
-      continue;
-    } else if (i == 1 || i == base_keys.size() - 2) {
-      const double s_val = (m_values.at(i - 1) + m_values.at(i)) / 2.0;
-      s_values.push_back(s_val);
+  std::vector<double> s_values(n);
+  s_values.front() = m_values.front();
+  s_values.back() = m_values.back();
+  for (size_t i = 1; i < n - 1; ++i) {
+    if (i == 1 || i == n - 2) {
+      s_values[i] = (m_values[i - 1] + m_values[i]) / 2.0;
       continue;
     }
 
-    const double denom = std::abs(m_values.at(i + 1) - m_values.at(i)) +
-                         std::abs(m_values.at(i - 1) - m_values.at(i - 2));
+    const double denom =
+      std::abs(m_values[i + 1] - m_values[i]) + std::abs(m_values[i - 1] - m_values[i - 2]);
     if (std::abs(denom) < epsilon) {
-      const double s_val = (m_values.at(i - 1) + m_values.at(i)) / 2.0;
-      s_values.push_back(s_val);
+      s_values[i] = (m_values[i - 1] + m_values[i]) / 2.0;
       continue;
     }
 
-    const double s_val = (std::abs(m_values.at(i + 1) - m_values.at(i)) * m_values.at(i - 1) +
-                          std::abs(m_values.at(i - 1) - m_values.at(i - 2)) * m_values.at(i)) /
-                         denom;
-    s_values.push_back(s_val);
+    s_values[i] = (std::abs(m_values[i + 1] - m_values[i]) * m_values[i - 1] +
+                   std::abs(m_values[i - 1] - m_values[i - 2]) * m_values[i]) /
+                  denom;
   }
 
   // calculate cubic coefficients
-  std::vector<double> a;
-  std::vector<double> b;
-  std::vector<double> c;
-  std::vector<double> d;
-  for (size_t i = 0; i < base_keys.size() - 1; ++i) {
-    a.push_back(
-      (s_values.at(i) + s_values.at(i + 1) - 2.0 * m_values.at(i)) /
-      std::pow(base_keys.at(i + 1) - base_keys.at(i), 2));
-    b.push_back(
-      (3.0 * m_values.at(i) - 2.0 * s_values.at(i) - s_values.at(i + 1)) /
-      (base_keys.at(i + 1) - base_keys.at(i)));
-    c.push_back(s_values.at(i));
-    d.push_back(base_values.at(i));
-  }
-
-  // interpolate
-  std::vector<double> res;
-  size_t j = 0;
-  for (const auto & query_key : query_keys) {
-    while (base_keys.at(j + 1) < query_key) {
-      ++j;
-    }
-
-    const double ds = query_key - base_keys.at(j);
-    res.push_back(d.at(j) + (c.at(j) + (b.at(j) + a.at(j) * ds) * ds) * ds);
+  SplineCoefficients coefficients;
+  coefficients.a.resize(static_cast<Eigen::Index>(n - 1));
+  coefficients.b.resize(static_cast<Eigen::Index>(n - 1));
+  coefficients.c.resize(static_cast<Eigen::Index>(n - 1));
+  coefficients.d.resize(static_cast<Eigen::Index>(n - 1));
+  for (size_t i = 0; i < n - 1; ++i) {
+    const auto j = static_cast<Eigen::Index>(i);
+    const double h = base_keys[i + 1] - base_keys[i];
+    coefficients.a[j] = (s_values[i] + s_values[i + 1] - 2.0 * m_values[i]) / (h * h);
+    coefficients.b[j] = (3.0 * m_values[i] - 2.0 * s_values[i] - s_values[i + 1]) / h;
+    coefficients.c[j] = s_values[i];
+    coefficients.d[j] = base_values[i];
   }
-  return res;
+  return coefficients;
+}
+}  // namespace
+
+Eigen::VectorXd solve_tridiagonal_matrix_algorithm(
+  const Eigen::Ref<const Eigen::VectorXd> & a, const Eigen::Ref<const Eigen::VectorXd> & b,
+  const Eigen::Ref<const Eigen::VectorXd> & c, const Eigen::Ref<const Eigen::VectorXd> & d)
+{
+  return solve_factorized_tridiagonal_matrix(factorize_tridiagonal_matrix(a, b, c), d);
 }
 
-Eigen::Index SplineInterpolation::get_index(const double & key) const
+std::vector<double> spline(
+  const std::vector<double> & base_keys, const std::vector<double> & base_values,
+  const std::vector<double> & query_keys)
 {
-  const auto it = std::lower_bound(base_keys_.begin(), base_keys_.end(), key);
-  return std::clamp(
-    static_cast<int>(std::distance(base_keys_.begin(), it)) - 1, 0,
-    static_cast<int>(base_keys_.size()) - 2);
+  // calculate spline coefficients
+  SplineInterpolation interpolator(base_keys, base_values);
+
+  // interpolate base_keys at query_keys
+  return interpolator.getSplineInterpolatedValues(query_keys);
+}
+
+std::vector<double> splineByAkima(
+  const std::vector<double> & base_keys, const std::vector<double> & base_values,
+  const std::vector<double> & query_keys)
+{
+  // calculate spline coefficients
+  SplineInterpolation interpolator(base_keys, base_values, SplineType::AKIMA);
+
+  // interpolate base_keys at query_keys
+  return interpolator.getSplineInterpolatedValues(query_keys);
+}
+
+std::vector<SplineInterpolation> SplineInterpolation::createSplines(
+  const std::vector<double> & base_keys, const std::vector<std::vector<double>> & base_values,
+  const SplineType type)
+{
+  // throw exceptions for invalid arguments
+  for (const auto & values : base_values) {
+    autoware::interpolation::validateKeysAndValues(base_keys, values);
+  }
+
+  std::vector<SplineInterpolation> splines(base_values.size());
+  if (base_values.empty()) {
+    return splines;
+  }
+
+  const auto set_coefficients = [&](SplineInterpolation & spline, SplineCoefficients coefficients) {
+    spline.a_ = std::move(coefficients.a);
+    spline.b_ = std::move(coefficients.b);
+    spline.c_ = std::move(coefficients.c);
+    spline.d_ = std::move(coefficients.d);
+    spline.base_keys_ = base_keys;
+  };
+
+  if (type == SplineType::AKIMA) {
+    for (size_t i = 0; i < base_values.size(); ++i) {
+      set_coefficients(splines[i], calc_akima_spline_coefficients(base_keys, base_values[i]));
+    }
+    return splines;
+  }
+
+  const CubicSplineSolver solver(base_keys);
+  for (size_t i = 0; i < base_values.size(); ++i) {
+    set_coefficients(splines[i], solver.solve(base_values[i]));
+  }
+  return splines;
 }
 
 void SplineInterpolation::calcSplineCoefficients(
-  const std::vector<double> & base_keys, const std::vector<double> & base_values)
+  const std::vector<double> & base_keys, const std::vector<double> & base_values,
+  const SplineType type)
 {
   // throw exceptions for invalid arguments
   autoware::interpolation::validateKeysAndValues(base_keys, base_values);
-  const Eigen::VectorXd x = Eigen::Map<const Eigen::VectorXd>(
-    base_keys.data(), static_cast<Eigen::Index>(base_keys.size()));
-  const Eigen::VectorXd y = Eigen::Map<const Eigen::VectorXd>(
-    base_values.data(), static_cast<Eigen::Index>(base_values.size()));
-
-  const auto n = x.size();
-
-  if (n == 2) {
-    a_ = Eigen::VectorXd::Zero(1);
-    b_ = Eigen::VectorXd::Zero(1);
-    c_ = Eigen::VectorXd::Zero(1);
-    d_ = Eigen::VectorXd::Zero(1);
-    c_[0] = (y[1] - y[0]) / (x[1] - x[0]);
-    d_[0] = y[0];
-    base_keys_ = base_keys;
-    return;
-  }
-
-  // Create Tridiagonal matrix
-  Eigen::VectorXd v(n);
-  const Eigen::VectorXd h = x.segment(1, n - 1) - x.segment(0, n - 1);
-  const Eigen::VectorXd a = h.segment(1, n - 3);
-  const Eigen::VectorXd b = 2 * (h.segment(0, n - 2) + h.segment(1, n - 2));
-  const Eigen::VectorXd c = h.segment(1, n - 3);
-  const Eigen::VectorXd y_diff = y.segment(1, n - 1) - y.segment(0, n - 1);
-  const Eigen::VectorXd d = 6 * (y_diff.segment(1, n - 2).array() / h.tail(n - 2).array() -
-                                 y_diff.segment(0, n - 2).array() / h.head(n - 2).array());
-
-  // Solve tridiagonal matrix
-  v.segment(1, n - 2) = solve_tridiagonal_matrix_algorithm(a, b, c, d);
-  v[0] = 0;
-  v[n - 1] = 0;
-
-  // Calculate spline coefficients
-  a_ = (v.tail(n - 1) - v.head(n - 1)).array() / 6.0 / (x.tail(n - 1) - x.head(n - 1)).array();
-  b_ = v.segment(0, n - 1) / 2.0;
-  c_ = (y.tail(n - 1) - y.head(n - 1)).array() / (x.tail(n - 1) - x.head(n - 1)).array() -
-       (x.tail(n - 1) - x.head(n - 1)).array() *
-         (2 * v.segment(0, n - 1).array() + v.segment(1, n - 1).array()) / 6.0;
-  d_ = y.head(n - 1);
+
+  auto coefficients = type == SplineType::AKIMA
+                        ? calc_akima_spline_coefficients(base_keys, base_values)
+                        : CubicSplineSolver(base_keys).solve(base_values);
+  a_ = std::move(coefficients.a);
+  b_ = std::move(coefficients.b);
+  c_ = std::move(coefficients.c);
+  d_ = std::move(coefficients.d);
   base_keys_ = base_keys;
 }
 
-std::vector<double> SplineInterpolation::getSplineInterpolatedValues(
+SplineInterpolation::Query SplineInterpolation::locateQueryKeys(
   const std::vector<double> & query_keys) const
 {
   // throw exceptions for invalid arguments
   const auto validated_query_keys = autoware::interpolation::validateKeys(base_keys_, query_keys);
-  std::vector<double> interpolated_values;
-  interpolated_values.reserve(query_keys.size());
 
-  for (const auto & key : query_keys) {
-    const auto idx = get_index(key);
-    const auto dx = key - base_keys_[idx];
-    interpolated_values.emplace_back(
-      a_[idx] * dx * dx * dx + b_[idx] * dx * dx + c_[idx] * dx + d_[idx]);
+  Query query;
+  query.indices.resize(query_keys.size());
+  query.offsets.resize(query_keys.size());
+
+  // The query keys are sorted, so the interval is searched by a cursor moving forward. The index is
+  // the last base key smaller than the query key, clamped to the valid intervals.
+  const auto last_index = static_cast<Eigen::Index>(base_keys_.size()) - 2;
+  Eigen::Index idx = 0;
+  for (size_t i = 0; i < query_keys.size(); ++i) {
+    const double key = query_keys[i];
+    while (idx < last_index && base_keys_[idx + 1] < key) {
+      ++idx;
+    }
+    query.indices[i] = idx;
+    query.offsets[i] = key - base_keys_[idx];
   }
 
-  return interpolated_values;
+  return query;
+}
+
+void SplineInterpolation::validateQuery(const Query & query) const
+{
+  if (query.indices.size() != query.offsets.size()) {
+    throw std::invalid_argument("The size of indices and offsets of the query are not the same.");
+  }
+  for (const auto idx : query.indices) {
+    if (idx < 0 || a_.size() <= idx) {
+      throw std::invalid_argument("The query is not located in the base keys of the spline.");
+    }
+  }
+}
+
+std::vector<double> SplineInterpolation::getSplineInterpolatedValues(
+  const std::vector<double> & query_keys) const
+{
+  return getSplineInterpolatedValues(locateQueryKeys(query_keys));
 }
 
 std::vector<double> SplineInterpolation::getSplineInterpolatedDiffValues(
   const std::vector<double> & query_keys) const
 {
-  // throw exceptions for invalid arguments
-  const auto validated_query_keys = autoware::interpolation::validateKeys(base_keys_, query_keys);
-  std::vector<double> interpolated_diff_values;
-  interpolated_diff_values.reserve(query_keys.size());
+  return getSplineInterpolatedDiffValues(locateQueryKeys(query_keys));
+}
+
+std::vector<double> SplineInterpolation::getSplineInterpolatedQuadDiffValues(
+  const std::vector<double> & query_keys) const
+{
+  return getSplineInterpolatedQuadDiffValues(locateQueryKeys(query_keys));
+}
+
+std::vector<double> SplineInterpolation::getSplineInterpolatedValues(const Query & query) const
+{
+  validateQuery(query);
+
+  const size_t n = query.indices.size();
+  std::vector<double> interpolated_values(n);
+  for (size_t i = 0; i < n; ++i) {
+    const auto idx = query.indices[i];
+    const double dx = query.offsets[i];
+    interpolated_values[i] = a_[idx] * dx * dx * dx + b_[idx] * dx * dx + c_[idx] * dx + d_[idx];
+  }
+
+  return interpolated_values;
+}
 
-  for (const auto & key : query_keys) {
-    const auto idx = get_index(key);
-    const auto dx = key - base_keys_[idx];
-    interpolated_diff_values.emplace_back(3 * a_[idx] * dx * dx + 2 * b_[idx] * dx + c_[idx]);
+std::vector<double> SplineInterpolation::getSplineInterpolatedDiffValues(const Query & query) const
+{
+  validateQuery(query);
+
+  const size_t n = query.indices.size();
+  std::vector<double> interpolated_diff_values(n);
+  for (size_t i = 0; i < n; ++i) {
+    const auto idx = query.indices[i];
+    const double dx = query.offsets[i];
+    interpolated_diff_values[i] = 3 * a_[idx] * dx * dx + 2 * b_[idx] * dx + c_[idx];
   }
 
   return interpolated_diff_values;
 }
 
 std::vector<double> SplineInterpolation::getSplineInterpolatedQuadDiffValues(
-  const std::vector<double> & query_keys) const
+  const Query & query) const
 {
-  // throw exceptions for invalid arguments
-  const auto validated_query_keys = autoware::interpolation::validateKeys(base_keys_, query_keys);
-  std::vector<double> interpolated_quad_diff_values;
-  interpolated_quad_diff_values.reserve(query_keys.size());
-
-  for (const auto & key : query_keys) {
-    const auto idx = get_index(key);
-    const auto dx = key - base_keys_[idx];
-    interpolated_quad_diff_values.emplace_back(6 * a_[idx] * dx + 2 * b_[idx]);
+  validateQuery(query);
+
+  const size_t n = query.indices.size();
+  std::vector<double> interpolated_quad_diff_values(n);
+  for (size_t i = 0; i < n; ++i) {
+    const auto idx = query.indices[i];
+    const double dx = query.offsets[i];
+    interpolated_quad_diff_values[i] = 6 * a_[idx] * dx + 2 * b_[idx];
   }
 
   return interpolated_quad_diff_values;
@@ -14,6 +14,7 @@
 
 #include "autoware/interpolation/spline_interpolation_points_2d.hpp"
 
+#include <utility>
 #include <vector>
 
 namespace autoware::interpolation
@@ -109,9 +110,10 @@ geometry_msgs::msg::Point SplineInterpolationPoints2d::getSplineInterpolatedPoin
     whole_s = base_s_vec_.back();
   }
 
-  const double x = spline_x_.getSplineInterpolatedValues({whole_s}).at(0);
-  const double y = spline_y_.getSplineInterpolatedValues({whole_s}).at(0);
-  const double z = spline_z_.getSplineInterpolatedValues({whole_s}).at(0);
+  const auto query = spline_x_.locateQueryKeys({whole_s});
+  const double x = spline_x_.getSplineInterpolatedValues(query).at(0);
+  const double y = spline_y_.getSplineInterpolatedValues(query).at(0);
+  const double z = spline_z_.getSplineInterpolatedValues(query).at(0);
 
   geometry_msgs::msg::Point geom_point;
   geom_point.x = x;
@@ -129,8 +131,9 @@ double SplineInterpolationPoints2d::getSplineInterpolatedYaw(const size_t idx, c
   const double whole_s =
     std::clamp(base_s_vec_.at(idx) + s, base_s_vec_.front(), base_s_vec_.back());
 
-  const double diff_x = spline_x_.getSplineInterpolatedDiffValues({whole_s}).at(0);
-  const double diff_y = spline_y_.getSplineInterpolatedDiffValues({whole_s}).at(0);
+  const auto query = spline_x_.locateQueryKeys({whole_s});
+  const double diff_x = spline_x_.getSplineInterpolatedDiffValues(query).at(0);
+  const double diff_y = spline_y_.getSplineInterpolatedDiffValues(query).at(0);
 
   return std::atan2(diff_y, diff_x);
 }
@@ -155,11 +158,12 @@ double SplineInterpolationPoints2d::getSplineInterpolatedCurvature(
   const double whole_s =
     std::clamp(base_s_vec_.at(idx) + s, base_s_vec_.front(), base_s_vec_.back());
 
-  const double diff_x = spline_x_.getSplineInterpolatedDiffValues({whole_s}).at(0);
-  const double diff_y = spline_y_.getSplineInterpolatedDiffValues({whole_s}).at(0);
+  const auto query = spline_x_.locateQueryKeys({whole_s});
+  const double diff_x = spline_x_.getSplineInterpolatedDiffValues(query).at(0);
+  const double diff_y = spline_y_.getSplineInterpolatedDiffValues(query).at(0);
 
-  const double quad_diff_x = spline_x_.getSplineInterpolatedQuadDiffValues({whole_s}).at(0);
-  const double quad_diff_y = spline_y_.getSplineInterpolatedQuadDiffValues({whole_s}).at(0);
+  const double quad_diff_x = spline_x_.getSplineInterpolatedQuadDiffValues(query).at(0);
+  const double quad_diff_y = spline_y_.getSplineInterpolatedQuadDiffValues(query).at(0);
 
   return (diff_x * quad_diff_y - quad_diff_x * diff_y) /
          std::pow(std::pow(diff_x, 2) + std::pow(diff_y, 2), 1.5);
@@ -205,8 +209,10 @@ void SplineInterpolationPoints2d::calcSplineCoefficientsInner(
   const auto & base_z_vec = base.at(3);
 
   // calculate spline coefficients
-  spline_x_ = SplineInterpolation(base_s_vec_, base_x_vec);
-  spline_y_ = SplineInterpolation(base_s_vec_, base_y_vec);
-  spline_z_ = SplineInterpolation(base_s_vec_, base_z_vec);
+  auto splines =
+    SplineInterpolation::createSplines(base_s_vec_, {base_x_vec, base_y_vec, base_z_vec});
+  spline_x_ = std::move(splines.at(0));
+  spline_y_ = std::move(splines.at(1));
+  spline_z_ = std::move(splines.at(2));
 }
 }  // namespace autoware::interpolation
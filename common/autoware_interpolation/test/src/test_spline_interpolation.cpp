@@ -19,6 +19,7 @@
 #include <gtest/gtest.h>
 
 #include <limits>
+#include <stdexcept>
 #include <vector>
 
 constexpr double epsilon = 1e-6;
@@ -278,3 +279,58 @@ TEST(spline_interpolation, SplineInterpolation)
     }
   }
 }
+
+TEST(spline_interpolation, createSplines)
+{
+  const std::vector<double> base_keys{-1.5, 1.0, 5.0, 10.0, 15.0, 20.0};
+  const std::vector<double> base_values1{-1.2, 0.5, 1.0, 1.2, 2.0, 1.0};
+  const std::vector<double> base_values2{0.0, 2.0, -1.0, 3.0, 3.5, 0.5};
+  const std::vector<double> query_keys{-1.5, 0.0, 1.0, 8.0, 12.0, 18.0, 20.0};
+
+  {
+    // cached Akima spline
+    const SplineInterpolation s(
+      base_keys, base_values1, autoware::interpolation::SplineType::AKIMA);
+    const auto query_values = s.getSplineInterpolatedValues(query_keys);
+    const auto ans = autoware::interpolation::splineByAkima(base_keys, base_values1, query_keys);
+    for (size_t i = 0; i < query_values.size(); ++i) {
+      EXPECT_NEAR(query_values.at(i), ans.at(i), epsilon);
+    }
+  }
+
+  for (const auto type :
+       {autoware::interpolation::SplineType::CUBIC, autoware::interpolation::SplineType::AKIMA}) {
+    const auto splines =
+      SplineInterpolation::createSplines(base_keys, {base_values1, base_values2}, type);
+    ASSERT_EQ(splines.size(), 2u);
+
+    // the splines of all the channels are evaluated on the same query
+    const auto query = splines.front().locateQueryKeys(query_keys);
+    for (size_t channel = 0; channel < splines.size(); ++channel) {
+      const auto & base_values = channel == 0 ? base_values1 : base_values2;
+      const SplineInterpolation s(base_keys, base_values, type);
+
+      const auto values = splines.at(channel).getSplineInterpolatedValues(query);
+      const auto diff_values = splines.at(channel).getSplineInterpolatedDiffValues(query);
+      const auto quad_diff_values = splines.at(channel).getSplineInterpolatedQuadDiffValues(query);
+      const auto ans = s.getSplineInterpolatedValues(query_keys);
+      const auto ans_diff = s.getSplineInterpolatedDiffValues(query_keys);
+      const auto ans_quad_diff = s.getSplineInterpolatedQuadDiffValues(query_keys);
+
+      ASSERT_EQ(values.size(), query_keys.size());
+      for (size_t i = 0; i < query_keys.size(); ++i) {
+        EXPECT_NEAR(values.at(i), ans.at(i), epsilon);
+        EXPECT_NEAR(diff_values.at(i), ans_diff.at(i), epsilon);
+        EXPECT_NEAR(quad_diff_values.at(i), ans_quad_diff.at(i), epsilon);
+      }
+    }
+  }
+
+  {
+    // query located by the spline with the other base keys
+    const SplineInterpolation s1(base_keys, base_values1);
+    const SplineInterpolation s2({0.0, 1.0}, {0.0, 1.0});
+    EXPECT_THROW(
+      s2.getSplineInterpolatedValues(s1.locateQueryKeys(query_keys)), std::invalid_argument);
+  }
+}
@@ -0,0 +1,187 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks of the trajectory queries on Path, PathWithLaneId and Trajectory points. The time
+// of insertStopPoint and insertTargetPoint includes the copy of the points, since the points are
+// modified. The queries are expected to be linear in the number of points, so the fitted
+// complexity is reported as well, e.g. "insertStopPoint/Path_BigO 12.3 N", and a query which has
+// become super-linear shows up there with a large RMS.
+
+#include "autoware/motion_utils/trajectory/trajectory.hpp"
+
+#include <autoware_utils_geometry/geometry.hpp>
+
+#include <autoware_internal_planning_msgs/msg/path_point_with_lane_id.hpp>
+#include <autoware_planning_msgs/msg/path_point.hpp>
+#include <autoware_planning_msgs/msg/trajectory_point.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace
+{
+using autoware_internal_planning_msgs::msg::PathPointWithLaneId;
+using autoware_planning_msgs::msg::PathPoint;
+using autoware_planning_msgs::msg::TrajectoryPoint;
+
+const std::vector<int64_t> num_points_list = {10, 100, 1000, 10000};
+
+template <class PointT>
+std::vector<PointT> generateCurvedPoints(const size_t num_points)
+{
+  std::vector<PointT> points;
+  points.reserve(num_points);
+  for (size_t i = 0; i < num_points; ++i) {
+    const double x = static_cast<double>(i);
+    const double y = 5.0 * std::sin(0.01 * x);
+    const double yaw = std::atan(0.05 * std::cos(0.01 * x));
+
+    geometry_msgs::msg::Pose pose;
+    pose.position = autoware_utils_geometry::create_point(x, y, 0.0);
+    pose.orientation = autoware_utils_geometry::create_quaternion_from_yaw(yaw);
+
+    PointT p;
+    autoware_utils_geometry::set_pose(pose, p);
+    autoware_utils_geometry::set_longitudinal_velocity(10.0, p);
+    points.push_back(p);
+  }
+  return points;
+}
+
+geometry_msgs::msg::Pose getQueryPose(const geometry_msgs::msg::Pose & pose)
+{
+  auto query = pose;
+  query.position.y += 1.0;
+  return query;
+}
+
+template <class PointT>
+void findNearestIndex(benchmark::State & state)
+{
+  const auto points = generateCurvedPoints<PointT>(state.range(0));
+  const auto query = getQueryPose(autoware_utils_geometry::get_pose(points.at(points.size() / 2)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(autoware::motion_utils::findNearestIndex(points, query.position));
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+template <class PointT>
+void findFirstNearestSegmentIndexWithSoftConstraints(benchmark::State & state)
+{
+  const auto points = generateCurvedPoints<PointT>(state.range(0));
+  const auto query = getQueryPose(autoware_utils_geometry::get_pose(points.at(points.size() / 2)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+      autoware::motion_utils::findFirstNearestSegmentIndexWithSoftConstraints(
+        points, query, 3.0, 1.0));
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+template <class PointT>
+void calcSignedArcLength(benchmark::State & state)
+{
+  const auto points = generateCurvedPoints<PointT>(state.range(0));
+  const auto src = getQueryPose(autoware_utils_geometry::get_pose(points.front())).position;
+  const auto dst = getQueryPose(autoware_utils_geometry::get_pose(points.back())).position;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(autoware::motion_utils::calcSignedArcLength(points, src, dst));
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+template <class PointT>
+void calcLateralOffset(benchmark::State & state)
+{
+  const auto points = generateCurvedPoints<PointT>(state.range(0));
+  const auto query = getQueryPose(autoware_utils_geometry::get_pose(points.at(points.size() / 2)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(autoware::motion_utils::calcLateralOffset(points, query.position));
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+template <class PointT>
+void insertStopPoint(benchmark::State & state)
+{
+  const auto points = generateCurvedPoints<PointT>(state.range(0));
+  const double distance_to_stop_point = 0.9 * autoware::motion_utils::calcArcLength(points);
+  for (auto _ : state) {
+    auto stop_points = points;
+    benchmark::DoNotOptimize(
+      autoware::motion_utils::insertStopPoint(distance_to_stop_point, stop_points));
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+template <class PointT>
+void insertTargetPoint(benchmark::State & state)
+{
+  const auto points = generateCurvedPoints<PointT>(state.range(0));
+  const double arc_length = autoware::motion_utils::calcArcLength(points);
+  const size_t last_segment_idx = points.size() - 2;
+  for (auto _ : state) {
+    auto target_points = points;
+    benchmark::DoNotOptimize(
+      autoware::motion_utils::insertTargetPoint(size_t{0}, 0.9 * arc_length, target_points));
+    // the backward search from the last segment
+    benchmark::DoNotOptimize(autoware::motion_utils::insertTargetPoint(
+      last_segment_idx, -0.5 * arc_length, target_points));
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+template <class PointT>
+void calcCurvature(benchmark::State & state)
+{
+  const auto points = generateCurvedPoints<PointT>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(autoware::motion_utils::calcCurvature(points).data());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+template <class PointT>
+void registerBenchmarks(const std::string & point_type_name)
+{
+  const auto register_benchmark = [&](const std::string & name, auto func) {
+    auto * registered = benchmark::RegisterBenchmark((name + "/" + point_type_name).c_str(), func);
+    registered->ArgName("N");
+    for (const auto num_points : num_points_list) {
+      registered->Arg(num_points);
+    }
+    registered->Complexity(benchmark::oN);
+  };
+  register_benchmark("findNearestIndex", findNearestIndex<PointT>);
+  register_benchmark(
+    "findFirstNearestSegmentIndexWithSoftConstraints",
+    findFirstNearestSegmentIndexWithSoftConstraints<PointT>);
+  register_benchmark("calcSignedArcLength", calcSignedArcLength<PointT>);
+  register_benchmark("calcLateralOffset", calcLateralOffset<PointT>);
+  register_benchmark("insertStopPoint", insertStopPoint<PointT>);
+  register_benchmark("insertTargetPoint", insertTargetPoint<PointT>);
+  register_benchmark("calcCurvature", calcCurvature<PointT>);
+}
+
+[[maybe_unused]] const bool is_registered = []() {
+  registerBenchmarks<PathPoint>("Path");
+  registerBenchmarks<PathPointWithLaneId>("PathWithLaneId");
+  registerBenchmarks<TrajectoryPoint>("Trajectory");
+  return true;
+}();
+}  // namespace
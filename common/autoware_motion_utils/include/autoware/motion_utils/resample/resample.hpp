@@ -210,6 +210,28 @@ autoware_planning_msgs::msg::Trajectory resampleTrajectory(
   const std::vector<double> & resampled_arclength, const bool use_akima_spline_for_xy = false,
   const bool use_lerp_for_z = true, const bool use_zero_order_hold_for_twist = true);
 
+/**
+ * @brief A resampling function for trajectory points, which is the same as the above function but
+ *        writes the resampled points to the given vector to reuse its memory. When the arguments
+ *        are invalid, the input points are copied to the output.
+ * @param input_points input trajectory points to resample
+ * @param resampled_arclength arclength that contains length of each resampling points from initial
+ *        point
+ * @param output_points resampled trajectory points
+ * @param use_akima_spline_for_xy If true, it uses linear interpolation to resample position x and
+ *        y. Otherwise, it uses spline interpolation
+ * @param use_lerp_for_z If true, it uses linear interpolation to resample position z.
+ *        Otherwise, it uses spline interpolation
+ * @param use_zero_order_hold_for_twist If true, it uses zero_order_hold to resample
+ *        longitudinal, lateral velocity and acceleration. Otherwise, it uses linear interpolation
+ */
+void resampleTrajectory(
+  const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & input_points,
+  const std::vector<double> & resampled_arclength,
+  std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & output_points,
+  const bool use_akima_spline_for_xy = false, const bool use_lerp_for_z = true,
+  const bool use_zero_order_hold_for_twist = true);
+
 /**
  * @brief A resampling function for a trajectory. This function resamples closest stop point,
  *        terminal point and points by resample interval. Note that in a default setting, position
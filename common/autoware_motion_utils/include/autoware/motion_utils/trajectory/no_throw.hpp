@@ -0,0 +1,498 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__MOTION_UTILS__TRAJECTORY__NO_THROW_HPP_
+#define AUTOWARE__MOTION_UTILS__TRAJECTORY__NO_THROW_HPP_
+
+#include <Eigen/Core>
+#include <autoware_utils_geometry/geometry.hpp>
+#include <autoware_utils_math/constants.hpp>
+
+#include <geometry_msgs/msg/point.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <cmath>
+#include <limits>
+#include <optional>
+
+namespace autoware::motion_utils
+{
+/**
+ * @brief check if a point is in a non-sharp angle between two points
+ * @param point1 front point
+ * @param point2 point to be checked
+ * @param point3 back point
+ * @return true if the angle is not sharp
+ */
+template <class T>
+[[nodiscard]] bool isNonSharpAngle(
+  const T & point1, const T & point2, const T & point3,
+  const double angle_threshold = autoware_utils_math::pi / 4)
+{
+  const auto p1 = autoware_utils_geometry::get_point(point1);
+  const auto p2 = autoware_utils_geometry::get_point(point2);
+  const auto p3 = autoware_utils_geometry::get_point(point3);
+
+  const double product =
+    (p2.x - p1.x) * (p2.x - p3.x) + (p2.y - p1.y) * (p2.y - p3.y) + (p2.z - p1.z) * (p2.z - p3.z);
+
+  const auto dist_1to2 = autoware_utils_geometry::calc_distance3d(p1, p2);
+  const auto dist_3to2 = autoware_utils_geometry::calc_distance3d(p3, p2);
+
+  constexpr double epsilon = 1e-3;
+  return !(std::cos(angle_threshold) < product / dist_1to2 / dist_3to2 + epsilon);
+}
+
+/**
+ * @brief The functions in this namespace do not validate their arguments. They are meant for the
+ * callers which have already validated the points, e.g. in a loop over the same trajectory, and
+ * must not pay for the validation, the exception handling and the backtrace printing again. The
+ * preconditions are written in each function, and the behavior is undefined if they are not met.
+ */
+namespace unchecked
+{
+/**
+ * @brief calculate the signed 2D arc length between two indices of points
+ * @pre src_idx < points.size() and dst_idx < points.size()
+ * @return arc length, which is negative if dst_idx is less than src_idx
+ */
+template <class T>
+[[nodiscard]] double calcSignedArcLength(
+  const T & points, const size_t src_idx, const size_t dst_idx)
+{
+  if (src_idx > dst_idx) {
+    return -calcSignedArcLength(points, dst_idx, src_idx);
+  }
+
+  double dist_sum = 0.0;
+  for (size_t i = src_idx; i < dst_idx; ++i) {
+    dist_sum += autoware_utils_geometry::calc_distance2d(points[i], points[i + 1]);
+  }
+  return dist_sum;
+}
+
+/**
+ * @brief calculate the 2D arc length of points
+ * @pre !points.empty()
+ */
+template <class T>
+[[nodiscard]] double calcArcLength(const T & points)
+{
+  return calcSignedArcLength(points, 0, points.size() - 1);
+}
+
+/**
+ * @brief find the index of the nearest point in 2D
+ * @pre !points.empty()
+ */
+template <class T>
+[[nodiscard]] size_t findNearestIndex(const T & points, const geometry_msgs::msg::Point & point)
+{
+  double min_dist = std::numeric_limits<double>::max();
+  size_t min_idx = 0;
+
+  for (size_t i = 0; i < points.size(); ++i) {
+    const auto dist = autoware_utils_geometry::calc_squared_distance2d(points[i], point);
+    if (dist < min_dist) {
+      min_dist = dist;
+      min_idx = i;
+    }
+  }
+  return min_idx;
+}
+
+/**
+ * @brief calculate the longitudinal offset of a point from the front point of a segment
+ * @pre seg_idx + 1 < points.size(), and the points of the segment do not overlap
+ */
+template <class T>
+[[nodiscard]] double calcLongitudinalOffsetToSegment(
+  const T & points, const size_t seg_idx, const geometry_msgs::msg::Point & p_target)
+{
+  const auto & p_front = autoware_utils_geometry::get_point(points[seg_idx]);
+  const auto & p_back = autoware_utils_geometry::get_point(points[seg_idx + 1]);
+
+  const Eigen::Vector3d segment_vec{p_back.x - p_front.x, p_back.y - p_front.y, 0};
+  const Eigen::Vector3d target_vec{p_target.x - p_front.x, p_target.y - p_front.y, 0};
+
+  return segment_vec.dot(target_vec) / segment_vec.norm();
+}
+
+/**
+ * @brief find the index of the nearest segment in 2D
+ * @pre points.size() >= 2, and no consecutive points overlap
+ */
+template <class T>
+[[nodiscard]] size_t findNearestSegmentIndex(
+  const T & points, const geometry_msgs::msg::Point & point)
+{
+  const size_t nearest_idx = findNearestIndex(points, point);
+
+  if (nearest_idx == 0) {
+    return 0;
+  }
+  if (nearest_idx == points.size() - 1) {
+    return points.size() - 2;
+  }
+
+  if (calcLongitudinalOffsetToSegment(points, nearest_idx, point) <= 0) {
+    return nearest_idx - 1;
+  }
+  return nearest_idx;
+}
+
+/**
+ * @brief calculate the signed 2D arc length from a point to an index of points
+ * @pre dst_idx < points.size(), points.size() >= 2, and no consecutive points overlap
+ */
+template <class T>
+[[nodiscard]] double calcSignedArcLength(
+  const T & points, const geometry_msgs::msg::Point & src_point, const size_t dst_idx)
+{
+  const size_t src_seg_idx = findNearestSegmentIndex(points, src_point);
+  return calcSignedArcLength(points, src_seg_idx, dst_idx) -
+         calcLongitudinalOffsetToSegment(points, src_seg_idx, src_point);
+}
+
+/**
+ * @brief calculate the signed 2D arc length from an index of points to a point
+ * @pre src_idx < points.size(), points.size() >= 2, and no consecutive points overlap
+ */
+template <class T>
+[[nodiscard]] double calcSignedArcLength(
+  const T & points, const size_t src_idx, const geometry_msgs::msg::Point & dst_point)
+{
+  return -calcSignedArcLength(points, dst_point, src_idx);
+}
+
+/**
+ * @brief calculate the signed 2D arc length between two points projected on points
+ * @pre points.size() >= 2, and no consecutive points overlap
+ */
+template <class T>
+[[nodiscard]] double calcSignedArcLength(
+  const T & points, const geometry_msgs::msg::Point & src_point,
+  const geometry_msgs::msg::Point & dst_point)
+{
+  const size_t src_seg_idx = findNearestSegmentIndex(points, src_point);
+  const size_t dst_seg_idx = findNearestSegmentIndex(points, dst_point);
+
+  return calcSignedArcLength(points, src_seg_idx, dst_seg_idx) -
+         calcLongitudinalOffsetToSegment(points, src_seg_idx, src_point) +
+         calcLongitudinalOffsetToSegment(points, dst_seg_idx, dst_point);
+}
+
+/**
+ * @brief insert a point in a segment of points
+ * @pre seg_idx + 1 < points.size(), and p_target is in a non-sharp angle between the points of the
+ * segment
+ * @return index of the inserted point, or of the point which p_target overlaps with
+ */
+template <class T>
+size_t insertTargetPoint(
+  const size_t seg_idx, const geometry_msgs::msg::Point & p_target, T & points,
+  const double overlap_threshold = 1e-3)
+{
+  const auto p_front = autoware_utils_geometry::get_point(points[seg_idx]);
+  const auto p_back = autoware_utils_geometry::get_point(points[seg_idx + 1]);
+
+  const auto overlap_with_front =
+    autoware_utils_geometry::calc_distance2d(p_target, p_front) < overlap_threshold;
+  const auto overlap_with_back =
+    autoware_utils_geometry::calc_distance2d(p_target, p_back) < overlap_threshold;
+
+  const bool is_driving_forward = autoware_utils_geometry::is_driving_forward(
+    autoware_utils_geometry::get_pose(points[0]), autoware_utils_geometry::get_pose(points[1]));
+
+  geometry_msgs::msg::Pose target_pose;
+  {
+    const auto p_base = is_driving_forward ? p_back : p_front;
+    const auto pitch = autoware_utils_geometry::calc_elevation_angle(p_target, p_base);
+    const auto yaw = autoware_utils_geometry::calc_azimuth_angle(p_target, p_base);
+
+    target_pose.position = p_target;
+    target_pose.orientation = autoware_utils_geometry::create_quaternion_from_rpy(0.0, pitch, yaw);
+  }
+
+  auto p_insert = points[seg_idx];
+  autoware_utils_geometry::set_pose(target_pose, p_insert);
+
+  geometry_msgs::msg::Pose base_pose;
+  {
+    const auto p_base = is_driving_forward ? p_front : p_back;
+    const auto pitch = autoware_utils_geometry::calc_elevation_angle(p_base, p_target);
+    const auto yaw = autoware_utils_geometry::calc_azimuth_angle(p_base, p_target);
+
+    base_pose.position = autoware_utils_geometry::get_point(p_base);
+    base_pose.orientation = autoware_utils_geometry::create_quaternion_from_rpy(0.0, pitch, yaw);
+  }
+
+  if (!overlap_with_front && !overlap_with_back) {
+    if (is_driving_forward) {
+      autoware_utils_geometry::set_pose(base_pose, points[seg_idx]);
+    } else {
+      autoware_utils_geometry::set_pose(base_pose, points[seg_idx + 1]);
+    }
+    points.insert(points.begin() + seg_idx + 1, p_insert);
+    return seg_idx + 1;
+  }
+
+  if (overlap_with_back) {
+    return seg_idx + 1;
+  }
+
+  return seg_idx;
+}
+}  // namespace unchecked
+
+/**
+ * @brief The functions in this namespace return std::nullopt for invalid arguments instead of
+ * throwing an exception, printing a backtrace or returning a magic value such as 0.0 or NaN. The
+ * validation is limited to cheap checks of the sizes and indices, and the points are never copied.
+ */
+namespace no_throw
+{
+/**
+ * @brief find the index of the first point after seg_idx which does not overlap with the front
+ * point of the segment. The overlap is checked in the same way as removeOverlapPoints().
+ * @return std::nullopt if seg_idx is out of range or all the following points overlap
+ */
+template <class T>
+[[nodiscard]] std::optional<size_t> findSegmentBackIndex(const T & points, const size_t seg_idx)
+{
+  if (seg_idx + 1 >= points.size()) {
+    return std::nullopt;
+  }
+
+  constexpr double eps = 1.0E-08;
+  const auto & p_front = autoware_utils_geometry::get_point(points[seg_idx]);
+  for (size_t i = seg_idx + 1; i < points.size(); ++i) {
+    const auto & p = autoware_utils_geometry::get_point(points[i]);
+    if (std::abs(p_front.x - p.x) >= eps || std::abs(p_front.y - p.y) >= eps) {
+      return i;
+    }
+  }
+  return std::nullopt;
+}
+
+/**
+ * @brief calculate the signed 2D arc length between two indices of points
+ * @return std::nullopt if an index is out of range
+ */
+template <class T>
+[[nodiscard]] std::optional<double> calcSignedArcLength(
+  const T & points, const size_t src_idx, const size_t dst_idx)
+{
+  if (src_idx >= points.size() || dst_idx >= points.size()) {
+    return std::nullopt;
+  }
+  return unchecked::calcSignedArcLength(points, src_idx, dst_idx);
+}
+
+/**
+ * @brief calculate the 2D arc length of points
+ * @return std::nullopt if points is empty
+ */
+template <class T>
+[[nodiscard]] std::optional<double> calcArcLength(const T & points)
+{
+  if (points.empty()) {
+    return std::nullopt;
+  }
+  return unchecked::calcArcLength(points);
+}
+
+/**
+ * @brief find the index of the nearest point in 2D
+ * @return std::nullopt if points is empty
+ */
+template <class T>
+[[nodiscard]] std::optional<size_t> findNearestIndex(
+  const T & points, const geometry_msgs::msg::Point & point)
+{
+  if (points.empty()) {
+    return std::nullopt;
+  }
+  return unchecked::findNearestIndex(points, point);
+}
+
+/**
+ * @brief calculate the longitudinal offset of a point from the front point of a segment. The
+ * overlapping points after the front point are skipped as in the throwing version.
+ * @return std::nullopt if seg_idx is out of range or all the following points overlap
+ */
+template <class T>
+[[nodiscard]] std::optional<double> calcLongitudinalOffsetToSegment(
+  const T & points, const size_t seg_idx, const geometry_msgs::msg::Point & p_target)
+{
+  const auto back_idx = findSegmentBackIndex(points, seg_idx);
+  if (!back_idx) {
+    return std::nullopt;
+  }
+
+  const auto & p_front = autoware_utils_geometry::get_point(points[seg_idx]);
+  const auto & p_back = autoware_utils_geometry::get_point(points[*back_idx]);
+
+  const Eigen::Vector3d segment_vec{p_back.x - p_front.x, p_back.y - p_front.y, 0};
+  const Eigen::Vector3d target_vec{p_target.x - p_front.x, p_target.y - p_front.y, 0};
+
+  return segment_vec.dot(target_vec) / segment_vec.norm();
+}
+
+/**
+ * @brief find the index of the nearest segment in 2D
+ * @return std::nullopt if points has less than two points
+ */
+template <class T>
+[[nodiscard]] std::optional<size_t> findNearestSegmentIndex(
+  const T & points, const geometry_msgs::msg::Point & point)
+{
+  if (points.size() < 2) {
+    return std::nullopt;
+  }
+
+  const size_t nearest_idx = unchecked::findNearestIndex(points, point);
+
+  if (nearest_idx == 0) {
+    return 0;
+  }
+  if (nearest_idx == points.size() - 1) {
+    return points.size() - 2;
+  }
+
+  const auto signed_length = calcLongitudinalOffsetToSegment(points, nearest_idx, point);
+  if (signed_length && *signed_length <= 0) {
+    return nearest_idx - 1;
+  }
+  return nearest_idx;
+}
+
+/**
+ * @brief calculate the signed 2D arc length from a point to an index of points
+ * @return std::nullopt if dst_idx is out of range, points has less than two points or the nearest
+ * segment of src_point consists of overlapping points
+ */
+template <class T>
+[[nodiscard]] std::optional<double> calcSignedArcLength(
+  const T & points, const geometry_msgs::msg::Point & src_point, const size_t dst_idx)
+{
+  if (dst_idx >= points.size()) {
+    return std::nullopt;
+  }
+
+  const auto src_seg_idx = findNearestSegmentIndex(points, src_point);
+  if (!src_seg_idx) {
+    return std::nullopt;
+  }
+  const auto src_offset = calcLongitudinalOffsetToSegment(points, *src_seg_idx, src_point);
+  if (!src_offset) {
+    return std::nullopt;
+  }
+
+  return unchecked::calcSignedArcLength(points, *src_seg_idx, dst_idx) - *src_offset;
+}
+
+/**
+ * @brief calculate the signed 2D arc length from an index of points to a point
+ * @return std::nullopt if src_idx is out of range, points has less than two points or the nearest
+ * segment of dst_point consists of overlapping points
+ */
+template <class T>
+[[nodiscard]] std::optional<double> calcSignedArcLength(
+  const T & points, const size_t src_idx, const geometry_msgs::msg::Point & dst_point)
+{
+  const auto length = calcSignedArcLength(points, dst_point, src_idx);
+  if (!length) {
+    return std::nullopt;
+  }
+  return -*length;
+}
+
+/**
+ * @brief calculate the signed 2D arc length between two points projected on points
+ * @return std::nullopt if points has less than two points or the nearest segment of a point
+ * consists of overlapping points
+ */
+template <class T>
+[[nodiscard]] std::optional<double> calcSignedArcLength(
+  const T & points, const geometry_msgs::msg::Point & src_point,
+  const geometry_msgs::msg::Point & dst_point)
+{
+  const auto src_seg_idx = findNearestSegmentIndex(points, src_point);
+  const auto dst_seg_idx = findNearestSegmentIndex(points, dst_point);
+  if (!src_seg_idx || !dst_seg_idx) {
+    return std::nullopt;
+  }
+
+  const auto src_offset = calcLongitudinalOffsetToSegment(points, *src_seg_idx, src_point);
+  const auto dst_offset = calcLongitudinalOffsetToSegment(points, *dst_seg_idx, dst_point);
+  if (!src_offset || !dst_offset) {
+    return std::nullopt;
+  }
+
+  return unchecked::calcSignedArcLength(points, *src_seg_idx, *dst_seg_idx) - *src_offset +
+         *dst_offset;
+}
+
+/**
+ * @brief insert a point in a segment of points
+ * @return std::nullopt if seg_idx is out of range or p_target is in a sharp angle between the
+ * points of the segment
+ */
+template <class T>
+std::optional<size_t> insertTargetPoint(
+  const size_t seg_idx, const geometry_msgs::msg::Point & p_target, T & points,
+  const double overlap_threshold = 1e-3)
+{
+  if (seg_idx + 1 >= points.size()) {
+    return std::nullopt;
+  }
+
+  const auto p_front = autoware_utils_geometry::get_point(points[seg_idx]);
+  const auto p_back = autoware_utils_geometry::get_point(points[seg_idx + 1]);
+  if (!isNonSharpAngle(p_front, p_target, p_back)) {
+    return std::nullopt;
+  }
+
+  return unchecked::insertTargetPoint(seg_idx, p_target, points, overlap_threshold);
+}
+
+/**
+ * @brief insert a point in points at the given arc length from the front point
+ * @return std::nullopt if the length is negative or beyond the points, or p_target is in a sharp
+ * angle between the points of the segment
+ */
+template <class T>
+std::optional<size_t> insertTargetPoint(
+  const double insert_point_length, const geometry_msgs::msg::Point & p_target, T & points,
+  const double overlap_threshold = 1e-3)
+{
+  if (insert_point_length < 0.0) {
+    return std::nullopt;
+  }
+
+  // the arc length is accumulated in the same order as calcSignedArcLength(points, 0, i)
+  double length = 0.0;
+  for (size_t i = 1; i < points.size(); ++i) {
+    length += autoware_utils_geometry::calc_distance2d(points[i - 1], points[i]);
+    if (insert_point_length <= length) {
+      return insertTargetPoint(i - 1, p_target, points, overlap_threshold);
+    }
+  }
+  return std::nullopt;
+}
+}  // namespace no_throw
+}  // namespace autoware::motion_utils
+
+#endif  // AUTOWARE__MOTION_UTILS__TRAJECTORY__NO_THROW_HPP_
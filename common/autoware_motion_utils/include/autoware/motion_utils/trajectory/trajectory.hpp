@@ -15,6 +15,8 @@
 #ifndef AUTOWARE__MOTION_UTILS__TRAJECTORY__TRAJECTORY_HPP_
 #define AUTOWARE__MOTION_UTILS__TRAJECTORY__TRAJECTORY_HPP_
 
+#include "autoware/motion_utils/trajectory/no_throw.hpp"
+
 #include <Eigen/Geometry>
 #include <autoware_utils_geometry/geometry.hpp>
 #include <autoware_utils_geometry/pose_deviation.hpp>
@@ -74,19 +76,7 @@ void validateNonSharpAngle(
   const T & point1, const T & point2, const T & point3,
   const double angle_threshold = autoware_utils_math::pi / 4)
 {
-  const auto p1 = autoware_utils_geometry::get_point(point1);
-  const auto p2 = autoware_utils_geometry::get_point(point2);
-  const auto p3 = autoware_utils_geometry::get_point(point3);
-
-  const std::vector vec_1to2 = {p2.x - p1.x, p2.y - p1.y, p2.z - p1.z};
-  const std::vector vec_3to2 = {p2.x - p3.x, p2.y - p3.y, p2.z - p3.z};
-  const auto product = std::inner_product(vec_1to2.begin(), vec_1to2.end(), vec_3to2.begin(), 0.0);
-
-  const auto dist_1to2 = autoware_utils_geometry::calc_distance3d(p1, p2);
-  const auto dist_3to2 = autoware_utils_geometry::calc_distance3d(p3, p2);
-
-  constexpr double epsilon = 1e-3;
-  if (std::cos(angle_threshold) < product / dist_1to2 / dist_3to2 + epsilon) {
+  if (!isNonSharpAngle(point1, point2, point3, angle_threshold)) {
     autoware_utils_system::print_backtrace();
     throw std::invalid_argument(
       "[autoware_motion_utils] validateNonSharpAngle(): Too sharp angle.");
@@ -422,20 +412,9 @@ double calcLongitudinalOffsetToSegment(
     return std::nan("");
   }
 
-  const auto overlap_removed_points = removeOverlapPoints(points, seg_idx);
-
-  if (throw_exception) {
-    validateNonEmpty(overlap_removed_points);
-  } else {
-    try {
-      validateNonEmpty(overlap_removed_points);
-    } catch (const std::exception & e) {
-      RCLCPP_DEBUG(get_logger(), "%s", e.what());
-      return std::nan("");
-    }
-  }
-
-  if (seg_idx >= overlap_removed_points.size() - 1) {
+  // the overlapping points after seg_idx are skipped without copying the points
+  const auto back_idx = no_throw::findSegmentBackIndex(points, seg_idx);
+  if (!back_idx) {
     const std::string error_message(
       "[autoware_motion_utils] " + std::string(__func__) +
       ": Longitudinal offset calculation is not supported for the same points.");
@@ -450,8 +429,8 @@ double calcLongitudinalOffsetToSegment(
     return std::nan("");
   }
 
-  const auto p_front = autoware_utils_geometry::get_point(overlap_removed_points.at(seg_idx));
-  const auto p_back = autoware_utils_geometry::get_point(overlap_removed_points.at(seg_idx + 1));
+  const auto p_front = autoware_utils_geometry::get_point(points.at(seg_idx));
+  const auto p_back = autoware_utils_geometry::get_point(points.at(*back_idx));
 
   const Eigen::Vector3d segment_vec{p_back.x - p_front.x, p_back.y - p_front.y, 0};
   const Eigen::Vector3d target_vec{p_target.x - p_front.x, p_target.y - p_front.y, 0};
@@ -1390,54 +1369,7 @@ std::optional<size_t> insertTargetPoint(
     return {};
   }
 
-  const auto overlap_with_front =
-    autoware_utils_geometry::calc_distance2d(p_target, p_front) < overlap_threshold;
-  const auto overlap_with_back =
-    autoware_utils_geometry::calc_distance2d(p_target, p_back) < overlap_threshold;
-
-  const auto is_driving_forward = isDrivingForward(points);
-  if (!is_driving_forward) {
-    return {};
-  }
-
-  geometry_msgs::msg::Pose target_pose;
-  {
-    const auto p_base = is_driving_forward.value() ? p_back : p_front;
-    const auto pitch = autoware_utils_geometry::calc_elevation_angle(p_target, p_base);
-    const auto yaw = autoware_utils_geometry::calc_azimuth_angle(p_target, p_base);
-
-    target_pose.position = p_target;
-    target_pose.orientation = autoware_utils_geometry::create_quaternion_from_rpy(0.0, pitch, yaw);
-  }
-
-  auto p_insert = points.at(seg_idx);
-  autoware_utils_geometry::set_pose(target_pose, p_insert);
-
-  geometry_msgs::msg::Pose base_pose;
-  {
-    const auto p_base = is_driving_forward.value() ? p_front : p_back;
-    const auto pitch = autoware_utils_geometry::calc_elevation_angle(p_base, p_target);
-    const auto yaw = autoware_utils_geometry::calc_azimuth_angle(p_base, p_target);
-
-    base_pose.position = autoware_utils_geometry::get_point(p_base);
-    base_pose.orientation = autoware_utils_geometry::create_quaternion_from_rpy(0.0, pitch, yaw);
-  }
-
-  if (!overlap_with_front && !overlap_with_back) {
-    if (is_driving_forward.value()) {
-      autoware_utils_geometry::set_pose(base_pose, points.at(seg_idx));
-    } else {
-      autoware_utils_geometry::set_pose(base_pose, points.at(seg_idx + 1));
-    }
-    points.insert(points.begin() + seg_idx + 1, p_insert);
-    return seg_idx + 1;
-  }
-
-  if (overlap_with_back) {
-    return seg_idx + 1;
-  }
-
-  return seg_idx;
+  return unchecked::insertTargetPoint(seg_idx, p_target, points, overlap_threshold);
 }
 
 extern template std::optional<size_t>
@@ -1478,10 +1410,11 @@ std::optional<size_t> insertTargetPoint(
   }
 
   // Get Nearest segment index
+  // the length is accumulated in the same order as calcSignedArcLength(points, 0, i)
   std::optional<size_t> segment_idx = std::nullopt;
+  double length = 0.0;
   for (size_t i = 1; i < points.size(); ++i) {
-    // TODO(Mamoru Sobue): find accumulated sum beforehand
-    const double length = calcSignedArcLength(points, 0, i);
+    length += autoware_utils_geometry::calc_distance2d(points.at(i - 1), points.at(i));
     if (insert_point_length <= length) {
       segment_idx = i - 1;
       break;
@@ -1533,10 +1466,12 @@ std::optional<size_t> insertTargetPoint(
   }
 
   // Get Nearest segment index
+  // the length from src_segment_idx is accumulated not to make the search quadratic
   std::optional<size_t> segment_idx = std::nullopt;
+  double length = 0.0;
   if (0.0 <= insert_point_length) {
     for (size_t i = src_segment_idx + 1; i < points.size(); ++i) {
-      const double length = calcSignedArcLength(points, src_segment_idx, i);
+      length += autoware_utils_geometry::calc_distance2d(points.at(i - 1), points.at(i));
       if (insert_point_length <= length) {
         segment_idx = i - 1;
         break;
@@ -1544,7 +1479,7 @@ std::optional<size_t> insertTargetPoint(
     }
   } else {
     for (int i = src_segment_idx - 1; 0 <= i; --i) {
-      const double length = calcSignedArcLength(points, src_segment_idx, i);
+      length -= autoware_utils_geometry::calc_distance2d(points.at(i), points.at(i + 1));
       if (length <= insert_point_length) {
         segment_idx = i;
         break;
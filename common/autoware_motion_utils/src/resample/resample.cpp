@@ -25,10 +25,175 @@
 #include <algorithm>
 #include <cstdlib>
 #include <iostream>
+#include <utility>
 #include <vector>
 
 namespace autoware::motion_utils
 {
+namespace
+{
+geometry_msgs::msg::Point & getMutablePoint(geometry_msgs::msg::Point & point)
+{
+  return point;
+}
+geometry_msgs::msg::Point & getMutablePoint(geometry_msgs::msg::Pose & pose)
+{
+  return pose.position;
+}
+geometry_msgs::msg::Point & getMutablePoint(autoware_planning_msgs::msg::PathPoint & point)
+{
+  return point.pose.position;
+}
+geometry_msgs::msg::Point & getMutablePoint(
+  autoware_internal_planning_msgs::msg::PathPointWithLaneId & point)
+{
+  return point.point.pose.position;
+}
+geometry_msgs::msg::Point & getMutablePoint(autoware_planning_msgs::msg::TrajectoryPoint & point)
+{
+  return point.pose.position;
+}
+
+template <class T>
+std::vector<double> calcInputArcLength(const T & points)
+{
+  std::vector<double> input_arclength(points.size());
+  input_arclength.front() = 0.0;
+  for (size_t i = 1; i < points.size(); ++i) {
+    const auto & prev_pt = autoware_utils_geometry::get_point(points.at(i - 1));
+    const auto & curr_pt = autoware_utils_geometry::get_point(points.at(i));
+    const double ds = autoware_utils_geometry::calc_distance2d(prev_pt, curr_pt);
+    input_arclength.at(i) = ds + input_arclength.at(i - 1);
+  }
+  return input_arclength;
+}
+
+// The segment of the input points and the ratio in the segment are computed once for each
+// resampled point, and all the channels of the points are interpolated with them in one pass.
+class ArcLengthResampler
+{
+public:
+  ArcLengthResampler(
+    std::vector<double> input_arclength, const std::vector<double> & resampled_arclength)
+  : input_arclength_(std::move(input_arclength)),
+    resampled_arclength_front_(resampled_arclength.front())
+  {
+    // throw exceptions for invalid arguments
+    const auto validated_arclength =
+      autoware::interpolation::validateKeys(input_arclength_, resampled_arclength);
+
+    ratios_.resize(resampled_arclength.size());
+    spline_query_.indices.resize(resampled_arclength.size());
+    spline_query_.offsets.resize(resampled_arclength.size());
+
+    size_t segment_idx = 0;
+    for (size_t i = 0; i < resampled_arclength.size(); ++i) {
+      const double s = validated_arclength.at(i);
+      while (input_arclength_.at(segment_idx + 1) < s) {
+        ++segment_idx;
+      }
+
+      const double segment_start = input_arclength_.at(segment_idx);
+      ratios_.at(i) = (s - segment_start) / (input_arclength_.at(segment_idx + 1) - segment_start);
+      // the spline is evaluated at the arc length before it is cropped to the input points
+      spline_query_.indices.at(i) = static_cast<Eigen::Index>(segment_idx);
+      spline_query_.offsets.at(i) = resampled_arclength.at(i) - segment_start;
+    }
+  }
+
+  const std::vector<double> & getInputArcLength() const { return input_arclength_; }
+
+  size_t size() const { return ratios_.size(); }
+
+  size_t getSegmentIndex(const size_t i) const
+  {
+    return static_cast<size_t>(spline_query_.indices.at(i));
+  }
+
+  // get_value(idx) returns the value of the channel at the idx-th input point
+  template <class GetValue>
+  double lerp(const size_t i, const GetValue & get_value) const
+  {
+    const size_t segment_idx = getSegmentIndex(i);
+    return autoware::interpolation::lerp(
+      get_value(segment_idx), get_value(segment_idx + 1), ratios_.at(i));
+  }
+
+  template <class T, class U>
+  void interpolatePoints(
+    const T & input_points, U & output_points, const bool use_akima_spline_for_xy,
+    const bool use_lerp_for_z) const
+  {
+    // the channels interpolated by spline are evaluated at once with the shared query
+    std::vector<double> spline_x;
+    std::vector<double> spline_y;
+    std::vector<double> spline_z;
+    if (!use_akima_spline_for_xy || !use_lerp_for_z) {
+      std::vector<std::vector<double>> xy(2, std::vector<double>(input_points.size()));
+      std::vector<double> z(input_points.size());
+      for (size_t i = 0; i < input_points.size(); ++i) {
+        const auto & point = autoware_utils_geometry::get_point(input_points.at(i));
+        xy.at(0).at(i) = point.x;
+        xy.at(1).at(i) = point.y;
+        z.at(i) = point.z;
+      }
+
+      if (!use_akima_spline_for_xy) {
+        const auto splines = autoware::interpolation::SplineInterpolation::createSplines(
+          input_arclength_, xy, autoware::interpolation::SplineType::AKIMA);
+        spline_x = splines.at(0).getSplineInterpolatedValues(spline_query_);
+        spline_y = splines.at(1).getSplineInterpolatedValues(spline_query_);
+      }
+      if (!use_lerp_for_z) {
+        spline_z = autoware::interpolation::SplineInterpolation(input_arclength_, z)
+                     .getSplineInterpolatedValues(spline_query_);
+      }
+    }
+
+    output_points.resize(size());
+    for (size_t i = 0; i < size(); ++i) {
+      const size_t segment_idx = getSegmentIndex(i);
+      const auto & src_point = autoware_utils_geometry::get_point(input_points.at(segment_idx));
+      const auto & dst_point = autoware_utils_geometry::get_point(input_points.at(segment_idx + 1));
+      const auto interpolate = [&](const double src_val, const double dst_val) {
+        return autoware::interpolation::lerp(src_val, dst_val, ratios_.at(i));
+      };
+
+      auto & point = getMutablePoint(output_points.at(i));
+      point.x = use_akima_spline_for_xy ? interpolate(src_point.x, dst_point.x) : spline_x.at(i);
+      point.y = use_akima_spline_for_xy ? interpolate(src_point.y, dst_point.y) : spline_y.at(i);
+      point.z = use_lerp_for_z ? interpolate(src_point.z, dst_point.z) : spline_z.at(i);
+    }
+  }
+
+  template <class T, class U>
+  void interpolatePoses(
+    const T & input_points, U & output_points, const bool use_akima_spline_for_xy,
+    const bool use_lerp_for_z) const
+  {
+    interpolatePoints(input_points, output_points, use_akima_spline_for_xy, use_lerp_for_z);
+
+    const bool is_driving_forward = autoware_utils_geometry::is_driving_forward(
+      autoware_utils_geometry::get_pose(input_points.at(0)),
+      autoware_utils_geometry::get_pose(input_points.at(1)));
+    autoware::motion_utils::insertOrientation(output_points, is_driving_forward);
+
+    // Initial orientation is depend on the initial value of the resampled_arclength
+    // when backward driving
+    if (!is_driving_forward && resampled_arclength_front_ < 1e-3) {
+      autoware_utils_geometry::set_orientation(
+        autoware_utils_geometry::get_pose(input_points.at(0)).orientation, output_points.at(0));
+    }
+  }
+
+private:
+  std::vector<double> input_arclength_;
+  double resampled_arclength_front_;
+  std::vector<double> ratios_;
+  autoware::interpolation::SplineInterpolation::Query spline_query_;
+};
+}  // namespace
+
 std::vector<geometry_msgs::msg::Point> resamplePointVector(
   const std::vector<geometry_msgs::msg::Point> & points,
   const std::vector<double> & resampled_arclength, const bool use_akima_spline_for_xy,
@@ -39,56 +204,10 @@ std::vector<geometry_msgs::msg::Point> resamplePointVector(
     return points;
   }
 
-  // Input Path Information
-  std::vector<double> input_arclength;
-  std::vector<double> x;
-  std::vector<double> y;
-  std::vector<double> z;
-  input_arclength.reserve(points.size());
-  x.reserve(points.size());
-  y.reserve(points.size());
-  z.reserve(points.size());
-
-  input_arclength.push_back(0.0);
-  x.push_back(points.front().x);
-  y.push_back(points.front().y);
-  z.push_back(points.front().z);
-  for (size_t i = 1; i < points.size(); ++i) {
-    const auto & prev_pt = points.at(i - 1);
-    const auto & curr_pt = points.at(i);
-    const double ds = autoware_utils_geometry::calc_distance2d(prev_pt, curr_pt);
-    input_arclength.push_back(ds + input_arclength.back());
-    x.push_back(curr_pt.x);
-    y.push_back(curr_pt.y);
-    z.push_back(curr_pt.z);
-  }
-
-  // Interpolate
-  const auto lerp = [&](const auto & input) {
-    return autoware::interpolation::lerp(input_arclength, input, resampled_arclength);
-  };
-  const auto spline = [&](const auto & input) {
-    return autoware::interpolation::spline(input_arclength, input, resampled_arclength);
-  };
-  const auto spline_by_akima = [&](const auto & input) {
-    return autoware::interpolation::splineByAkima(input_arclength, input, resampled_arclength);
-  };
-
-  const auto interpolated_x = use_akima_spline_for_xy ? lerp(x) : spline_by_akima(x);
-  const auto interpolated_y = use_akima_spline_for_xy ? lerp(y) : spline_by_akima(y);
-  const auto interpolated_z = use_lerp_for_z ? lerp(z) : spline(z);
+  const ArcLengthResampler resampler(calcInputArcLength(points), resampled_arclength);
 
   std::vector<geometry_msgs::msg::Point> resampled_points;
-  resampled_points.resize(interpolated_x.size());
-
-  // Insert Position
-  for (size_t i = 0; i < resampled_points.size(); ++i) {
-    geometry_msgs::msg::Point point;
-    point.x = interpolated_x.at(i);
-    point.y = interpolated_y.at(i);
-    point.z = interpolated_z.at(i);
-    resampled_points.at(i) = point;
-  }
+  resampler.interpolatePoints(points, resampled_points, use_akima_spline_for_xy, use_lerp_for_z);
 
   return resampled_points;
 }
@@ -131,33 +250,10 @@ std::vector<geometry_msgs::msg::Pose> resamplePoseVector(
     return points_raw;
   }
 
-  std::vector<geometry_msgs::msg::Point> position(points.size());
-  for (size_t i = 0; i < points.size(); ++i) {
-    position.at(i) = points.at(i).position;
-  }
-  const auto resampled_position =
-    resamplePointVector(position, resampled_arclength, use_akima_spline_for_xy, use_lerp_for_z);
-
-  std::vector<geometry_msgs::msg::Pose> resampled_points(resampled_position.size());
+  const ArcLengthResampler resampler(calcInputArcLength(points), resampled_arclength);
 
-  // Insert Position
-  for (size_t i = 0; i < resampled_position.size(); ++i) {
-    geometry_msgs::msg::Pose pose;
-    pose.position.x = resampled_position.at(i).x;
-    pose.position.y = resampled_position.at(i).y;
-    pose.position.z = resampled_position.at(i).z;
-    resampled_points.at(i) = pose;
-  }
-
-  const bool is_driving_forward =
-    autoware_utils_geometry::is_driving_forward(points.at(0), points.at(1));
-  autoware::motion_utils::insertOrientation(resampled_points, is_driving_forward);
-
-  // Initial orientation is depend on the initial value of the resampled_arclength
-  // when backward driving
-  if (!is_driving_forward && resampled_arclength.front() < 1e-3) {
-    resampled_points.at(0).orientation = points.at(0).orientation;
-  }
+  std::vector<geometry_msgs::msg::Pose> resampled_points;
+  resampler.interpolatePoses(points, resampled_points, use_akima_spline_for_xy, use_lerp_for_z);
 
   return resampled_points;
 }
@@ -239,43 +335,8 @@ autoware_internal_planning_msgs::msg::PathWithLaneId resamplePath(
   // resampled[4~5] = base[1]
   // resampled[6] = base[2]
 
-  // Input Path Information
-  std::vector<double> input_arclength;
-  std::vector<geometry_msgs::msg::Pose> input_pose;
-  std::vector<double> v_lon;
-  std::vector<double> v_lat;
-  std::vector<double> heading_rate;
-  std::vector<bool> is_final;
-  std::vector<std::vector<int64_t>> lane_ids;
-  input_arclength.reserve(input_path.points.size());
-  input_pose.reserve(input_path.points.size());
-  v_lon.reserve(input_path.points.size());
-  v_lat.reserve(input_path.points.size());
-  heading_rate.reserve(input_path.points.size());
-  is_final.reserve(input_path.points.size());
-  lane_ids.reserve(input_path.points.size());
-
-  input_arclength.push_back(0.0);
-  input_pose.push_back(input_path.points.front().point.pose);
-  v_lon.push_back(input_path.points.front().point.longitudinal_velocity_mps);
-  v_lat.push_back(input_path.points.front().point.lateral_velocity_mps);
-  heading_rate.push_back(input_path.points.front().point.heading_rate_rps);
-  is_final.push_back(input_path.points.front().point.is_final);
-  lane_ids.push_back(input_path.points.front().lane_ids);
-  for (size_t i = 1; i < input_path.points.size(); ++i) {
-    const auto & prev_pt = input_path.points.at(i - 1).point;
-    const auto & curr_pt = input_path.points.at(i).point;
-    const double ds =
-      autoware_utils_geometry::calc_distance2d(prev_pt.pose.position, curr_pt.pose.position);
-    input_arclength.push_back(ds + input_arclength.back());
-    input_pose.push_back(curr_pt.pose);
-    v_lon.push_back(curr_pt.longitudinal_velocity_mps);
-    v_lat.push_back(curr_pt.lateral_velocity_mps);
-    heading_rate.push_back(curr_pt.heading_rate_rps);
-    is_final.push_back(curr_pt.is_final);
-    lane_ids.push_back(input_path.points.at(i).lane_ids);
-  }
-
+  const auto & input_points = input_path.points;
+  const auto input_arclength = calcInputArcLength(input_points);
   if (input_arclength.back() < resampling_arclength.back()) {
     std::cerr << "[autoware_motion_utils]: resampled path length is longer than input path length"
               << std::endl;
@@ -283,80 +344,67 @@ autoware_internal_planning_msgs::msg::PathWithLaneId resamplePath(
   }
 
   // Interpolate
-  const auto lerp = [&](const auto & input) {
-    return autoware::interpolation::lerp(input_arclength, input, resampling_arclength);
-  };
-
-  auto closest_segment_indices =
+  const ArcLengthResampler resampler(input_arclength, resampling_arclength);
+  const auto closest_segment_indices =
     autoware::interpolation::calc_closest_segment_indices(input_arclength, resampling_arclength);
 
-  const auto zoh = [&](const auto & input) {
-    return autoware::interpolation::zero_order_hold(
-      input_arclength, input, closest_segment_indices);
-  };
+  autoware_internal_planning_msgs::msg::PathWithLaneId resampled_path;
+  resampled_path.header = input_path.header;
+  resampled_path.left_bound = input_path.left_bound;
+  resampled_path.right_bound = input_path.right_bound;
+  resampler.interpolatePoses(
+    input_points, resampled_path.points, use_akima_spline_for_xy, use_lerp_for_z);
 
-  const auto interpolated_pose =
-    resamplePoseVector(input_pose, resampling_arclength, use_akima_spline_for_xy, use_lerp_for_z);
-  const auto interpolated_v_lon = use_zero_order_hold_for_v ? zoh(v_lon) : lerp(v_lon);
-  const auto interpolated_v_lat = use_zero_order_hold_for_v ? zoh(v_lat) : lerp(v_lat);
-  const auto interpolated_heading_rate = lerp(heading_rate);
-  const auto interpolated_is_final = zoh(is_final);
+  const auto v_lon = [&](const size_t idx) {
+    return input_points.at(idx).point.longitudinal_velocity_mps;
+  };
+  const auto v_lat = [&](const size_t idx) {
+    return input_points.at(idx).point.lateral_velocity_mps;
+  };
+  const auto heading_rate = [&](const size_t idx) {
+    return input_points.at(idx).point.heading_rate_rps;
+  };
 
-  // interpolate lane_ids
-  std::vector<std::vector<int64_t>> interpolated_lane_ids;
-  interpolated_lane_ids.resize(resampling_arclength.size());
   constexpr double epsilon = 1e-6;
-  for (size_t i = 0; i < resampling_arclength.size(); ++i) {
-    const size_t seg_idx = std::min(closest_segment_indices.at(i), input_path.points.size() - 2);
-    const auto & prev_lane_ids = input_path.points.at(seg_idx).lane_ids;
-    const auto & next_lane_ids = input_path.points.at(seg_idx + 1).lane_ids;
+  for (size_t i = 0; i < resampled_path.points.size(); ++i) {
+    const size_t closest_idx = closest_segment_indices.at(i);
+    const auto zoh = [&](const auto & get_value) { return get_value(closest_idx); };
+    const auto lerp = [&](const auto & get_value) { return resampler.lerp(i, get_value); };
+
+    auto & path_point = resampled_path.points.at(i).point;
+    path_point.longitudinal_velocity_mps = use_zero_order_hold_for_v ? zoh(v_lon) : lerp(v_lon);
+    path_point.lateral_velocity_mps = use_zero_order_hold_for_v ? zoh(v_lat) : lerp(v_lat);
+    path_point.heading_rate_rps = lerp(heading_rate);
+    path_point.is_final = input_points.at(closest_idx).point.is_final;
+
+    // interpolate lane_ids
+    auto & lane_ids = resampled_path.points.at(i).lane_ids;
+    lane_ids.clear();
+    const size_t seg_idx = std::min(closest_idx, input_points.size() - 2);
+    const auto & prev_lane_ids = input_points.at(seg_idx).lane_ids;
+    const auto & next_lane_ids = input_points.at(seg_idx + 1).lane_ids;
 
     if (std::abs(input_arclength.at(seg_idx) - resampling_arclength.at(i)) <= epsilon) {
-      interpolated_lane_ids.at(i).insert(
-        interpolated_lane_ids.at(i).end(), prev_lane_ids.begin(), prev_lane_ids.end());
-    } else if (std::abs(input_arclength.at(seg_idx + 1) - resampling_arclength.at(i)) <= epsilon) {
-      interpolated_lane_ids.at(i).insert(
-        interpolated_lane_ids.at(i).end(), next_lane_ids.begin(), next_lane_ids.end());
+      lane_ids.insert(lane_ids.end(), prev_lane_ids.begin(), prev_lane_ids.end());
+    } else if (
+      std::abs(input_arclength.at(seg_idx + 1) - resampling_arclength.at(i)) <= epsilon) {
+      lane_ids.insert(lane_ids.end(), next_lane_ids.begin(), next_lane_ids.end());
     } else {
       // extract lane_ids those prev_lane_ids and next_lane_ids have in common
       for (const auto target_lane_id : prev_lane_ids) {
         if (
           std::find(next_lane_ids.begin(), next_lane_ids.end(), target_lane_id) !=
           next_lane_ids.end()) {
-          interpolated_lane_ids.at(i).push_back(target_lane_id);
+          lane_ids.push_back(target_lane_id);
         }
       }
       // If there are no common lane_ids, the prev_lane_ids is assigned.
-      if (interpolated_lane_ids.at(i).empty()) {
-        interpolated_lane_ids.at(i).insert(
-          interpolated_lane_ids.at(i).end(), prev_lane_ids.begin(), prev_lane_ids.end());
+      if (lane_ids.empty()) {
+        lane_ids.insert(lane_ids.end(), prev_lane_ids.begin(), prev_lane_ids.end());
       }
     }
   }
 
-  if (interpolated_pose.size() != resampling_arclength.size()) {
-    std::cerr
-      << "[autoware_motion_utils]: Resampled pose size is different from resampled arclength"
-      << std::endl;
-    return input_path;
-  }
-
-  autoware_internal_planning_msgs::msg::PathWithLaneId resampled_path;
-  resampled_path.header = input_path.header;
-  resampled_path.left_bound = input_path.left_bound;
-  resampled_path.right_bound = input_path.right_bound;
-  resampled_path.points.resize(interpolated_pose.size());
-  for (size_t i = 0; i < resampled_path.points.size(); ++i) {
-    autoware_planning_msgs::msg::PathPoint path_point;
-    path_point.pose = interpolated_pose.at(i);
-    path_point.longitudinal_velocity_mps = interpolated_v_lon.at(i);
-    path_point.lateral_velocity_mps = interpolated_v_lat.at(i);
-    path_point.heading_rate_rps = interpolated_heading_rate.at(i);
-    path_point.is_final = interpolated_is_final.at(i);
-    resampled_path.points.at(i).point = path_point;
-    resampled_path.points.at(i).lane_ids = interpolated_lane_ids.at(i);
-  }
-
   return resampled_path;
 }
 
@@ -436,75 +484,39 @@ autoware_planning_msgs::msg::Path resamplePath(
     return input_path;
   }
 
-  // Input Path Information
-  std::vector<double> input_arclength;
-  std::vector<geometry_msgs::msg::Pose> input_pose;
-  std::vector<double> v_lon;
-  std::vector<double> v_lat;
-  std::vector<double> heading_rate;
-  input_arclength.reserve(input_path.points.size());
-  input_pose.reserve(input_path.points.size());
-  v_lon.reserve(input_path.points.size());
-  v_lat.reserve(input_path.points.size());
-  heading_rate.reserve(input_path.points.size());
-
-  input_arclength.push_back(0.0);
-  input_pose.push_back(input_path.points.front().pose);
-  v_lon.push_back(input_path.points.front().longitudinal_velocity_mps);
-  v_lat.push_back(input_path.points.front().lateral_velocity_mps);
-  heading_rate.push_back(input_path.points.front().heading_rate_rps);
-  for (size_t i = 1; i < input_path.points.size(); ++i) {
-    const auto & prev_pt = input_path.points.at(i - 1);
-    const auto & curr_pt = input_path.points.at(i);
-    const double ds =
-      autoware_utils_geometry::calc_distance2d(prev_pt.pose.position, curr_pt.pose.position);
-    input_arclength.push_back(ds + input_arclength.back());
-    input_pose.push_back(curr_pt.pose);
-    v_lon.push_back(curr_pt.longitudinal_velocity_mps);
-    v_lat.push_back(curr_pt.lateral_velocity_mps);
-    heading_rate.push_back(curr_pt.heading_rate_rps);
-  }
+  const auto & input_points = input_path.points;
+  const ArcLengthResampler resampler(calcInputArcLength(input_points), resampled_arclength);
 
   // Interpolate
-  const auto lerp = [&](const auto & input) {
-    return autoware::interpolation::lerp(input_arclength, input, resampled_arclength);
-  };
-
   std::vector<size_t> closest_segment_indices;
   if (use_zero_order_hold_for_v) {
-    closest_segment_indices =
-      autoware::interpolation::calc_closest_segment_indices(input_arclength, resampled_arclength);
-  }
-  const auto zoh = [&](const auto & input) {
-    return autoware::interpolation::zero_order_hold(
-      input_arclength, input, closest_segment_indices);
-  };
-
-  const auto interpolated_pose =
-    resamplePoseVector(input_pose, resampled_arclength, use_akima_spline_for_xy, use_lerp_for_z);
-  const auto interpolated_v_lon = use_zero_order_hold_for_v ? zoh(v_lon) : lerp(v_lon);
-  const auto interpolated_v_lat = use_zero_order_hold_for_v ? zoh(v_lat) : lerp(v_lat);
-  const auto interpolated_heading_rate = lerp(heading_rate);
-
-  if (interpolated_pose.size() != resampled_arclength.size()) {
-    std::cerr
-      << "[autoware_motion_utils]: Resampled pose size is different from resampled arclength"
-      << std::endl;
-    return input_path;
+    closest_segment_indices = autoware::interpolation::calc_closest_segment_indices(
+      resampler.getInputArcLength(), resampled_arclength);
   }
 
   autoware_planning_msgs::msg::Path resampled_path;
   resampled_path.header = input_path.header;
   resampled_path.left_bound = input_path.left_bound;
   resampled_path.right_bound = input_path.right_bound;
-  resampled_path.points.resize(interpolated_pose.size());
+  resampler.interpolatePoses(
+    input_points, resampled_path.points, use_akima_spline_for_xy, use_lerp_for_z);
+
+  const auto v_lon = [&](const size_t idx) {
+    return input_points.at(idx).longitudinal_velocity_mps;
+  };
+  const auto v_lat = [&](const size_t idx) { return input_points.at(idx).lateral_velocity_mps; };
+  const auto heading_rate = [&](const size_t idx) { return input_points.at(idx).heading_rate_rps; };
+
   for (size_t i = 0; i < resampled_path.points.size(); ++i) {
-    autoware_planning_msgs::msg::PathPoint path_point;
-    path_point.pose = interpolated_pose.at(i);
-    path_point.longitudinal_velocity_mps = interpolated_v_lon.at(i);
-    path_point.lateral_velocity_mps = interpolated_v_lat.at(i);
-    path_point.heading_rate_rps = interpolated_heading_rate.at(i);
-    resampled_path.points.at(i) = path_point;
+    const auto zoh = [&](const auto & get_value) {
+      return get_value(closest_segment_indices.at(i));
+    };
+    const auto lerp = [&](const auto & get_value) { return resampler.lerp(i, get_value); };
+
+    auto & path_point = resampled_path.points.at(i);
+    path_point.longitudinal_velocity_mps = use_zero_order_hold_for_v ? zoh(v_lon) : lerp(v_lon);
+    path_point.lateral_velocity_mps = use_zero_order_hold_for_v ? zoh(v_lat) : lerp(v_lat);
+    path_point.heading_rate_rps = lerp(heading_rate);
   }
 
   return resampled_path;
@@ -569,126 +581,95 @@ autoware_planning_msgs::msg::Path resamplePath(
     use_zero_order_hold_for_twist);
 }
 
-autoware_planning_msgs::msg::Trajectory resampleTrajectory(
-  const autoware_planning_msgs::msg::Trajectory & input_trajectory,
-  const std::vector<double> & resampled_arclength, const bool use_akima_spline_for_xy,
-  const bool use_lerp_for_z, const bool use_zero_order_hold_for_twist)
+void resampleTrajectory(
+  const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & input_points,
+  const std::vector<double> & resampled_arclength,
+  std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & output_points,
+  const bool use_akima_spline_for_xy, const bool use_lerp_for_z,
+  const bool use_zero_order_hold_for_twist)
 {
   // validate arguments
-  if (!resample_utils::validate_arguments(input_trajectory.points, resampled_arclength)) {
-    return input_trajectory;
+  if (!resample_utils::validate_arguments(input_points, resampled_arclength)) {
+    output_points = input_points;
+    return;
   }
 
-  // Input Trajectory Information
-  std::vector<double> input_arclength;
-  std::vector<geometry_msgs::msg::Pose> input_pose;
-  std::vector<double> v_lon;
-  std::vector<double> v_lat;
-  std::vector<double> heading_rate;
-  std::vector<double> acceleration;
-  std::vector<double> front_wheel_angle;
-  std::vector<double> rear_wheel_angle;
-  std::vector<double> time_from_start;
-  input_arclength.reserve(input_trajectory.points.size());
-  input_pose.reserve(input_trajectory.points.size());
-  v_lon.reserve(input_trajectory.points.size());
-  v_lat.reserve(input_trajectory.points.size());
-  heading_rate.reserve(input_trajectory.points.size());
-  acceleration.reserve(input_trajectory.points.size());
-  front_wheel_angle.reserve(input_trajectory.points.size());
-  rear_wheel_angle.reserve(input_trajectory.points.size());
-  time_from_start.reserve(input_trajectory.points.size());
-
-  input_arclength.push_back(0.0);
-  input_pose.push_back(input_trajectory.points.front().pose);
-  v_lon.push_back(input_trajectory.points.front().longitudinal_velocity_mps);
-  v_lat.push_back(input_trajectory.points.front().lateral_velocity_mps);
-  heading_rate.push_back(input_trajectory.points.front().heading_rate_rps);
-  acceleration.push_back(input_trajectory.points.front().acceleration_mps2);
-  front_wheel_angle.push_back(input_trajectory.points.front().front_wheel_angle_rad);
-  rear_wheel_angle.push_back(input_trajectory.points.front().rear_wheel_angle_rad);
-  time_from_start.push_back(
-    rclcpp::Duration(input_trajectory.points.front().time_from_start).seconds());
-
-  for (size_t i = 1; i < input_trajectory.points.size(); ++i) {
-    const auto & prev_pt = input_trajectory.points.at(i - 1);
-    const auto & curr_pt = input_trajectory.points.at(i);
-    const double ds =
-      autoware_utils_geometry::calc_distance2d(prev_pt.pose.position, curr_pt.pose.position);
-
-    input_arclength.push_back(ds + input_arclength.back());
-    input_pose.push_back(curr_pt.pose);
-    v_lon.push_back(curr_pt.longitudinal_velocity_mps);
-    v_lat.push_back(curr_pt.lateral_velocity_mps);
-    heading_rate.push_back(curr_pt.heading_rate_rps);
-    acceleration.push_back(curr_pt.acceleration_mps2);
-    front_wheel_angle.push_back(curr_pt.front_wheel_angle_rad);
-    rear_wheel_angle.push_back(curr_pt.rear_wheel_angle_rad);
-    time_from_start.push_back(rclcpp::Duration(curr_pt.time_from_start).seconds());
+  // the output is written while the input is read
+  if (&input_points == &output_points) {
+    const auto input_points_copy = input_points;
+    resampleTrajectory(
+      input_points_copy, resampled_arclength, output_points, use_akima_spline_for_xy,
+      use_lerp_for_z, use_zero_order_hold_for_twist);
+    return;
   }
 
+  const ArcLengthResampler resampler(calcInputArcLength(input_points), resampled_arclength);
+
   // Set Zero Velocity After Stop Point
   // If the longitudinal velocity is zero, set the velocity to zero after that point.
-  bool stop_point_found_in_v_lon = false;
   constexpr double epsilon = 1e-4;
-  for (size_t i = 0; i < v_lon.size(); ++i) {
-    if (std::abs(v_lon.at(i)) < epsilon) {
-      stop_point_found_in_v_lon = true;
-    }
-    if (stop_point_found_in_v_lon) {
-      v_lon.at(i) = 0.0;
-    }
-  }
+  const auto stop_point_itr =
+    std::find_if(input_points.begin(), input_points.end(), [&](const auto & point) {
+      return std::abs(point.longitudinal_velocity_mps) < epsilon;
+    });
+  const auto stop_idx = static_cast<size_t>(std::distance(input_points.begin(), stop_point_itr));
 
   // Interpolate
-  const auto lerp = [&](const auto & input) {
-    return autoware::interpolation::lerp(input_arclength, input, resampled_arclength);
-  };
-
   std::vector<size_t> closest_segment_indices;
   if (use_zero_order_hold_for_twist) {
-    closest_segment_indices =
-      autoware::interpolation::calc_closest_segment_indices(input_arclength, resampled_arclength);
+    closest_segment_indices = autoware::interpolation::calc_closest_segment_indices(
+      resampler.getInputArcLength(), resampled_arclength);
   }
-  const auto zoh = [&](const auto & input) {
-    return autoware::interpolation::zero_order_hold(
-      input_arclength, input, closest_segment_indices);
+
+  resampler.interpolatePoses(input_points, output_points, use_akima_spline_for_xy, use_lerp_for_z);
+
+  const auto v_lon = [&](const size_t idx) {
+    return idx < stop_idx ? input_points.at(idx).longitudinal_velocity_mps : 0.0;
+  };
+  const auto v_lat = [&](const size_t idx) { return input_points.at(idx).lateral_velocity_mps; };
+  const auto heading_rate = [&](const size_t idx) { return input_points.at(idx).heading_rate_rps; };
+  const auto acceleration = [&](const size_t idx) {
+    return input_points.at(idx).acceleration_mps2;
+  };
+  const auto front_wheel_angle = [&](const size_t idx) {
+    return input_points.at(idx).front_wheel_angle_rad;
+  };
+  const auto rear_wheel_angle = [&](const size_t idx) {
+    return input_points.at(idx).rear_wheel_angle_rad;
+  };
+  const auto time_from_start = [&](const size_t idx) {
+    return rclcpp::Duration(input_points.at(idx).time_from_start).seconds();
   };
 
-  const auto interpolated_pose =
-    resamplePoseVector(input_pose, resampled_arclength, use_akima_spline_for_xy, use_lerp_for_z);
-  const auto interpolated_v_lon = use_zero_order_hold_for_twist ? zoh(v_lon) : lerp(v_lon);
-  const auto interpolated_v_lat = use_zero_order_hold_for_twist ? zoh(v_lat) : lerp(v_lat);
-  const auto interpolated_heading_rate = lerp(heading_rate);
-  const auto interpolated_acceleration =
-    use_zero_order_hold_for_twist ? zoh(acceleration) : lerp(acceleration);
-  const auto interpolated_front_wheel_angle = lerp(front_wheel_angle);
-  const auto interpolated_rear_wheel_angle = lerp(rear_wheel_angle);
-  const auto interpolated_time_from_start = lerp(time_from_start);
-
-  if (interpolated_pose.size() != resampled_arclength.size()) {
-    std::cerr
-      << "[autoware_motion_utils]: Resampled pose size is different from resampled arclength"
-      << std::endl;
-    return input_trajectory;
+  for (size_t i = 0; i < output_points.size(); ++i) {
+    const auto zoh = [&](const auto & get_value) {
+      return get_value(closest_segment_indices.at(i));
+    };
+    const auto lerp = [&](const auto & get_value) { return resampler.lerp(i, get_value); };
+
+    auto & traj_point = output_points.at(i);
+    traj_point.longitudinal_velocity_mps =
+      use_zero_order_hold_for_twist ? zoh(v_lon) : lerp(v_lon);
+    traj_point.lateral_velocity_mps = use_zero_order_hold_for_twist ? zoh(v_lat) : lerp(v_lat);
+    traj_point.heading_rate_rps = lerp(heading_rate);
+    traj_point.acceleration_mps2 =
+      use_zero_order_hold_for_twist ? zoh(acceleration) : lerp(acceleration);
+    traj_point.front_wheel_angle_rad = lerp(front_wheel_angle);
+    traj_point.rear_wheel_angle_rad = lerp(rear_wheel_angle);
+    traj_point.time_from_start = rclcpp::Duration::from_seconds(lerp(time_from_start));
   }
+}
 
+autoware_planning_msgs::msg::Trajectory resampleTrajectory(
+  const autoware_planning_msgs::msg::Trajectory & input_trajectory,
+  const std::vector<double> & resampled_arclength, const bool use_akima_spline_for_xy,
+  const bool use_lerp_for_z, const bool use_zero_order_hold_for_twist)
+{
   autoware_planning_msgs::msg::Trajectory resampled_trajectory;
   resampled_trajectory.header = input_trajectory.header;
-  resampled_trajectory.points.resize(interpolated_pose.size());
-  for (size_t i = 0; i < resampled_trajectory.points.size(); ++i) {
-    autoware_planning_msgs::msg::TrajectoryPoint traj_point;
-    traj_point.pose = interpolated_pose.at(i);
-    traj_point.longitudinal_velocity_mps = interpolated_v_lon.at(i);
-    traj_point.lateral_velocity_mps = interpolated_v_lat.at(i);
-    traj_point.heading_rate_rps = interpolated_heading_rate.at(i);
-    traj_point.acceleration_mps2 = interpolated_acceleration.at(i);
-    traj_point.front_wheel_angle_rad = interpolated_front_wheel_angle.at(i);
-    traj_point.rear_wheel_angle_rad = interpolated_rear_wheel_angle.at(i);
-    traj_point.time_from_start = rclcpp::Duration::from_seconds(interpolated_time_from_start.at(i));
-    resampled_trajectory.points.at(i) = traj_point;
-  }
-
+  resampleTrajectory(
+    input_trajectory.points, resampled_arclength, resampled_trajectory.points,
+    use_akima_spline_for_xy, use_lerp_for_z, use_zero_order_hold_for_twist);
   return resampled_trajectory;
 }
 
@@ -3108,6 +3108,34 @@ TEST(resample_trajectory, resample_trajectory_by_vector_non_default)
   }
 }
 
+TEST(resample_trajectory, resample_trajectory_points_by_vector)
+{
+  using autoware::motion_utils::resampleTrajectory;
+
+  auto traj = generateTestTrajectory<Trajectory>(10, 1.0, 3.0, 1.0, 0.01, 0.5);
+  traj.points.back() = generateTestTrajectoryPoint(
+    9.0, 0.0, 0.0, autoware_utils_math::pi / 3.0, 3.0, 1.0, 0.01, 0.5);
+  const std::vector<double> resampled_arclength = {0.0, 0.7, 1.9, 3.3, 5.0, 8.2, 9.0};
+
+  // the output buffer is larger than the result and is overwritten
+  std::vector<TrajectoryPoint> resampled_points(20);
+  resampleTrajectory(traj.points, resampled_arclength, resampled_points);
+  const auto resampled_traj = resampleTrajectory(traj, resampled_arclength);
+  ASSERT_EQ(resampled_points.size(), resampled_traj.points.size());
+  for (size_t i = 0; i < resampled_points.size(); ++i) {
+    EXPECT_EQ(resampled_points.at(i), resampled_traj.points.at(i));
+  }
+
+  // the input is resampled in place
+  auto in_place_points = traj.points;
+  resampleTrajectory(in_place_points, resampled_arclength, in_place_points);
+  EXPECT_EQ(in_place_points, resampled_traj.points);
+
+  // invalid arclength: the input is copied
+  resampleTrajectory(traj.points, std::vector<double>{0.0}, resampled_points);
+  EXPECT_EQ(resampled_points, traj.points);
+}
+
 TEST(resample_trajectory, resample_trajectory_by_same_interval)
 {
   using autoware::motion_utils::resampleTrajectory;
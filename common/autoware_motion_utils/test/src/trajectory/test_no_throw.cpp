@@ -0,0 +1,162 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/motion_utils/trajectory/no_throw.hpp"
+
+#include "autoware/motion_utils/trajectory/trajectory.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+using autoware_planning_msgs::msg::TrajectoryPoint;
+using autoware_utils_geometry::create_point;
+using TrajectoryPointArray = std::vector<TrajectoryPoint>;
+
+constexpr double epsilon = 1e-6;
+
+TrajectoryPointArray generateTestTrajectory(
+  const size_t num_points, const double point_interval, const double delta_theta = 0.0)
+{
+  TrajectoryPointArray points;
+  for (size_t i = 0; i < num_points; ++i) {
+    const double theta = i * delta_theta;
+    TrajectoryPoint p;
+    p.pose.position = create_point(
+      i * point_interval * std::cos(theta), i * point_interval * std::sin(theta), 0.0);
+    p.pose.orientation = autoware_utils_geometry::create_quaternion_from_rpy(0.0, 0.0, theta);
+    points.push_back(p);
+  }
+  return points;
+}
+}  // namespace
+
+TEST(trajectory_no_throw, invalidArguments)
+{
+  using autoware::motion_utils::no_throw::calcArcLength;
+  using autoware::motion_utils::no_throw::calcLongitudinalOffsetToSegment;
+  using autoware::motion_utils::no_throw::calcSignedArcLength;
+  using autoware::motion_utils::no_throw::findNearestIndex;
+  using autoware::motion_utils::no_throw::findNearestSegmentIndex;
+  using autoware::motion_utils::no_throw::insertTargetPoint;
+
+  const auto p = create_point(1.0, 0.0, 0.0);
+
+  // Empty
+  TrajectoryPointArray empty;
+  EXPECT_FALSE(calcSignedArcLength(empty, 0, 0));
+  EXPECT_FALSE(calcSignedArcLength(empty, p, 0));
+  EXPECT_FALSE(calcSignedArcLength(empty, 0, p));
+  EXPECT_FALSE(calcSignedArcLength(empty, p, p));
+  EXPECT_FALSE(calcArcLength(empty));
+  EXPECT_FALSE(findNearestIndex(empty, p));
+  EXPECT_FALSE(findNearestSegmentIndex(empty, p));
+  EXPECT_FALSE(calcLongitudinalOffsetToSegment(empty, 0, p));
+  EXPECT_FALSE(insertTargetPoint(size_t{0}, p, empty));
+  EXPECT_FALSE(insertTargetPoint(1.0, p, empty));
+
+  // Out of range
+  const auto traj = generateTestTrajectory(10, 1.0);
+  EXPECT_FALSE(calcSignedArcLength(traj, 0, traj.size()));
+  EXPECT_FALSE(calcSignedArcLength(traj, traj.size(), 0));
+  EXPECT_FALSE(calcSignedArcLength(traj, p, traj.size()));
+  EXPECT_FALSE(calcSignedArcLength(traj, traj.size(), p));
+  EXPECT_FALSE(calcLongitudinalOffsetToSegment(traj, traj.size() - 1, p));
+
+  // Single point
+  const auto single = generateTestTrajectory(1, 1.0);
+  EXPECT_FALSE(findNearestSegmentIndex(single, p));
+  EXPECT_FALSE(calcSignedArcLength(single, p, 0));
+
+  // Overlapping points
+  auto overlap = generateTestTrajectory(3, 1.0);
+  overlap.at(1).pose.position = overlap.at(0).pose.position;
+  overlap.at(2).pose.position = overlap.at(0).pose.position;
+  EXPECT_FALSE(calcLongitudinalOffsetToSegment(overlap, 0, p));
+
+  // Sharp angle and too long length
+  auto insert_traj = traj;
+  EXPECT_FALSE(insertTargetPoint(size_t{0}, create_point(0.5, 5.0, 0.0), insert_traj));
+  EXPECT_FALSE(insertTargetPoint(-1.0, p, insert_traj));
+  EXPECT_FALSE(insertTargetPoint(10.0, p, insert_traj));
+  EXPECT_EQ(insert_traj.size(), traj.size());
+}
+
+TEST(trajectory_no_throw, consistentWithThrowingVersion)
+{
+  namespace mu = autoware::motion_utils;
+
+  const auto traj = generateTestTrajectory(20, 1.0, 0.05);
+  const std::vector<geometry_msgs::msg::Point> query_points{
+    create_point(-1.0, 0.1, 0.0), create_point(3.2, 0.4, 0.0), create_point(7.5, 2.0, 0.0),
+    create_point(12.3, 5.1, 0.0), create_point(30.0, 30.0, 0.0)};
+
+  EXPECT_NEAR(*mu::no_throw::calcArcLength(traj), mu::calcArcLength(traj), epsilon);
+  EXPECT_NEAR(
+    *mu::no_throw::calcSignedArcLength(traj, 15, 3), mu::calcSignedArcLength(traj, 15, 3),
+    epsilon);
+  EXPECT_NEAR(mu::unchecked::calcArcLength(traj), mu::calcArcLength(traj), epsilon);
+
+  for (const auto & p : query_points) {
+    EXPECT_EQ(*mu::no_throw::findNearestIndex(traj, p), mu::findNearestIndex(traj, p));
+    const auto nearest_seg_idx = mu::findNearestSegmentIndex(traj, p);
+    EXPECT_EQ(*mu::no_throw::findNearestSegmentIndex(traj, p), nearest_seg_idx);
+    EXPECT_EQ(mu::unchecked::findNearestSegmentIndex(traj, p), nearest_seg_idx);
+    EXPECT_NEAR(
+      *mu::no_throw::calcLongitudinalOffsetToSegment(traj, 5, p),
+      mu::calcLongitudinalOffsetToSegment(traj, 5, p), epsilon);
+    EXPECT_NEAR(
+      *mu::no_throw::calcSignedArcLength(traj, p, 10), mu::calcSignedArcLength(traj, p, 10),
+      epsilon);
+    EXPECT_NEAR(
+      *mu::no_throw::calcSignedArcLength(traj, 10, p), mu::calcSignedArcLength(traj, 10, p),
+      epsilon);
+    EXPECT_NEAR(
+      *mu::no_throw::calcSignedArcLength(traj, query_points.front(), p),
+      mu::calcSignedArcLength(traj, query_points.front(), p), epsilon);
+    EXPECT_NEAR(
+      mu::unchecked::calcSignedArcLength(traj, query_points.front(), p),
+      mu::calcSignedArcLength(traj, query_points.front(), p), epsilon);
+  }
+
+  // The overlapping points after the segment are skipped
+  auto overlap = traj;
+  overlap.at(6).pose.position = overlap.at(5).pose.position;
+  const auto p_target = create_point(5.5, 1.0, 0.0);
+  EXPECT_NEAR(
+    *mu::no_throw::calcLongitudinalOffsetToSegment(overlap, 5, p_target),
+    mu::calcLongitudinalOffsetToSegment(overlap, 5, p_target), epsilon);
+
+  // Insertion
+  for (const double length : {0.0, 3.5, 7.0, 12.25}) {
+    auto expected = traj;
+    auto result = traj;
+    const auto p_insert = mu::calcLongitudinalOffsetPoint(traj, 0, length);
+    const auto expected_idx = mu::insertTargetPoint(length, *p_insert, expected);
+    const auto result_idx = mu::no_throw::insertTargetPoint(length, *p_insert, result);
+    ASSERT_TRUE(expected_idx);
+    ASSERT_TRUE(result_idx);
+    EXPECT_EQ(*result_idx, *expected_idx);
+    ASSERT_EQ(result.size(), expected.size());
+    for (size_t i = 0; i < result.size(); ++i) {
+      EXPECT_NEAR(result.at(i).pose.position.x, expected.at(i).pose.position.x, epsilon);
+      EXPECT_NEAR(result.at(i).pose.position.y, expected.at(i).pose.position.y, epsilon);
+      EXPECT_NEAR(result.at(i).pose.orientation.z, expected.at(i).pose.orientation.z, epsilon);
+      EXPECT_NEAR(result.at(i).pose.orientation.w, expected.at(i).pose.orientation.w, epsilon);
+    }
+  }
+}
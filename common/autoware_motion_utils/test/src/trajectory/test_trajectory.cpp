@@ -23,6 +23,7 @@
 #include <gtest/internal/gtest-port.h>
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <vector>
 
@@ -2843,7 +2844,7 @@ TEST(trajectory, insertTargetPoint_Negative_Length_Without_Target_Point_Non_Zero
   const auto traj = generateTestTrajectory<Trajectory>(10, 1.0);
 
   // Insert
-  for (double x_start = -0.5; x_start < -5.0; x_start -= 1.0) {
+  for (double x_start = -0.5; x_start > -5.0; x_start -= 1.0) {
     auto traj_out = traj;
 
     const size_t start_idx = 7;
@@ -3017,6 +3018,73 @@ TEST(trajectory, insertTargetPoint_Negative_Length_Without_Target_Point_Non_Zero
   }
 }
 
+// the length is accumulated from the source segment, which must give the same point as the arc
+// length of each point from the source segment on a trajectory of irregular intervals
+TEST(trajectory, insertTargetPoint_Length_Irregular_Intervals)
+{
+  using autoware::motion_utils::insertTargetPoint;
+  using autoware_planning_msgs::msg::TrajectoryPoint;
+  using autoware_utils_geometry::calc_distance2d;
+  using autoware_utils_geometry::get_point;
+
+  TrajectoryPointArray traj;
+  double x = 0.0;
+  for (size_t i = 0; i < 30; ++i) {
+    TrajectoryPoint p;
+    p.pose = createPose(x, 3.0 * std::sin(0.2 * x), 0.0, 0.0, 0.0, 0.0);
+    traj.push_back(p);
+    x += 0.5 + 0.25 * static_cast<double>(i % 4);
+  }
+
+  std::vector<double> arc_lengths{0.0};
+  for (size_t i = 1; i < traj.size(); ++i) {
+    arc_lengths.push_back(arc_lengths.back() + calc_distance2d(traj.at(i - 1), traj.at(i)));
+  }
+
+  for (const size_t start_idx : {size_t{0}, size_t{1}, size_t{13}, traj.size() - 2}) {
+    const double min_length = -arc_lengths.at(start_idx);
+    const double max_length = arc_lengths.back() - arc_lengths.at(start_idx);
+    for (double length = -40.0; length < 40.0; length += 0.3) {
+      if (length < min_length + 1e-3 || max_length - 1e-3 < length) {
+        continue;
+      }
+
+      // expected point by the arc length from the front point
+      const double target_arc_length = arc_lengths.at(start_idx) + length;
+      const size_t segment_idx =
+        std::upper_bound(arc_lengths.begin(), arc_lengths.end(), target_arc_length) -
+        arc_lengths.begin() - 1;
+      const double ratio = (target_arc_length - arc_lengths.at(segment_idx)) /
+                           (arc_lengths.at(segment_idx + 1) - arc_lengths.at(segment_idx));
+      const auto & p_front = get_point(traj.at(segment_idx));
+      const auto & p_back = get_point(traj.at(segment_idx + 1));
+      const auto overlaps_front = calc_distance2d(p_front, p_back) * ratio < 1e-3;
+      const auto overlaps_back = calc_distance2d(p_front, p_back) * (1.0 - ratio) < 1e-3;
+
+      auto traj_out = traj;
+      const auto insert_idx = insertTargetPoint(start_idx, length, traj_out);
+      ASSERT_NE(insert_idx, std::nullopt) << "start_idx: " << start_idx << ", length: " << length;
+
+      if (overlaps_front || overlaps_back) {
+        EXPECT_EQ(traj_out.size(), traj.size());
+        EXPECT_EQ(insert_idx.value(), overlaps_front ? segment_idx : segment_idx + 1);
+        continue;
+      }
+      EXPECT_EQ(traj_out.size(), traj.size() + 1);
+      EXPECT_EQ(insert_idx.value(), segment_idx + 1);
+      const auto & p_insert = get_point(traj_out.at(insert_idx.value()));
+      EXPECT_NEAR(p_insert.x, p_front.x + ratio * (p_back.x - p_front.x), epsilon);
+      EXPECT_NEAR(p_insert.y, p_front.y + ratio * (p_back.y - p_front.y), epsilon);
+    }
+
+    // out of the trajectory in both directions
+    auto traj_out = traj;
+    EXPECT_EQ(insertTargetPoint(start_idx, max_length + 1e-3, traj_out), std::nullopt);
+    EXPECT_EQ(insertTargetPoint(start_idx, min_length - 1e-3, traj_out), std::nullopt);
+    EXPECT_EQ(traj_out.size(), traj.size());
+  }
+}
+
 TEST(trajectory, insertTargetPoint_Length_from_a_pose)
 {
   using autoware::motion_utils::calcArcLength;
@@ -0,0 +1,228 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/motion_utils/trajectory/trajectory.hpp"
+
+#include <autoware_utils_geometry/geometry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// These tests check the scaling of the trajectory queries by counting their accesses to the
+// points instead of measuring their time, so that an accidental quadratic implementation is caught
+// deterministically. The exponent is the slope of log(count) against log(number of points), which
+// is at most 1 for the linear queries and about 2 for the quadratic ones.
+
+namespace
+{
+using autoware_planning_msgs::msg::TrajectoryPoint;
+using autoware_utils_geometry::create_point;
+
+constexpr double max_linear_exponent = 1.2;
+
+/**
+ * @brief points which count the accesses to their elements. The queries are templates on the
+ * container, so they are instantiated with this type and access the points through it.
+ */
+class CountingPoints : public std::vector<TrajectoryPoint>
+{
+public:
+  using Base = std::vector<TrajectoryPoint>;
+  using Base::Base;
+
+  static inline size_t access_count = 0;
+
+  reference at(const size_type i)
+  {
+    ++access_count;
+    return Base::at(i);
+  }
+  const_reference at(const size_type i) const
+  {
+    ++access_count;
+    return Base::at(i);
+  }
+  reference operator[](const size_type i)
+  {
+    ++access_count;
+    return Base::operator[](i);
+  }
+  const_reference operator[](const size_type i) const
+  {
+    ++access_count;
+    return Base::operator[](i);
+  }
+  reference front()
+  {
+    ++access_count;
+    return Base::front();
+  }
+  const_reference front() const
+  {
+    ++access_count;
+    return Base::front();
+  }
+  reference back()
+  {
+    ++access_count;
+    return Base::back();
+  }
+  const_reference back() const
+  {
+    ++access_count;
+    return Base::back();
+  }
+};
+
+CountingPoints generateCurvedTrajectory(const size_t num_points)
+{
+  CountingPoints points;
+  points.reserve(num_points);
+  for (size_t i = 0; i < num_points; ++i) {
+    const double x = static_cast<double>(i);
+    const double y = 5.0 * std::sin(0.01 * x);
+    const double yaw = std::atan(0.05 * std::cos(0.01 * x));
+
+    TrajectoryPoint p;
+    p.pose.position = create_point(x, y, 0.0);
+    p.pose.orientation = autoware_utils_geometry::create_quaternion_from_yaw(yaw);
+    p.longitudinal_velocity_mps = 10.0;
+    points.push_back(p);
+  }
+  return points;
+}
+
+/**
+ * @brief fit log(count) = exponent * log(num_points) + c by the least squares
+ * @param func function called with the trajectory of each size
+ */
+template <class Func>
+double calcScalingExponent(Func && func)
+{
+  const std::vector<size_t> sizes = {10, 100, 1000, 10000};
+
+  const double n = static_cast<double>(sizes.size());
+  double sum_x = 0.0;
+  double sum_y = 0.0;
+  double sum_xx = 0.0;
+  double sum_xy = 0.0;
+  for (const auto size : sizes) {
+    const auto points = generateCurvedTrajectory(size);
+    CountingPoints::access_count = 0;
+    func(points);
+    const double x = std::log(static_cast<double>(size));
+    const double y = std::log(static_cast<double>(CountingPoints::access_count));
+    sum_x += x;
+    sum_y += y;
+    sum_xx += x * x;
+    sum_xy += x * y;
+  }
+  return (n * sum_xy - sum_x * sum_y) / (n * sum_xx - sum_x * sum_x);
+}
+}  // namespace
+
+// the check itself, a query repeated for every point is quadratic
+TEST(trajectory_complexity, quadraticLoopIsDetected)
+{
+  using autoware::motion_utils::calcSignedArcLength;
+
+  const auto exponent = calcScalingExponent([](const CountingPoints & points) {
+    for (size_t i = 0; i < points.size(); ++i) {
+      [[maybe_unused]] const double length = calcSignedArcLength(points, 0, i);
+    }
+  });
+  EXPECT_GT(exponent, 1.8);
+}
+
+TEST(trajectory_complexity, findNearestIndex)
+{
+  using autoware::motion_utils::findNearestIndex;
+
+  const auto exponent = calcScalingExponent([](const CountingPoints & points) {
+    const auto query = points.at(points.size() / 2).pose;
+    [[maybe_unused]] const auto idx = findNearestIndex(points, query.position);
+    [[maybe_unused]] const auto idx_with_constraints = findNearestIndex(points, query, 3.0, 1.0);
+  });
+  EXPECT_LT(exponent, max_linear_exponent);
+}
+
+TEST(trajectory_complexity, findFirstNearestSegmentIndexWithSoftConstraints)
+{
+  using autoware::motion_utils::findFirstNearestSegmentIndexWithSoftConstraints;
+
+  const auto exponent = calcScalingExponent([](const CountingPoints & points) {
+    const auto query = points.at(points.size() / 2).pose;
+    [[maybe_unused]] const auto seg_idx =
+      findFirstNearestSegmentIndexWithSoftConstraints(points, query, 3.0, 1.0);
+  });
+  EXPECT_LT(exponent, max_linear_exponent);
+}
+
+TEST(trajectory_complexity, calcSignedArcLength)
+{
+  using autoware::motion_utils::calcSignedArcLength;
+
+  const auto exponent = calcScalingExponent([](const CountingPoints & points) {
+    const auto src_point = create_point(1.5, 1.0, 0.0);
+    const auto dst_point = points.at(points.size() - 2).pose.position;
+    [[maybe_unused]] const auto length = calcSignedArcLength(points, 0, points.size() - 1);
+    [[maybe_unused]] const auto point_length = calcSignedArcLength(points, src_point, dst_point);
+  });
+  EXPECT_LT(exponent, max_linear_exponent);
+}
+
+TEST(trajectory_complexity, calcLateralOffset)
+{
+  using autoware::motion_utils::calcLateralOffset;
+
+  const auto exponent = calcScalingExponent([](const CountingPoints & points) {
+    auto query = points.at(points.size() / 2).pose.position;
+    query.y += 1.0;
+    [[maybe_unused]] const auto offset = calcLateralOffset(points, query);
+  });
+  EXPECT_LT(exponent, max_linear_exponent);
+}
+
+TEST(trajectory_complexity, insertStopPoint)
+{
+  using autoware::motion_utils::calcArcLength;
+  using autoware::motion_utils::insertStopPoint;
+  using autoware::motion_utils::insertTargetPoint;
+
+  const auto exponent = calcScalingExponent([](const CountingPoints & points) {
+    const double length = 0.9 * calcArcLength(points);
+    auto stop_points = points;
+    [[maybe_unused]] const auto stop_idx = insertStopPoint(length, stop_points);
+    auto target_points = points;
+    [[maybe_unused]] const auto forward_idx = insertTargetPoint(size_t{0}, length, target_points);
+    [[maybe_unused]] const auto backward_idx =
+      insertTargetPoint(target_points.size() - 2, -length, target_points);
+    [[maybe_unused]] const auto pose_stop_idx =
+      insertStopPoint(points.front().pose, length, target_points);
+  });
+  EXPECT_LT(exponent, max_linear_exponent);
+}
+
+TEST(trajectory_complexity, calcCurvature)
+{
+  using autoware::motion_utils::calcCurvature;
+
+  const auto exponent = calcScalingExponent([](const CountingPoints & points) {
+    [[maybe_unused]] const auto curvatures = calcCurvature(points);
+  });
+  EXPECT_LT(exponent, max_linear_exponent);
+}
@@ -0,0 +1,111 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__OBJECT_RECOGNITION_UTILS__CONVEX_POLYGON2D_HPP_
+#define AUTOWARE__OBJECT_RECOGNITION_UTILS__CONVEX_POLYGON2D_HPP_
+
+#include "autoware/object_recognition_utils/geometry.hpp"
+
+#include <autoware_utils_geometry/boost_geometry.hpp>
+#include <autoware_utils_geometry/boost_polygon_utils.hpp>
+
+#include <autoware_perception_msgs/msg/shape.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <array>
+#include <cstddef>
+
+namespace autoware::object_recognition_utils
+{
+/**
+ * @brief fixed-capacity convex polygon used by the allocation-free matching kernels
+ * @details vertices are stored in counter-clockwise order without repeating the first vertex. The
+ * bounding circle (centroid of the vertices and maximum distance to them) is kept for prefiltering.
+ */
+struct ConvexPolygon2d
+{
+  static constexpr size_t max_size = 16;
+
+  std::array<double, max_size> xs{};
+  std::array<double, max_size> ys{};
+  size_t size{0};
+
+  double area{0.0};
+  double center_x{0.0};
+  double center_y{0.0};
+  double radius{0.0};
+};
+
+/**
+ * @brief set the vertices of a convex polygon and compute its area and bounding circle
+ * @details the vertices may be given in clockwise or counter-clockwise order, with or without the
+ * closing vertex. Consecutive duplicated vertices are removed.
+ * @param xs x coordinates of the vertices
+ * @param ys y coordinates of the vertices
+ * @param n number of vertices
+ * @param [out] polygon resulting polygon
+ * @return false if there are too many vertices or if the polygon is not convex
+ */
+bool setConvexPolygon2d(
+  const double * xs, const double * ys, const size_t n, ConvexPolygon2d & polygon);
+
+/**
+ * @brief convert a boost polygon to a convex polygon
+ * @return false if the polygon has interiors, too many vertices, or is not convex
+ */
+bool toConvexPolygon2d(
+  const autoware_utils_geometry::Polygon2d & source, ConvexPolygon2d & polygon);
+
+/**
+ * @brief compute the footprint of a shape at the given pose
+ * @details bounding boxes are computed in place without any allocation, other shapes go through
+ * autoware_utils_geometry::to_polygon2d so that the footprint is the same as in the boost-based
+ * functions
+ * @return false if the footprint is not convex or has too many vertices
+ */
+bool toConvexPolygon2d(
+  const geometry_msgs::msg::Pose & pose, const autoware_perception_msgs::msg::Shape & shape,
+  ConvexPolygon2d & polygon);
+
+template <class T>
+bool toConvexPolygon2d(const T & object, ConvexPolygon2d & polygon)
+{
+  return toConvexPolygon2d(getPose(object), object.shape, polygon);
+}
+
+/**
+ * @brief true if the bounding circles of the polygons do not overlap, i.e., the polygons cannot
+ * intersect
+ */
+inline bool isSeparatedByBoundingCircles(const ConvexPolygon2d & p1, const ConvexPolygon2d & p2)
+{
+  const double dx = p1.center_x - p2.center_x;
+  const double dy = p1.center_y - p2.center_y;
+  const double r = p1.radius + p2.radius;
+  return dx * dx + dy * dy > r * r;
+}
+
+/**
+ * @brief compute the area of the intersection of two convex polygons
+ * @details Sutherland-Hodgman clipping on stack buffers
+ */
+double getIntersectionArea(const ConvexPolygon2d & p1, const ConvexPolygon2d & p2);
+
+/**
+ * @brief compute the area of the convex hull of the union of two convex polygons
+ */
+double getConvexShapeArea(const ConvexPolygon2d & p1, const ConvexPolygon2d & p2);
+}  // namespace autoware::object_recognition_utils
+
+#endif  // AUTOWARE__OBJECT_RECOGNITION_UTILS__CONVEX_POLYGON2D_HPP_
@@ -15,8 +15,10 @@
 #ifndef AUTOWARE__OBJECT_RECOGNITION_UTILS__MATCHING_HPP_
 #define AUTOWARE__OBJECT_RECOGNITION_UTILS__MATCHING_HPP_
 
+#include "autoware/object_recognition_utils/convex_polygon2d.hpp"
 #include "autoware/object_recognition_utils/geometry.hpp"
 
+#include <Eigen/Core>
 #include <autoware_utils_geometry/boost_geometry.hpp>
 #include <autoware_utils_geometry/boost_polygon_utils.hpp>
 
@@ -24,6 +26,7 @@
 
 #include <algorithm>
 #include <numeric>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -65,10 +68,68 @@ inline double getUnionArea(const Polygon2d & source_polygon, const Polygon2d & t
   return getSumArea(union_polygons);
 }
 
+inline double get2dIoU(
+  const ConvexPolygon2d & source_polygon, const ConvexPolygon2d & target_polygon,
+  const double min_union_area = 0.01)
+{
+  if (source_polygon.area < MIN_AREA || target_polygon.area < MIN_AREA) return 0.0;
+
+  const double intersection_area = getIntersectionArea(source_polygon, target_polygon);
+  if (intersection_area < MIN_AREA) return 0.0;
+  const double union_area = source_polygon.area + target_polygon.area - intersection_area;
+
+  const double iou =
+    union_area < min_union_area ? 0.0 : std::min(1.0, intersection_area / union_area);
+  return iou;
+}
+
+inline double get2dGeneralizedIoU(
+  const ConvexPolygon2d & source_polygon, const ConvexPolygon2d & target_polygon)
+{
+  if (source_polygon.area < MIN_AREA || target_polygon.area < MIN_AREA) return 0.0;
+
+  const double intersection_area = getIntersectionArea(source_polygon, target_polygon);
+  const double union_area = source_polygon.area + target_polygon.area - intersection_area;
+  const double convex_shape_area = getConvexShapeArea(source_polygon, target_polygon);
+
+  const double iou = union_area < 0.01 ? 0.0 : std::min(1.0, intersection_area / union_area);
+  return iou - (convex_shape_area - union_area) / convex_shape_area;
+}
+
+inline double get2dPrecision(
+  const ConvexPolygon2d & source_polygon, const ConvexPolygon2d & target_polygon)
+{
+  if (source_polygon.area < MIN_AREA || target_polygon.area < MIN_AREA) return 0.0;
+
+  const double intersection_area = getIntersectionArea(source_polygon, target_polygon);
+  if (intersection_area < MIN_AREA) return 0.0;
+
+  return std::min(1.0, intersection_area / source_polygon.area);
+}
+
+inline double get2dRecall(
+  const ConvexPolygon2d & source_polygon, const ConvexPolygon2d & target_polygon)
+{
+  if (source_polygon.area < MIN_AREA || target_polygon.area < MIN_AREA) return 0.0;
+
+  const double intersection_area = getIntersectionArea(source_polygon, target_polygon);
+  if (intersection_area < MIN_AREA) return 0.0;
+
+  return std::min(1.0, intersection_area / target_polygon.area);
+}
+
 template <class T1, class T2>
 double get2dIoU(
   const T1 & source_object, const T2 & target_object, const double min_union_area = 0.01)
 {
+  ConvexPolygon2d source_convex;
+  ConvexPolygon2d target_convex;
+  if (
+    toConvexPolygon2d(source_object, source_convex) &&
+    toConvexPolygon2d(target_object, target_convex)) {
+    return get2dIoU(source_convex, target_convex, min_union_area);
+  }
+
   const auto source_polygon = autoware_utils_geometry::to_polygon2d(source_object);
   if (boost::geometry::area(source_polygon) < MIN_AREA) return 0.0;
   const auto target_polygon = autoware_utils_geometry::to_polygon2d(target_object);
@@ -86,6 +147,14 @@ double get2dIoU(
 template <class T1, class T2>
 double get2dGeneralizedIoU(const T1 & source_object, const T2 & target_object)
 {
+  ConvexPolygon2d source_convex;
+  ConvexPolygon2d target_convex;
+  if (
+    toConvexPolygon2d(source_object, source_convex) &&
+    toConvexPolygon2d(target_object, target_convex)) {
+    return get2dGeneralizedIoU(source_convex, target_convex);
+  }
+
   const auto source_polygon = autoware_utils_geometry::to_polygon2d(source_object);
   if (boost::geometry::area(source_polygon) < MIN_AREA) return 0.0;
   const auto target_polygon = autoware_utils_geometry::to_polygon2d(target_object);
@@ -102,6 +171,14 @@ double get2dGeneralizedIoU(const T1 & source_object, const T2 & target_object)
 template <class T1, class T2>
 double get2dPrecision(const T1 & source_object, const T2 & target_object)
 {
+  ConvexPolygon2d source_convex;
+  ConvexPolygon2d target_convex;
+  if (
+    toConvexPolygon2d(source_object, source_convex) &&
+    toConvexPolygon2d(target_object, target_convex)) {
+    return get2dPrecision(source_convex, target_convex);
+  }
+
   const auto source_polygon = autoware_utils_geometry::to_polygon2d(source_object);
   const double source_area = boost::geometry::area(source_polygon);
   if (source_area < MIN_AREA) return 0.0;
@@ -117,6 +194,14 @@ double get2dPrecision(const T1 & source_object, const T2 & target_object)
 template <class T1, class T2>
 double get2dRecall(const T1 & source_object, const T2 & target_object)
 {
+  ConvexPolygon2d source_convex;
+  ConvexPolygon2d target_convex;
+  if (
+    toConvexPolygon2d(source_object, source_convex) &&
+    toConvexPolygon2d(target_object, target_convex)) {
+    return get2dRecall(source_convex, target_convex);
+  }
+
   const auto source_polygon = autoware_utils_geometry::to_polygon2d(source_object);
   if (boost::geometry::area(source_polygon) < MIN_AREA) return 0.0;
   const auto target_polygon = autoware_utils_geometry::to_polygon2d(target_object);
@@ -128,6 +213,103 @@ double get2dRecall(const T1 & source_object, const T2 & target_object)
 
   return std::min(1.0, intersection_area / target_area);
 }
+
+namespace detail
+{
+/// @brief fill the score matrix, using the convex kernel when both footprints are convex
+template <class T1, class T2, class ConvexMetric, class ObjectMetric>
+Eigen::MatrixXd get2dMetricMatrix(
+  const std::vector<T1> & source_objects, const std::vector<T2> & target_objects,
+  const size_t num_threads, const ConvexMetric & convex_metric, const ObjectMetric & object_metric)
+{
+  const auto to_convex_polygons = [](const auto & objects, std::vector<bool> & is_convex) {
+    std::vector<ConvexPolygon2d> polygons(objects.size());
+    is_convex.resize(objects.size());
+    for (size_t i = 0; i < objects.size(); ++i) {
+      is_convex[i] = toConvexPolygon2d(objects[i], polygons[i]);
+    }
+    return polygons;
+  };
+  std::vector<bool> is_source_convex;
+  std::vector<bool> is_target_convex;
+  const auto source_polygons = to_convex_polygons(source_objects, is_source_convex);
+  const auto target_polygons = to_convex_polygons(target_objects, is_target_convex);
+
+  Eigen::MatrixXd scores(source_objects.size(), target_objects.size());
+  const auto fill_rows = [&](const size_t begin, const size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      for (size_t j = 0; j < target_objects.size(); ++j) {
+        scores(i, j) = is_source_convex[i] && is_target_convex[j]
+                         ? convex_metric(source_polygons[i], target_polygons[j])
+                         : object_metric(source_objects[i], target_objects[j]);
+      }
+    }
+  };
+
+  const size_t num_rows = source_objects.size();
+  const size_t num_workers =
+    std::min(std::max<size_t>(num_threads, 1), std::max<size_t>(num_rows, 1));
+  if (num_workers == 1) {
+    fill_rows(0, num_rows);
+    return scores;
+  }
+  std::vector<std::thread> workers;
+  workers.reserve(num_workers);
+  const size_t rows_per_worker = (num_rows + num_workers - 1) / num_workers;
+  for (size_t begin = 0; begin < num_rows; begin += rows_per_worker) {
+    workers.emplace_back(fill_rows, begin, std::min(begin + rows_per_worker, num_rows));
+  }
+  for (auto & worker : workers) {
+    worker.join();
+  }
+  return scores;
+}
+}  // namespace detail
+
+/**
+ * @brief compute the IoU of every pair of source and target objects
+ * @details each footprint is computed once and pairs whose bounding circles do not overlap are
+ * skipped without clipping
+ * @param source_objects source objects (rows)
+ * @param target_objects target objects (columns)
+ * @param min_union_area minimum union area, see get2dIoU
+ * @param num_threads number of threads used to fill the matrix (rows are split between threads)
+ * @return matrix of size source_objects.size() x target_objects.size()
+ */
+template <class T1, class T2>
+Eigen::MatrixXd get2dIoUMatrix(
+  const std::vector<T1> & source_objects, const std::vector<T2> & target_objects,
+  const double min_union_area = 0.01, const size_t num_threads = 1)
+{
+  return detail::get2dMetricMatrix(
+    source_objects, target_objects, num_threads,
+    [min_union_area](const ConvexPolygon2d & source, const ConvexPolygon2d & target) {
+      return get2dIoU(source, target, min_union_area);
+    },
+    [min_union_area](const T1 & source, const T2 & target) {
+      return get2dIoU(source, target, min_union_area);
+    });
+}
+
+/**
+ * @brief compute the generalized IoU of every pair of source and target objects
+ * @param source_objects source objects (rows)
+ * @param target_objects target objects (columns)
+ * @param num_threads number of threads used to fill the matrix (rows are split between threads)
+ * @return matrix of size source_objects.size() x target_objects.size()
+ */
+template <class T1, class T2>
+Eigen::MatrixXd get2dGeneralizedIoUMatrix(
+  const std::vector<T1> & source_objects, const std::vector<T2> & target_objects,
+  const size_t num_threads = 1)
+{
+  return detail::get2dMetricMatrix(
+    source_objects, target_objects, num_threads,
+    [](const ConvexPolygon2d & source, const ConvexPolygon2d & target) {
+      return get2dGeneralizedIoU(source, target);
+    },
+    [](const T1 & source, const T2 & target) { return get2dGeneralizedIoU(source, target); });
+}
 }  // namespace autoware::object_recognition_utils
 
 #endif  // AUTOWARE__OBJECT_RECOGNITION_UTILS__MATCHING_HPP_
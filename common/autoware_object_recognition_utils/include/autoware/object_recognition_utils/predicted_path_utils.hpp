@@ -17,6 +17,7 @@
 
 #include <autoware_utils_geometry/geometry.hpp>
 
+#include <autoware_perception_msgs/msg/predicted_objects.hpp>
 #include <autoware_perception_msgs/msg/predicted_path.hpp>
 #include <geometry_msgs/msg/pose.hpp>
 
@@ -61,6 +62,96 @@ autoware_perception_msgs::msg::PredictedPath resamplePredictedPath(
   const autoware_perception_msgs::msg::PredictedPath & path, const double sampling_time_interval,
   const double sampling_horizon, const bool use_spline_for_xy = true,
   const bool use_spline_for_z = false);
+
+/**
+ * @brief Resampler of predicted paths which keeps its work buffers between calls
+ * @details The time step of a predicted path is uniform, so the segment of each resampled time is
+ * computed arithmetically instead of being searched. The segments and the factorization of the
+ * spline system only depend on the time step and the number of points of the input path, and are
+ * shared by consecutive paths having the same ones. The results are the same as
+ * resamplePredictedPath. This class is not thread-safe.
+ */
+class PredictedPathResampler
+{
+public:
+  explicit PredictedPathResampler(
+    const bool use_spline_for_xy = true, const bool use_spline_for_z = false);
+
+  /**
+   * @brief Resampling predicted path by time step vector. Same as resamplePredictedPath, except
+   * that the result is written to an existing message, whose time step is left unchanged
+   * @param path Input predicted path
+   * @param resampled_time resampled time at each resampling point. Each time should be within
+   * [0.0, time_step*(num_of_path_points)]
+   * @param [out] resampled_path resampled path. This can be the same message as path
+   */
+  void resample(
+    const autoware_perception_msgs::msg::PredictedPath & path,
+    const std::vector<double> & resampled_time,
+    autoware_perception_msgs::msg::PredictedPath & resampled_path);
+
+  /**
+   * @brief Resampling every predicted path of objects in place by sampling time interval. Each
+   * path is resampled as by resamplePredictedPath(path, sampling_time_interval, sampling_horizon),
+   * using one time grid shared by all the paths
+   * @param [in,out] objects objects whose predicted paths are resampled
+   * @param sampling_time_interval sampling time interval for each point
+   * @param sampling_horizon sampling time horizon
+   * @throw std::invalid_argument if a path has less than two points or a non positive time step.
+   * The objects are not modified in this case
+   */
+  void resample(
+    autoware_perception_msgs::msg::PredictedObjects & objects, const double sampling_time_interval,
+    const double sampling_horizon);
+
+private:
+  struct Segment
+  {
+    size_t index;          // segment for the linear and spherical linear interpolation
+    double ratio;          // ratio in the segment for the linear interpolation
+    size_t spline_index;   // segment for the spline interpolation
+    double spline_offset;  // offset from the start of the segment for the spline interpolation
+  };
+
+  void updateSegments(
+    const double time_step, const size_t num_points, const double * resampled_time,
+    const size_t resampled_size, const size_t total_size);
+  void updateSplineFactorization(const double time_step, const size_t num_points);
+  void calcSecondDerivatives(
+    const std::vector<double> & values, const double time_step,
+    std::vector<double> & second_derivatives);
+  void resampleImpl(
+    const autoware_perception_msgs::msg::PredictedPath & path, const double time_step,
+    const size_t resampled_size, autoware_perception_msgs::msg::PredictedPath & resampled_path);
+
+  bool use_spline_for_xy_;
+  bool use_spline_for_z_;
+
+  // copy of the input path, so that the path can be resampled in place
+  std::vector<double> xs_;
+  std::vector<double> ys_;
+  std::vector<double> zs_;
+  std::vector<geometry_msgs::msg::Quaternion> quats_;
+
+  // segments of the resampled times, valid for segment_time_step_ and segment_num_points_
+  std::vector<Segment> segments_;
+  double segment_time_step_{0.0};
+  size_t segment_num_points_{0};
+
+  // forward sweep of the tridiagonal matrix algorithm, valid for spline_time_step_ and
+  // spline_num_points_
+  std::vector<double> c_prime_;
+  std::vector<double> inv_pivots_;
+  double first_pivot_{0.0};
+  double spline_time_step_{0.0};
+  size_t spline_num_points_{0};
+
+  std::vector<double> d_prime_;
+  std::vector<double> second_derivatives_x_;
+  std::vector<double> second_derivatives_y_;
+  std::vector<double> second_derivatives_z_;
+  std::vector<double> sampling_time_vector_;
+};
 }  // namespace autoware::object_recognition_utils
 
 #endif  // AUTOWARE__OBJECT_RECOGNITION_UTILS__PREDICTED_PATH_UTILS_HPP_
@@ -0,0 +1,279 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/object_recognition_utils/convex_polygon2d.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <utility>
+
+namespace autoware::object_recognition_utils
+{
+namespace
+{
+// the intersection of two convex polygons has at most as many vertices as the two polygons
+constexpr size_t buffer_size = 2 * ConvexPolygon2d::max_size;
+// tolerance on the normalized cross product of consecutive edges for the convexity check
+constexpr double convexity_tolerance = 1e-9;
+
+struct PointBuffer
+{
+  std::array<double, buffer_size> xs;
+  std::array<double, buffer_size> ys;
+  size_t size{0};
+
+  void push(const double x, const double y)
+  {
+    xs[size] = x;
+    ys[size] = y;
+    ++size;
+  }
+};
+
+template <class Buffer>
+double calcSignedArea(const Buffer & xs, const Buffer & ys, const size_t n)
+{
+  if (n < 3) {
+    return 0.0;
+  }
+  double twice_area = 0.0;
+  for (size_t i = 0, j = n - 1; i < n; j = i++) {
+    twice_area += xs[j] * ys[i] - xs[i] * ys[j];
+  }
+  return 0.5 * twice_area;
+}
+
+/// @brief clip the input polygon by the half-plane on the left of the directed line a->b
+void clipByHalfPlane(
+  const PointBuffer & input, const double ax, const double ay, const double bx, const double by,
+  PointBuffer & output)
+{
+  output.size = 0;
+  if (input.size == 0) {
+    return;
+  }
+  const double ex = bx - ax;
+  const double ey = by - ay;
+  const auto side = [&](const double x, const double y) { return ex * (y - ay) - ey * (x - ax); };
+
+  double sx = input.xs[input.size - 1];
+  double sy = input.ys[input.size - 1];
+  double s_side = side(sx, sy);
+  for (size_t i = 0; i < input.size; ++i) {
+    const double px = input.xs[i];
+    const double py = input.ys[i];
+    const double p_side = side(px, py);
+    if ((s_side >= 0.0) != (p_side >= 0.0)) {
+      const double t = s_side / (s_side - p_side);
+      output.push(sx + t * (px - sx), sy + t * (py - sy));
+    }
+    if (p_side >= 0.0) {
+      output.push(px, py);
+    }
+    sx = px;
+    sy = py;
+    s_side = p_side;
+  }
+}
+}  // namespace
+
+bool setConvexPolygon2d(
+  const double * xs, const double * ys, const size_t n, ConvexPolygon2d & polygon)
+{
+  polygon = ConvexPolygon2d{};
+
+  size_t size = 0;
+  for (size_t i = 0; i < n; ++i) {
+    if (size > 0 && xs[i] == polygon.xs[size - 1] && ys[i] == polygon.ys[size - 1]) {
+      continue;
+    }
+    if (size == ConvexPolygon2d::max_size) {
+      // the last vertex is accepted only if it closes the ring
+      if (i + 1 == n && xs[i] == polygon.xs[0] && ys[i] == polygon.ys[0]) {
+        break;
+      }
+      return false;
+    }
+    polygon.xs[size] = xs[i];
+    polygon.ys[size] = ys[i];
+    ++size;
+  }
+  while (size > 1 && polygon.xs[size - 1] == polygon.xs[0] &&
+         polygon.ys[size - 1] == polygon.ys[0]) {
+    --size;
+  }
+  polygon.size = size;
+  if (size == 0) {
+    return true;
+  }
+
+  const double signed_area = calcSignedArea(polygon.xs, polygon.ys, size);
+  if (signed_area < 0.0) {
+    std::reverse(polygon.xs.begin(), polygon.xs.begin() + size);
+    std::reverse(polygon.ys.begin(), polygon.ys.begin() + size);
+  }
+  polygon.area = std::abs(signed_area);
+
+  if (size >= 3) {
+    // every turn must be to the left and the boundary must wind around only once
+    double total_turn = 0.0;
+    for (size_t i = 0; i < size; ++i) {
+      const size_t j = (i + 1) % size;
+      const size_t k = (i + 2) % size;
+      const double e1x = polygon.xs[j] - polygon.xs[i];
+      const double e1y = polygon.ys[j] - polygon.ys[i];
+      const double e2x = polygon.xs[k] - polygon.xs[j];
+      const double e2y = polygon.ys[k] - polygon.ys[j];
+      const double cross = e1x * e2y - e1y * e2x;
+      const double dot = e1x * e2x + e1y * e2y;
+      if (cross < -convexity_tolerance * std::hypot(e1x, e1y) * std::hypot(e2x, e2y)) {
+        return false;
+      }
+      total_turn += std::atan2(cross, dot);
+    }
+    if (std::abs(total_turn - 2.0 * M_PI) > 1e-6) {
+      return false;
+    }
+  }
+
+  for (size_t i = 0; i < size; ++i) {
+    polygon.center_x += polygon.xs[i];
+    polygon.center_y += polygon.ys[i];
+  }
+  polygon.center_x /= static_cast<double>(size);
+  polygon.center_y /= static_cast<double>(size);
+  double squared_radius = 0.0;
+  for (size_t i = 0; i < size; ++i) {
+    const double dx = polygon.xs[i] - polygon.center_x;
+    const double dy = polygon.ys[i] - polygon.center_y;
+    squared_radius = std::max(squared_radius, dx * dx + dy * dy);
+  }
+  polygon.radius = std::sqrt(squared_radius);
+  return true;
+}
+
+bool toConvexPolygon2d(const autoware_utils_geometry::Polygon2d & source, ConvexPolygon2d & polygon)
+{
+  const auto & outer = source.outer();
+  if (!source.inners().empty() || outer.size() > ConvexPolygon2d::max_size + 1) {
+    return false;
+  }
+  std::array<double, ConvexPolygon2d::max_size + 1> xs;
+  std::array<double, ConvexPolygon2d::max_size + 1> ys;
+  for (size_t i = 0; i < outer.size(); ++i) {
+    xs[i] = outer[i].x();
+    ys[i] = outer[i].y();
+  }
+  return setConvexPolygon2d(xs.data(), ys.data(), outer.size(), polygon);
+}
+
+bool toConvexPolygon2d(
+  const geometry_msgs::msg::Pose & pose, const autoware_perception_msgs::msg::Shape & shape,
+  ConvexPolygon2d & polygon)
+{
+  if (shape.type != autoware_perception_msgs::msg::Shape::BOUNDING_BOX) {
+    return toConvexPolygon2d(autoware_utils_geometry::to_polygon2d(pose, shape), polygon);
+  }
+
+  // same rotation as tf2::Matrix3x3::setRotation, restricted to the xy plane
+  const auto & q = pose.orientation;
+  const double d = q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w;
+  const double s = d > 0.0 ? 2.0 / d : 0.0;
+  const double r00 = 1.0 - (q.y * q.y * s + q.z * q.z * s);
+  const double r01 = q.x * q.y * s - q.w * q.z * s;
+  const double r10 = q.x * q.y * s + q.w * q.z * s;
+  const double r11 = 1.0 - (q.x * q.x * s + q.z * q.z * s);
+
+  const double half_length = shape.dimensions.x / 2.0;
+  const double half_width = shape.dimensions.y / 2.0;
+  const std::array<std::pair<double, double>, 4> offsets = {
+    {{half_length, half_width},
+     {half_length, -half_width},
+     {-half_length, -half_width},
+     {-half_length, half_width}}};
+  std::array<double, 4> xs;
+  std::array<double, 4> ys;
+  for (size_t i = 0; i < offsets.size(); ++i) {
+    const auto & [dx, dy] = offsets[i];
+    xs[i] = r00 * dx + r01 * dy + pose.position.x;
+    ys[i] = r10 * dx + r11 * dy + pose.position.y;
+  }
+  return setConvexPolygon2d(xs.data(), ys.data(), xs.size(), polygon);
+}
+
+double getIntersectionArea(const ConvexPolygon2d & p1, const ConvexPolygon2d & p2)
+{
+  if (p1.size < 3 || p2.size < 3 || isSeparatedByBoundingCircles(p1, p2)) {
+    return 0.0;
+  }
+
+  PointBuffer buffers[2];
+  for (size_t i = 0; i < p1.size; ++i) {
+    buffers[0].push(p1.xs[i], p1.ys[i]);
+  }
+  size_t current = 0;
+  for (size_t i = 0, j = p2.size - 1; i < p2.size; j = i++) {
+    clipByHalfPlane(buffers[current], p2.xs[j], p2.ys[j], p2.xs[i], p2.ys[i], buffers[1 - current]);
+    current = 1 - current;
+    if (buffers[current].size < 3) {
+      return 0.0;
+    }
+  }
+  const auto & clipped = buffers[current];
+  return std::abs(calcSignedArea(clipped.xs, clipped.ys, clipped.size));
+}
+
+double getConvexShapeArea(const ConvexPolygon2d & p1, const ConvexPolygon2d & p2)
+{
+  // Andrew's monotone chain on the vertices of both polygons
+  std::array<std::pair<double, double>, buffer_size> points;
+  size_t n = 0;
+  for (size_t i = 0; i < p1.size; ++i) {
+    points[n++] = {p1.xs[i], p1.ys[i]};
+  }
+  for (size_t i = 0; i < p2.size; ++i) {
+    points[n++] = {p2.xs[i], p2.ys[i]};
+  }
+  if (n < 3) {
+    return 0.0;
+  }
+  std::sort(points.begin(), points.begin() + n);
+
+  const auto cross = [](const auto & o, const auto & a, const auto & b) {
+    return (a.first - o.first) * (b.second - o.second) -
+           (a.second - o.second) * (b.first - o.first);
+  };
+  std::array<std::pair<double, double>, 2 * buffer_size> hull;
+  size_t k = 0;
+  for (size_t i = 0; i < n; ++i) {
+    while (k >= 2 && cross(hull[k - 2], hull[k - 1], points[i]) <= 0.0) {
+      --k;
+    }
+    hull[k++] = points[i];
+  }
+  for (size_t i = n - 1, lower_size = k + 1; i > 0; --i) {
+    while (k >= lower_size && cross(hull[k - 2], hull[k - 1], points[i - 1]) <= 0.0) {
+      --k;
+    }
+    hull[k++] = points[i - 1];
+  }
+  // the first point is repeated at the end
+  double twice_area = 0.0;
+  for (size_t i = 0; i + 1 < k; ++i) {
+    twice_area += hull[i].first * hull[i + 1].second - hull[i + 1].first * hull[i].second;
+  }
+  return std::abs(0.5 * twice_area);
+}
+}  // namespace autoware::object_recognition_utils
@@ -19,6 +19,8 @@
 #include "autoware/interpolation/spline_interpolation.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <iterator>
 #include <vector>
 
 namespace autoware::object_recognition_utils
@@ -33,7 +35,14 @@ boost::optional<geometry_msgs::msg::Pose> calcInterpolatedPose(
 
   constexpr double epsilon = 1e-6;
   const double & time_step = rclcpp::Duration(path.time_step).seconds();
-  for (size_t path_idx = 1; path_idx < path.path.size(); ++path_idx) {
+  // the time step is uniform, so the search starts right before the segment of relative_time
+  size_t start_idx = 1;
+  if (time_step > 0.0) {
+    const double estimated_idx = std::floor((relative_time - epsilon) / time_step);
+    start_idx = static_cast<size_t>(
+      std::clamp(estimated_idx, 1.0, static_cast<double>(path.path.size())));
+  }
+  for (size_t path_idx = start_idx; path_idx < path.path.size(); ++path_idx) {
     const auto & pt = path.path.at(path_idx);
     const auto & prev_pt = path.path.at(path_idx - 1);
     if (relative_time - epsilon < time_step * path_idx) {
@@ -51,52 +60,9 @@ autoware_perception_msgs::msg::PredictedPath resamplePredictedPath(
   const std::vector<double> & resampled_time, const bool use_spline_for_xy,
   const bool use_spline_for_z)
 {
-  if (path.path.empty() || resampled_time.empty()) {
-    throw std::invalid_argument("input path or resampled_time is empty");
-  }
-
-  const double & time_step = rclcpp::Duration(path.time_step).seconds();
-  std::vector<double> input_time(path.path.size());
-  std::vector<double> x(path.path.size());
-  std::vector<double> y(path.path.size());
-  std::vector<double> z(path.path.size());
-  std::vector<geometry_msgs::msg::Quaternion> quat(path.path.size());
-  for (size_t i = 0; i < path.path.size(); ++i) {
-    input_time.at(i) = time_step * i;
-    x.at(i) = path.path.at(i).position.x;
-    y.at(i) = path.path.at(i).position.y;
-    z.at(i) = path.path.at(i).position.z;
-    quat.at(i) = path.path.at(i).orientation;
-  }
-
-  const auto lerp = [&](const auto & input) {
-    return autoware::interpolation::lerp(input_time, input, resampled_time);
-  };
-  const auto spline = [&](const auto & input) {
-    return autoware::interpolation::spline(input_time, input, resampled_time);
-  };
-  const auto slerp = [&](const auto & input) {
-    return autoware::interpolation::slerp(input_time, input, resampled_time);
-  };
-
-  const auto interpolated_x = use_spline_for_xy ? spline(x) : lerp(x);
-  const auto interpolated_y = use_spline_for_xy ? spline(y) : lerp(y);
-  const auto interpolated_z = use_spline_for_z ? spline(z) : lerp(z);
-  const auto interpolated_quat = slerp(quat);
-
   autoware_perception_msgs::msg::PredictedPath resampled_path;
-  const auto resampled_size = std::min(resampled_path.path.max_size(), resampled_time.size());
-  resampled_path.confidence = path.confidence;
-  resampled_path.path.resize(resampled_size);
-
-  // Set Position
-  for (size_t i = 0; i < resampled_size; ++i) {
-    const auto p = autoware_utils_geometry::create_point(
-      interpolated_x.at(i), interpolated_y.at(i), interpolated_z.at(i));
-    resampled_path.path.at(i).position = p;
-    resampled_path.path.at(i).orientation = interpolated_quat.at(i);
-  }
-
+  PredictedPathResampler(use_spline_for_xy, use_spline_for_z)
+    .resample(path, resampled_time, resampled_path);
   return resampled_path;
 }
 
@@ -130,4 +96,255 @@ autoware_perception_msgs::msg::PredictedPath resamplePredictedPath(
   resampled_path.time_step = rclcpp::Duration::from_seconds(sampling_time_interval);
   return resampled_path;
 }
+
+PredictedPathResampler::PredictedPathResampler(
+  const bool use_spline_for_xy, const bool use_spline_for_z)
+: use_spline_for_xy_(use_spline_for_xy), use_spline_for_z_(use_spline_for_z)
+{
+}
+
+void PredictedPathResampler::resample(
+  const autoware_perception_msgs::msg::PredictedPath & path,
+  const std::vector<double> & resampled_time,
+  autoware_perception_msgs::msg::PredictedPath & resampled_path)
+{
+  if (path.path.empty() || resampled_time.empty()) {
+    throw std::invalid_argument("input path or resampled_time is empty");
+  }
+  if (path.path.size() < 2) {
+    throw std::invalid_argument("The size of points is less than 2.");
+  }
+
+  // same validation as autoware::interpolation::validateKeys
+  const double time_step = rclcpp::Duration(path.time_step).seconds();
+  if (time_step <= 0.0 || !std::is_sorted(resampled_time.begin(), resampled_time.end())) {
+    throw std::invalid_argument("Either time_step is not positive or resampled_time is unsorted.");
+  }
+  constexpr double epsilon = 1e-3;
+  const double end_time = time_step * static_cast<double>(path.path.size() - 1);
+  if (resampled_time.front() < -epsilon || end_time + epsilon < resampled_time.back()) {
+    throw std::invalid_argument("resampled_time is out of the predicted path");
+  }
+
+  const auto resampled_size = std::min(resampled_path.path.max_size(), resampled_time.size());
+  updateSegments(
+    time_step, path.path.size(), resampled_time.data(), resampled_size, resampled_time.size());
+  resampled_path.confidence = path.confidence;
+  resampleImpl(path, time_step, resampled_size, resampled_path);
+}
+
+void PredictedPathResampler::resample(
+  autoware_perception_msgs::msg::PredictedObjects & objects, const double sampling_time_interval,
+  const double sampling_horizon)
+{
+  if (sampling_time_interval <= 0.0 || sampling_horizon <= 0.0) {
+    throw std::invalid_argument("sampling time interval or sampling time horizon is negative");
+  }
+  for (const auto & object : objects.objects) {
+    for (const auto & path : object.kinematics.predicted_paths) {
+      if (path.path.empty()) {
+        throw std::invalid_argument("Predicted Path is empty");
+      }
+      if (path.path.size() < 2 || rclcpp::Duration(path.time_step).seconds() <= 0.0) {
+        throw std::invalid_argument("The size of points is less than 2 or the time step is zero.");
+      }
+    }
+  }
+
+  // same time grid as resamplePredictedPath, each path uses the part within its horizon
+  constexpr double epsilon = 1e-6;
+  sampling_time_vector_.clear();
+  for (double t = 0.0; t < sampling_horizon + epsilon; t += sampling_time_interval) {
+    sampling_time_vector_.push_back(t);
+  }
+  segment_num_points_ = 0;
+  const auto resampled_time_step = rclcpp::Duration::from_seconds(sampling_time_interval);
+
+  for (auto & object : objects.objects) {
+    for (auto & path : object.kinematics.predicted_paths) {
+      const double time_step = rclcpp::Duration(path.time_step).seconds();
+      const size_t num_points = path.path.size();
+      const double predicted_horizon = time_step * static_cast<double>(num_points - 1);
+      const double horizon = std::min(predicted_horizon, sampling_horizon);
+      const auto total_size = static_cast<size_t>(std::distance(
+        sampling_time_vector_.begin(),
+        std::lower_bound(
+          sampling_time_vector_.begin(), sampling_time_vector_.end(), horizon + epsilon)));
+      const auto resampled_size = std::min(path.path.max_size(), total_size);
+
+      if (time_step != segment_time_step_ || num_points != segment_num_points_) {
+        updateSegments(
+          time_step, num_points, sampling_time_vector_.data(), resampled_size, total_size);
+      }
+      resampleImpl(path, time_step, resampled_size, path);
+      path.time_step = resampled_time_step;
+    }
+  }
+}
+
+void PredictedPathResampler::updateSegments(
+  const double time_step, const size_t num_points, const double * resampled_time,
+  const size_t resampled_size, const size_t total_size)
+{
+  const auto base_key = [&](const size_t i) { return time_step * static_cast<double>(i); };
+  // smallest segment whose end is not before the key, as found by the interpolation functions
+  const auto find_segment = [&](const double key) {
+    const double estimated_idx = std::ceil(key / time_step) - 1.0;
+    auto idx = static_cast<size_t>(
+      std::clamp(estimated_idx, 0.0, static_cast<double>(num_points - 2)));
+    while (idx > 0 && key <= base_key(idx)) {
+      --idx;
+    }
+    while (idx + 2 < num_points && base_key(idx + 1) < key) {
+      ++idx;
+    }
+    return idx;
+  };
+
+  segments_.resize(resampled_size);
+  for (size_t i = 0; i < resampled_size; ++i) {
+    // the first and last keys are cropped to the path as in autoware::interpolation::lerp
+    double key = resampled_time[i];
+    if (i == 0) {
+      key = std::max(key, base_key(0));
+    }
+    if (i + 1 == total_size) {
+      key = std::min(key, base_key(num_points - 1));
+    }
+
+    auto & segment = segments_[i];
+    segment.index = find_segment(key);
+    segment.ratio =
+      (key - base_key(segment.index)) / (base_key(segment.index + 1) - base_key(segment.index));
+    // the keys are not cropped in autoware::interpolation::spline
+    segment.spline_index = find_segment(resampled_time[i]);
+    segment.spline_offset = resampled_time[i] - base_key(segment.spline_index);
+  }
+  segment_time_step_ = time_step;
+  segment_num_points_ = num_points;
+}
+
+void PredictedPathResampler::updateSplineFactorization(
+  const double time_step, const size_t num_points)
+{
+  if (time_step == spline_time_step_ && num_points == spline_num_points_) {
+    return;
+  }
+  spline_time_step_ = time_step;
+  spline_num_points_ = num_points;
+
+  // forward sweep of autoware::interpolation::solve_tridiagonal_matrix_algorithm, which only
+  // depends on the intervals of the keys
+  const auto h = [&](const size_t i) {
+    return time_step * static_cast<double>(i + 1) - time_step * static_cast<double>(i);
+  };
+  const size_t n = num_points < 3 ? 0 : num_points - 2;
+  c_prime_.assign(n, 0.0);
+  inv_pivots_.assign(n, 0.0);
+  if (n == 0) {
+    return;
+  }
+  first_pivot_ = 2 * (h(0) + h(1));
+  if (n == 1) {
+    return;
+  }
+  c_prime_[0] = h(1) / first_pivot_;
+  for (size_t i = 1; i < n; ++i) {
+    const double m = 1.0 / (2 * (h(i) + h(i + 1)) - h(i) * c_prime_[i - 1]);
+    c_prime_[i] = i < n - 1 ? h(i + 1) * m : 0;
+    inv_pivots_[i] = m;
+  }
+}
+
+void PredictedPathResampler::calcSecondDerivatives(
+  const std::vector<double> & values, const double time_step,
+  std::vector<double> & second_derivatives)
+{
+  const auto h = [&](const size_t i) {
+    return time_step * static_cast<double>(i + 1) - time_step * static_cast<double>(i);
+  };
+  const auto d = [&](const size_t i) {
+    return 6 * ((values[i + 2] - values[i + 1]) / h(i + 1) - (values[i + 1] - values[i]) / h(i));
+  };
+
+  // natural spline, the second derivatives at both ends are zero
+  const size_t num_points = values.size();
+  second_derivatives.assign(num_points, 0.0);
+  const size_t n = num_points < 3 ? 0 : num_points - 2;
+  if (n == 0) {
+    return;
+  }
+  if (n == 1) {
+    second_derivatives[1] = d(0) / first_pivot_;
+    return;
+  }
+
+  d_prime_.resize(n);
+  d_prime_[0] = d(0) / first_pivot_;
+  for (size_t i = 1; i < n; ++i) {
+    d_prime_[i] = (d(i) - h(i) * d_prime_[i - 1]) * inv_pivots_[i];
+  }
+  second_derivatives[n] = d_prime_[n - 1];
+  for (size_t i = n - 1; i > 0; --i) {
+    second_derivatives[i] = d_prime_[i - 1] - c_prime_[i - 1] * second_derivatives[i + 1];
+  }
+}
+
+void PredictedPathResampler::resampleImpl(
+  const autoware_perception_msgs::msg::PredictedPath & path, const double time_step,
+  const size_t resampled_size, autoware_perception_msgs::msg::PredictedPath & resampled_path)
+{
+  const size_t num_points = path.path.size();
+  xs_.resize(num_points);
+  ys_.resize(num_points);
+  zs_.resize(num_points);
+  quats_.resize(num_points);
+  for (size_t i = 0; i < num_points; ++i) {
+    const auto & pose = path.path[i];
+    xs_[i] = pose.position.x;
+    ys_[i] = pose.position.y;
+    zs_[i] = pose.position.z;
+    quats_[i] = pose.orientation;
+  }
+
+  if (use_spline_for_xy_ || use_spline_for_z_) {
+    updateSplineFactorization(time_step, num_points);
+  }
+  if (use_spline_for_xy_) {
+    calcSecondDerivatives(xs_, time_step, second_derivatives_x_);
+    calcSecondDerivatives(ys_, time_step, second_derivatives_y_);
+  }
+  if (use_spline_for_z_) {
+    calcSecondDerivatives(zs_, time_step, second_derivatives_z_);
+  }
+
+  // same coefficients as autoware::interpolation::SplineInterpolation
+  const auto spline = [&](const auto & values, const auto & v, const Segment & segment) {
+    const size_t i = segment.spline_index;
+    const double h = time_step * static_cast<double>(i + 1) - time_step * static_cast<double>(i);
+    const double a = (v[i + 1] - v[i]) / 6.0 / h;
+    const double b = v[i] / 2.0;
+    const double c = (values[i + 1] - values[i]) / h - h * (2 * v[i] + v[i + 1]) / 6.0;
+    const double dx = segment.spline_offset;
+    return a * dx * dx * dx + b * dx * dx + c * dx + values[i];
+  };
+  const auto lerp = [&](const std::vector<double> & values, const Segment & segment) {
+    return autoware::interpolation::lerp(
+      values[segment.index], values[segment.index + 1], segment.ratio);
+  };
+
+  resampled_path.path.resize(resampled_size);
+  for (size_t i = 0; i < resampled_size; ++i) {
+    const auto & segment = segments_[i];
+    auto & pose = resampled_path.path[i];
+    pose.position.x =
+      use_spline_for_xy_ ? spline(xs_, second_derivatives_x_, segment) : lerp(xs_, segment);
+    pose.position.y =
+      use_spline_for_xy_ ? spline(ys_, second_derivatives_y_, segment) : lerp(ys_, segment);
+    pose.position.z =
+      use_spline_for_z_ ? spline(zs_, second_derivatives_z_, segment) : lerp(zs_, segment);
+    pose.orientation = autoware::interpolation::slerp(
+      quats_[segment.index], quats_[segment.index + 1], segment.ratio);
+  }
+}
 }  // namespace autoware::object_recognition_utils
@@ -0,0 +1,139 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/object_recognition_utils/convex_polygon2d.hpp"
+
+#include <autoware_utils_geometry/geometry.hpp>
+
+#include <boost/geometry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+using autoware::object_recognition_utils::ConvexPolygon2d;
+using autoware::object_recognition_utils::getConvexShapeArea;
+using autoware::object_recognition_utils::getIntersectionArea;
+using autoware::object_recognition_utils::setConvexPolygon2d;
+using autoware::object_recognition_utils::toConvexPolygon2d;
+
+namespace
+{
+geometry_msgs::msg::Pose createPose(const double x, const double y, const double yaw)
+{
+  geometry_msgs::msg::Pose p;
+  p.position = geometry_msgs::build<geometry_msgs::msg::Point>().x(x).y(y).z(0.0);
+  p.orientation = autoware_utils_geometry::create_quaternion_from_yaw(yaw);
+  return p;
+}
+
+autoware_perception_msgs::msg::Shape createShape(
+  const uint8_t type, const double length, const double width)
+{
+  autoware_perception_msgs::msg::Shape shape;
+  shape.type = type;
+  shape.dimensions.x = length;
+  shape.dimensions.y = width;
+  return shape;
+}
+}  // namespace
+
+TEST(convex_polygon2d, test_setConvexPolygon2d)
+{
+  {  // clockwise square with the closing vertex
+    const std::vector<double> xs = {0.0, 0.0, 1.0, 1.0, 0.0};
+    const std::vector<double> ys = {0.0, 1.0, 1.0, 0.0, 0.0};
+    ConvexPolygon2d polygon;
+    ASSERT_TRUE(setConvexPolygon2d(xs.data(), ys.data(), xs.size(), polygon));
+    EXPECT_EQ(polygon.size, 4u);
+    EXPECT_DOUBLE_EQ(polygon.area, 1.0);
+    EXPECT_DOUBLE_EQ(polygon.center_x, 0.5);
+    EXPECT_DOUBLE_EQ(polygon.center_y, 0.5);
+    EXPECT_DOUBLE_EQ(polygon.radius, std::sqrt(0.5));
+  }
+
+  {  // non convex
+    const std::vector<double> xs = {0.0, 2.0, 1.0, 2.0, 0.0};
+    const std::vector<double> ys = {0.0, 0.0, 1.0, 2.0, 2.0};
+    ConvexPolygon2d polygon;
+    EXPECT_FALSE(setConvexPolygon2d(xs.data(), ys.data(), xs.size(), polygon));
+  }
+
+  {  // too many vertices
+    std::vector<double> xs;
+    std::vector<double> ys;
+    for (size_t i = 0; i < ConvexPolygon2d::max_size + 1; ++i) {
+      const double angle = 2.0 * M_PI * static_cast<double>(i) / (ConvexPolygon2d::max_size + 1);
+      xs.push_back(std::cos(angle));
+      ys.push_back(std::sin(angle));
+    }
+    ConvexPolygon2d polygon;
+    EXPECT_FALSE(setConvexPolygon2d(xs.data(), ys.data(), xs.size(), polygon));
+  }
+}
+
+TEST(convex_polygon2d, test_toConvexPolygon2d)
+{
+  using autoware_perception_msgs::msg::Shape;
+
+  const auto pose = createPose(1.0, -2.0, 0.7);
+  for (const auto & shape :
+       {createShape(Shape::BOUNDING_BOX, 4.0, 2.0), createShape(Shape::CYLINDER, 1.0, 1.0)}) {
+    ConvexPolygon2d polygon;
+    ASSERT_TRUE(toConvexPolygon2d(pose, shape, polygon));
+    EXPECT_NEAR(
+      polygon.area,
+      boost::geometry::area(autoware_utils_geometry::to_polygon2d(pose, shape)), 1e-9);
+  }
+}
+
+TEST(convex_polygon2d, test_getIntersectionArea)
+{
+  using autoware_perception_msgs::msg::Shape;
+
+  const auto shape = createShape(Shape::BOUNDING_BOX, 4.0, 2.0);
+  ConvexPolygon2d source;
+  ASSERT_TRUE(toConvexPolygon2d(createPose(0.0, 0.0, 0.0), shape, source));
+
+  {  // separated by the bounding circles
+    ConvexPolygon2d target;
+    ASSERT_TRUE(toConvexPolygon2d(createPose(10.0, 0.0, 0.0), shape, target));
+    EXPECT_DOUBLE_EQ(getIntersectionArea(source, target), 0.0);
+    EXPECT_DOUBLE_EQ(getConvexShapeArea(source, target), 28.0);
+  }
+
+  {  // same footprint
+    EXPECT_NEAR(getIntersectionArea(source, source), 8.0, 1e-9);
+    EXPECT_NEAR(getConvexShapeArea(source, source), 8.0, 1e-9);
+  }
+
+  // same result as boost up to the robustness of its intersection
+  for (const double yaw : {0.1, 0.5, 1.0, 2.0}) {
+    const auto target_pose = createPose(1.0, 0.5, yaw);
+    ConvexPolygon2d target;
+    ASSERT_TRUE(toConvexPolygon2d(target_pose, shape, target));
+
+    const auto source_polygon =
+      autoware_utils_geometry::to_polygon2d(createPose(0.0, 0.0, 0.0), shape);
+    const auto target_polygon = autoware_utils_geometry::to_polygon2d(target_pose, shape);
+    std::vector<autoware_utils_geometry::Polygon2d> intersection_polygons;
+    boost::geometry::intersection(source_polygon, target_polygon, intersection_polygons);
+    double expected_area = 0.0;
+    for (const auto & polygon : intersection_polygons) {
+      expected_area += boost::geometry::area(polygon);
+    }
+    EXPECT_NEAR(getIntersectionArea(source, target), expected_area, 1e-5);
+  }
+}
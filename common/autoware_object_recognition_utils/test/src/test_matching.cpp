@@ -20,6 +20,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <vector>
+
 using autoware_utils_geometry::Point2d;
 using autoware_utils_geometry::Point3d;
 
@@ -34,6 +37,41 @@ geometry_msgs::msg::Pose createPose(const double x, const double y, const double
   p.orientation = autoware_utils_geometry::create_quaternion_from_yaw(yaw);
   return p;
 }
+
+// the reference scores of the matrices are computed by boost.geometry, like the fallback for the
+// non convex footprints, instead of by the convex kernel used by the matrices
+double getBoostIoU(
+  const autoware_perception_msgs::msg::DetectedObject & source_object,
+  const autoware_perception_msgs::msg::DetectedObject & target_object)
+{
+  using autoware::object_recognition_utils::getIntersectionArea;
+  using autoware::object_recognition_utils::getUnionArea;
+  using autoware::object_recognition_utils::MIN_AREA;
+
+  const auto source_polygon = autoware_utils_geometry::to_polygon2d(source_object);
+  const auto target_polygon = autoware_utils_geometry::to_polygon2d(target_object);
+  const double intersection_area = getIntersectionArea(source_polygon, target_polygon);
+  if (intersection_area < MIN_AREA) return 0.0;
+  const double union_area = getUnionArea(source_polygon, target_polygon);
+  return std::min(1.0, intersection_area / union_area);
+}
+
+double getBoostGeneralizedIoU(
+  const autoware_perception_msgs::msg::DetectedObject & source_object,
+  const autoware_perception_msgs::msg::DetectedObject & target_object)
+{
+  using autoware::object_recognition_utils::getConvexShapeArea;
+  using autoware::object_recognition_utils::getIntersectionArea;
+  using autoware::object_recognition_utils::getUnionArea;
+
+  const auto source_polygon = autoware_utils_geometry::to_polygon2d(source_object);
+  const auto target_polygon = autoware_utils_geometry::to_polygon2d(target_object);
+  const double intersection_area = getIntersectionArea(source_polygon, target_polygon);
+  const double union_area = getUnionArea(source_polygon, target_polygon);
+  const double convex_shape_area = getConvexShapeArea(source_polygon, target_polygon);
+  return std::min(1.0, intersection_area / union_area) -
+         (convex_shape_area - union_area) / convex_shape_area;
+}
 }  // namespace
 
 TEST(matching, test_get2dIoU)
@@ -285,3 +323,59 @@ TEST(matching, test_get2dRecall)
     EXPECT_DOUBLE_EQ(reversed_recall, quart_circle * 4);
   }
 }
+
+TEST(matching, test_get2dIoUMatrix)
+{
+  using autoware::object_recognition_utils::get2dGeneralizedIoUMatrix;
+  using autoware::object_recognition_utils::get2dIoUMatrix;
+  using autoware_perception_msgs::msg::DetectedObject;
+
+  std::vector<DetectedObject> sources;
+  std::vector<DetectedObject> targets;
+  for (size_t i = 0; i < 5; ++i) {
+    DetectedObject obj;
+    const double offset = static_cast<double>(i);
+    obj.kinematics.pose_with_covariance.pose = createPose(0.4 * offset, 0.1 * offset, 0.3 * offset);
+    obj.shape.type = autoware_perception_msgs::msg::Shape::BOUNDING_BOX;
+    obj.shape.dimensions.x = 2.0;
+    obj.shape.dimensions.y = 1.0;
+    sources.push_back(obj);
+  }
+  for (size_t i = 0; i < 3; ++i) {
+    DetectedObject obj;
+    obj.kinematics.pose_with_covariance.pose = createPose(0.7 * static_cast<double>(i), 0.0, 0.0);
+    obj.shape.type = i == 1 ? autoware_perception_msgs::msg::Shape::CYLINDER
+                            : autoware_perception_msgs::msg::Shape::BOUNDING_BOX;
+    obj.shape.dimensions.x = 1.5;
+    obj.shape.dimensions.y = 1.0;
+    targets.push_back(obj);
+  }
+  {  // far from all the sources, so that the generalized IoU is negative
+    DetectedObject obj;
+    obj.kinematics.pose_with_covariance.pose = createPose(10.0, -3.0, 0.5);
+    obj.shape.type = autoware_perception_msgs::msg::Shape::BOUNDING_BOX;
+    obj.shape.dimensions.x = 1.5;
+    obj.shape.dimensions.y = 1.0;
+    targets.push_back(obj);
+  }
+
+  for (const size_t num_threads : {1, 4}) {
+    const auto iou_matrix = get2dIoUMatrix(sources, targets, 0.01, num_threads);
+    const auto giou_matrix = get2dGeneralizedIoUMatrix(sources, targets, num_threads);
+    ASSERT_EQ(iou_matrix.rows(), static_cast<int>(sources.size()));
+    ASSERT_EQ(iou_matrix.cols(), static_cast<int>(targets.size()));
+    ASSERT_EQ(giou_matrix.rows(), static_cast<int>(sources.size()));
+    ASSERT_EQ(giou_matrix.cols(), static_cast<int>(targets.size()));
+    for (size_t i = 0; i < sources.size(); ++i) {
+      for (size_t j = 0; j < targets.size(); ++j) {
+        EXPECT_NEAR(iou_matrix(i, j), getBoostIoU(sources.at(i), targets.at(j)), 1e-5);
+        EXPECT_NEAR(
+          giou_matrix(i, j), getBoostGeneralizedIoU(sources.at(i), targets.at(j)), 1e-5);
+      }
+    }
+  }
+
+  const auto empty_matrix = get2dIoUMatrix(std::vector<DetectedObject>{}, targets);
+  EXPECT_EQ(empty_matrix.rows(), 0);
+  EXPECT_EQ(empty_matrix.cols(), static_cast<int>(targets.size()));
+}
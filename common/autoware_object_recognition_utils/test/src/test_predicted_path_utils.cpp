@@ -297,3 +297,71 @@ TEST(predicted_path_utils, resamplePredictedPath_by_sampling_time)
     EXPECT_THROW(resamplePredictedPath(empty_path, 1.0, 10.0), std::invalid_argument);
   }
 }
+
+TEST(predicted_path_utils, PredictedPathResampler)
+{
+  using autoware::object_recognition_utils::PredictedPathResampler;
+  using autoware::object_recognition_utils::resamplePredictedPath;
+  using autoware_perception_msgs::msg::PredictedObjects;
+
+  const auto expect_same_path = [](const PredictedPath & expected, const PredictedPath & actual) {
+    ASSERT_EQ(expected.path.size(), actual.path.size());
+    EXPECT_EQ(expected.confidence, actual.confidence);
+    EXPECT_EQ(expected.time_step, actual.time_step);
+    for (size_t i = 0; i < expected.path.size(); ++i) {
+      EXPECT_EQ(expected.path.at(i), actual.path.at(i));
+    }
+  };
+
+  // Resample by vector
+  {
+    const auto path = createTestPredictedPath(10, 1.0, 1.0, 0.0, 0.1);
+    const std::vector<double> resampling_vec = {0.0, 0.1, 1.3, 2.8, 3.7, 5.1, 6.9, 8.5, 9.0};
+    PredictedPathResampler resampler;
+    PredictedPath resampled_path;
+    resampler.resample(path, resampling_vec, resampled_path);
+    expect_same_path(resamplePredictedPath(path, resampling_vec), resampled_path);
+
+    const std::vector<double> out_of_range_vec = {-1.0, 0.0, 5.0, 9.0, 9.1};
+    EXPECT_THROW(
+      resampler.resample(path, out_of_range_vec, resampled_path), std::invalid_argument);
+  }
+
+  // Resample every path of the objects
+  {
+    PredictedObjects objects;
+    objects.objects.resize(3);
+    std::vector<PredictedPath> paths;
+    for (size_t i = 0; i < objects.objects.size(); ++i) {
+      auto & predicted_paths = objects.objects.at(i).kinematics.predicted_paths;
+      predicted_paths.push_back(createTestPredictedPath(10, 1.0, 1.0, 0.0, 0.1));
+      predicted_paths.push_back(createTestPredictedPath(20 + i, 0.5, 2.0, 0.3, -0.05));
+      predicted_paths.push_back(createTestPredictedPath(5, 0.1, 1.0 + i));
+      paths.insert(paths.end(), predicted_paths.begin(), predicted_paths.end());
+    }
+
+    for (const bool use_spline_for_xy : {true, false}) {
+      auto resampled_objects = objects;
+      PredictedPathResampler resampler(use_spline_for_xy, true);
+      resampler.resample(resampled_objects, 0.3, 7.0);
+
+      size_t path_idx = 0;
+      for (const auto & object : resampled_objects.objects) {
+        for (const auto & resampled_path : object.kinematics.predicted_paths) {
+          expect_same_path(
+            resamplePredictedPath(paths.at(path_idx++), 0.3, 7.0, use_spline_for_xy, true),
+            resampled_path);
+        }
+      }
+    }
+
+    // the objects are not modified when a path cannot be resampled
+    auto invalid_objects = objects;
+    invalid_objects.objects.back().kinematics.predicted_paths.back().path.resize(1);
+    const auto original_objects = invalid_objects;
+    PredictedPathResampler resampler;
+    EXPECT_THROW(resampler.resample(invalid_objects, 0.3, 7.0), std::invalid_argument);
+    EXPECT_EQ(original_objects, invalid_objects);
+    EXPECT_THROW(resampler.resample(invalid_objects, 0.0, 7.0), std::invalid_argument);
+  }
+}
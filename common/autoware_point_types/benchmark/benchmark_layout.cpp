@@ -0,0 +1,78 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks of the layout check of a received point cloud, which the pointcloud nodes run per
+// message. "compare_fields" runs the four is_data_layout_compatible_with_*() checks, and
+// "cached_layout" gets the same verdicts from PointCloudLayoutCache.
+
+#include "autoware/point_types/layout.hpp"
+#include "autoware/point_types/memory.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using autoware::point_types::PointCloudLayoutCache;
+using sensor_msgs::msg::PointField;
+
+using FieldsGenerator = std::function<std::vector<PointField>()>;
+
+const std::vector<std::pair<std::string, FieldsGenerator>> layouts = {
+  {"XYZI", autoware::point_types::create_fields_point_xyzi},
+  {"XYZIRC", autoware::point_types::create_fields_point_xyzirc},
+  {"XYZIRADRT", autoware::point_types::create_fields_point_xyziradrt},
+  {"XYZIRCAEDT", autoware::point_types::create_fields_point_xyzircaedt},
+};
+
+void compareFields(benchmark::State & state, const FieldsGenerator & generate_fields)
+{
+  sensor_msgs::msg::PointCloud2 cloud;
+  cloud.fields = generate_fields();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+      autoware::point_types::is_data_layout_compatible_with_point_xyzi(cloud));
+    benchmark::DoNotOptimize(
+      autoware::point_types::is_data_layout_compatible_with_point_xyzirc(cloud));
+    benchmark::DoNotOptimize(
+      autoware::point_types::is_data_layout_compatible_with_point_xyziradrt(cloud));
+    benchmark::DoNotOptimize(
+      autoware::point_types::is_data_layout_compatible_with_point_xyzircaedt(cloud));
+  }
+}
+
+void cachedLayout(benchmark::State & state, const FieldsGenerator & generate_fields)
+{
+  sensor_msgs::msg::PointCloud2 cloud;
+  cloud.fields = generate_fields();
+  PointCloudLayoutCache cache;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cache.get(cloud));
+  }
+}
+
+[[maybe_unused]] const bool is_registered = []() {
+  for (const auto & [layout_name, generate_fields] : layouts) {
+    benchmark::RegisterBenchmark(
+      ("compare_fields/" + layout_name).c_str(), compareFields, generate_fields);
+    benchmark::RegisterBenchmark(
+      ("cached_layout/" + layout_name).c_str(), cachedLayout, generate_fields);
+  }
+  return true;
+}();
+}  // namespace
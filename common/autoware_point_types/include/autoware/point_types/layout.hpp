@@ -0,0 +1,176 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__POINT_TYPES__LAYOUT_HPP_
+#define AUTOWARE__POINT_TYPES__LAYOUT_HPP_
+
+#include "autoware/point_types/memory.hpp"
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/msg/point_field.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace autoware::point_types
+{
+
+/**
+ * @brief accessor of a field with a fixed offset in the point data
+ * @tparam T type of the field
+ */
+template <typename T>
+struct FieldAccessor
+{
+  std::int64_t offset{-1};
+
+  bool is_valid() const { return offset >= 0; }
+
+  T get(const std::uint8_t * point_data) const
+  {
+    T value;
+    std::memcpy(&value, point_data + offset, sizeof(T));
+    return value;
+  }
+
+  void set(std::uint8_t * point_data, const T value) const
+  {
+    std::memcpy(point_data + offset, &value, sizeof(T));
+  }
+};
+
+/**
+ * @brief compatibility of a field list with the point types, and the accessors of the coordinates
+ */
+struct PointCloudLayout
+{
+  std::uint64_t signature{0};
+
+  bool is_xyzi{false};
+  bool is_xyzirc{false};
+  bool is_xyziradrt{false};
+  bool is_xyzircaedt{false};
+
+  // valid only if the field is FLOAT32 with count 1
+  FieldAccessor<float> x;
+  FieldAccessor<float> y;
+  FieldAccessor<float> z;
+
+  bool has_xyz() const { return x.is_valid() && y.is_valid() && z.is_valid(); }
+};
+
+/**
+ * @brief calculate the FNV-1a hash of the names, offsets, datatypes and counts of the fields
+ */
+inline std::uint64_t calc_layout_signature(const std::vector<sensor_msgs::msg::PointField> & fields)
+{
+  constexpr std::uint64_t fnv_offset_basis = 14695981039346656037ULL;
+  constexpr std::uint64_t fnv_prime = 1099511628211ULL;
+
+  std::uint64_t hash = fnv_offset_basis;
+  const auto add = [&hash](const std::uint64_t value) {
+    hash ^= value;
+    hash *= fnv_prime;
+  };
+  for (const auto & field : fields) {
+    for (const char c : field.name) {
+      add(static_cast<std::uint8_t>(c));
+    }
+    add(field.offset);
+    add(field.datatype);
+    add(field.count);
+  }
+  add(fields.size());
+  return hash;
+}
+
+/**
+ * @brief check the compatibility of the fields with all the point types, and find the coordinates
+ */
+inline PointCloudLayout create_point_cloud_layout(
+  const std::vector<sensor_msgs::msg::PointField> & fields)
+{
+  PointCloudLayout layout;
+  layout.signature = calc_layout_signature(fields);
+  layout.is_xyzi = is_data_layout_compatible_with_point_xyzi(fields);
+  layout.is_xyzirc = is_data_layout_compatible_with_point_xyzirc(fields);
+  layout.is_xyziradrt = is_data_layout_compatible_with_point_xyziradrt(fields);
+  layout.is_xyzircaedt = is_data_layout_compatible_with_point_xyzircaedt(fields);
+
+  for (const auto & field : fields) {
+    if (field.datatype != sensor_msgs::msg::PointField::FLOAT32 || field.count != 1) {
+      continue;
+    }
+    if (field.name == "x") {
+      layout.x.offset = field.offset;
+    } else if (field.name == "y") {
+      layout.y.offset = field.offset;
+    } else if (field.name == "z") {
+      layout.z.offset = field.offset;
+    }
+  }
+  return layout;
+}
+
+/**
+ * @brief cache of the layouts of the received point clouds. The layout is created only for a new
+ * field list, but each get() still compares the field list of the message, including the names,
+ * with the last one, and hashes it if they differ. Look the layout up once per message.
+ */
+class PointCloudLayoutCache
+{
+public:
+  PointCloudLayout get(const std::vector<sensor_msgs::msg::PointField> & fields)
+  {
+    // a topic almost always keeps the same layout, so check the last one without hashing
+    if (last_entry_idx_ < entries_.size() && entries_[last_entry_idx_].fields == fields) {
+      return entries_[last_entry_idx_].layout;
+    }
+
+    const auto signature = calc_layout_signature(fields);
+    for (std::size_t i = 0; i < entries_.size(); ++i) {
+      if (entries_[i].layout.signature == signature && entries_[i].fields == fields) {
+        last_entry_idx_ = i;
+        return entries_[i].layout;
+      }
+    }
+
+    // the number of the layouts is small in practice, but keep the cache bounded
+    if (entries_.size() >= max_entry_num) {
+      entries_.clear();
+    }
+    entries_.push_back(Entry{fields, create_point_cloud_layout(fields)});
+    last_entry_idx_ = entries_.size() - 1;
+    return entries_.back().layout;
+  }
+
+  PointCloudLayout get(const sensor_msgs::msg::PointCloud2 & input) { return get(input.fields); }
+
+private:
+  static constexpr std::size_t max_entry_num = 8;
+
+  struct Entry
+  {
+    std::vector<sensor_msgs::msg::PointField> fields;
+    PointCloudLayout layout;
+  };
+  std::vector<Entry> entries_;
+  std::size_t last_entry_idx_{0};
+};
+
+}  // namespace autoware::point_types
+
+#endif  // AUTOWARE__POINT_TYPES__LAYOUT_HPP_
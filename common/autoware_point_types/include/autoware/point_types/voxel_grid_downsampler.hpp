@@ -0,0 +1,208 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__POINT_TYPES__VOXEL_GRID_DOWNSAMPLER_HPP_
+#define AUTOWARE__POINT_TYPES__VOXEL_GRID_DOWNSAMPLER_HPP_
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace autoware::point_types
+{
+
+/**
+ * @brief voxel grid filter which replaces the points in each voxel with their centroid, like
+ * pcl::VoxelGrid<pcl::PointXYZ>
+ * @details The points are accumulated into the voxels of an open addressing hash table in one pass,
+ * instead of sorting the points by voxel, so filter() is O(n). The table and the buffers keep their
+ * capacity between the calls and only the used slots are cleared, so a node which owns the filter
+ * does not allocate in the steady state. The centroids are output in the order of the first point
+ * of each voxel, which depends only on the input. The points with a non-finite coordinate, or
+ * outside of the int32 grid coordinates, are ignored.
+ */
+class VoxelGridDownsampler
+{
+public:
+  void set_leaf_size(const float leaf_size_x, const float leaf_size_y, const float leaf_size_z)
+  {
+    inverse_leaf_size_x_ = 1.0f / leaf_size_x;
+    inverse_leaf_size_y_ = 1.0f / leaf_size_y;
+    inverse_leaf_size_z_ = 1.0f / leaf_size_z;
+  }
+
+  /// @brief the voxels with fewer points are not output
+  void set_min_points_number_per_voxel(const std::size_t min_points_number_per_voxel)
+  {
+    min_points_number_per_voxel_ = min_points_number_per_voxel;
+  }
+
+  /// @note the output must not be the input
+  void filter(
+    const pcl::PointCloud<pcl::PointXYZ> & input, pcl::PointCloud<pcl::PointXYZ> & output)
+  {
+    clear_voxels();
+
+    const std::size_t point_num = input.points.size();
+    point_voxel_indices_.resize(point_num);
+    for (std::size_t i = 0; i < point_num; ++i) {
+      const auto & point = input.points[i];
+      const float grid_x = std::floor(point.x * inverse_leaf_size_x_);
+      const float grid_y = std::floor(point.y * inverse_leaf_size_y_);
+      const float grid_z = std::floor(point.z * inverse_leaf_size_z_);
+      // false for NaN and inf as well
+      if (!(
+            std::abs(grid_x) < max_grid_coordinate && std::abs(grid_y) < max_grid_coordinate &&
+            std::abs(grid_z) < max_grid_coordinate)) {
+        point_voxel_indices_[i] = -1;
+        continue;
+      }
+
+      const int voxel_idx = find_or_add_voxel(
+        static_cast<std::int32_t>(grid_x), static_cast<std::int32_t>(grid_y),
+        static_cast<std::int32_t>(grid_z));
+      auto & voxel = voxels_[voxel_idx];
+      voxel.sum_x += point.x;
+      voxel.sum_y += point.y;
+      voxel.sum_z += point.z;
+      ++voxel.point_num;
+      point_voxel_indices_[i] = voxel_idx;
+    }
+
+    output.clear();
+    output.header = input.header;
+    output.reserve(voxels_.size());
+    voxel_output_indices_.resize(voxels_.size());
+    for (std::size_t i = 0; i < voxels_.size(); ++i) {
+      const auto & voxel = voxels_[i];
+      if (voxel.point_num < min_points_number_per_voxel_) {
+        voxel_output_indices_[i] = -1;
+        continue;
+      }
+      voxel_output_indices_[i] = static_cast<int>(output.size());
+      const auto point_num_in_voxel = static_cast<float>(voxel.point_num);
+      output.push_back(pcl::PointXYZ(
+        voxel.sum_x / point_num_in_voxel, voxel.sum_y / point_num_in_voxel,
+        voxel.sum_z / point_num_in_voxel));
+    }
+    output.is_dense = true;
+
+    for (auto & index : point_voxel_indices_) {
+      if (index >= 0) {
+        index = voxel_output_indices_[index];
+      }
+    }
+  }
+
+  /**
+   * @brief index of the output centroid of each input point of the last filter(), -1 if the point
+   * is ignored or its voxel has too few points
+   */
+  const std::vector<int> & get_point_voxel_indices() const { return point_voxel_indices_; }
+
+private:
+  static constexpr std::size_t min_slot_num = 1024;
+  static constexpr float max_grid_coordinate = 2147483520.0f;  // the largest float below 2^31
+
+  struct Voxel
+  {
+    std::int32_t grid_x;
+    std::int32_t grid_y;
+    std::int32_t grid_z;
+    std::uint32_t point_num;
+    float sum_x;
+    float sum_y;
+    float sum_z;
+    std::size_t slot;
+  };
+
+  static std::size_t hash(const std::int32_t x, const std::int32_t y, const std::int32_t z)
+  {
+    std::uint64_t h = static_cast<std::uint32_t>(x) * 0x9E3779B97F4A7C15ULL;
+    h ^= static_cast<std::uint32_t>(y) * 0xC2B2AE3D27D4EB4FULL;
+    h ^= static_cast<std::uint32_t>(z) * 0x165667B19E3779F9ULL;
+    // mix the high bits into the low bits, which are used as the slot
+    h ^= h >> 32;
+    h *= 0xD6E8FEB86659FD93ULL;
+    h ^= h >> 32;
+    return static_cast<std::size_t>(h);
+  }
+
+  int find_or_add_voxel(const std::int32_t x, const std::int32_t y, const std::int32_t z)
+  {
+    // keep the load factor at most 0.5 so that the probe sequences are short
+    if ((voxels_.size() + 1) * 2 > slots_.size()) {
+      grow_slots();
+    }
+
+    const std::size_t mask = slots_.size() - 1;
+    for (std::size_t slot = hash(x, y, z) & mask;; slot = (slot + 1) & mask) {
+      const int voxel_idx = slots_[slot];
+      if (voxel_idx < 0) {
+        slots_[slot] = static_cast<int>(voxels_.size());
+        voxels_.push_back(Voxel{x, y, z, 0, 0.0f, 0.0f, 0.0f, slot});
+        return slots_[slot];
+      }
+      const auto & voxel = voxels_[voxel_idx];
+      if (voxel.grid_x == x && voxel.grid_y == y && voxel.grid_z == z) {
+        return voxel_idx;
+      }
+    }
+  }
+
+  void grow_slots()
+  {
+    slots_.assign(std::max(min_slot_num, slots_.size() * 2), -1);
+    const std::size_t mask = slots_.size() - 1;
+    for (std::size_t i = 0; i < voxels_.size(); ++i) {
+      auto & voxel = voxels_[i];
+      std::size_t slot = hash(voxel.grid_x, voxel.grid_y, voxel.grid_z) & mask;
+      while (slots_[slot] >= 0) {
+        slot = (slot + 1) & mask;
+      }
+      slots_[slot] = static_cast<int>(i);
+      voxel.slot = slot;
+    }
+  }
+
+  // O(number of the voxels of the last call) instead of O(number of the slots)
+  void clear_voxels()
+  {
+    for (const auto & voxel : voxels_) {
+      slots_[voxel.slot] = -1;
+    }
+    voxels_.clear();
+  }
+
+  float inverse_leaf_size_x_{1.0f};
+  float inverse_leaf_size_y_{1.0f};
+  float inverse_leaf_size_z_{1.0f};
+  std::size_t min_points_number_per_voxel_{0};
+
+  // index of the voxel in voxels_, -1 if empty. The size is a power of 2.
+  std::vector<int> slots_;
+  // in the order of the first points
+  std::vector<Voxel> voxels_;
+  std::vector<int> voxel_output_indices_;
+  std::vector<int> point_voxel_indices_;
+};
+
+}  // namespace autoware::point_types
+
+#endif  // AUTOWARE__POINT_TYPES__VOXEL_GRID_DOWNSAMPLER_HPP_
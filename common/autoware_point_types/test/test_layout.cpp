@@ -0,0 +1,135 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/point_types/layout.hpp"
+
+#include "autoware/point_types/memory.hpp"
+#include "autoware/point_types/types.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+using autoware::point_types::PointCloudLayout;
+using sensor_msgs::msg::PointField;
+
+void expectSameVerdict(const PointCloudLayout & layout, const std::vector<PointField> & fields)
+{
+  using autoware::point_types::is_data_layout_compatible_with_point_xyzi;
+  using autoware::point_types::is_data_layout_compatible_with_point_xyziradrt;
+  using autoware::point_types::is_data_layout_compatible_with_point_xyzirc;
+  using autoware::point_types::is_data_layout_compatible_with_point_xyzircaedt;
+
+  EXPECT_EQ(layout.is_xyzi, is_data_layout_compatible_with_point_xyzi(fields));
+  EXPECT_EQ(layout.is_xyzirc, is_data_layout_compatible_with_point_xyzirc(fields));
+  EXPECT_EQ(layout.is_xyziradrt, is_data_layout_compatible_with_point_xyziradrt(fields));
+  EXPECT_EQ(layout.is_xyzircaedt, is_data_layout_compatible_with_point_xyzircaedt(fields));
+}
+}  // namespace
+
+TEST(PointCloudLayout, SupportedLayouts)
+{
+  using autoware::point_types::create_point_cloud_layout;
+
+  const auto fields_xyzi = autoware::point_types::create_fields_point_xyzi();
+  const auto layout_xyzi = create_point_cloud_layout(fields_xyzi);
+  EXPECT_TRUE(layout_xyzi.is_xyzi);
+  expectSameVerdict(layout_xyzi, fields_xyzi);
+
+  const auto fields_xyzirc = autoware::point_types::create_fields_point_xyzirc();
+  const auto layout_xyzirc = create_point_cloud_layout(fields_xyzirc);
+  EXPECT_TRUE(layout_xyzirc.is_xyzirc);
+  expectSameVerdict(layout_xyzirc, fields_xyzirc);
+
+  const auto fields_xyziradrt = autoware::point_types::create_fields_point_xyziradrt();
+  const auto layout_xyziradrt = create_point_cloud_layout(fields_xyziradrt);
+  EXPECT_TRUE(layout_xyziradrt.is_xyziradrt);
+  expectSameVerdict(layout_xyziradrt, fields_xyziradrt);
+
+  const auto fields_xyzircaedt = autoware::point_types::create_fields_point_xyzircaedt();
+  const auto layout_xyzircaedt = create_point_cloud_layout(fields_xyzircaedt);
+  EXPECT_TRUE(layout_xyzircaedt.is_xyzircaedt);
+  expectSameVerdict(layout_xyzircaedt, fields_xyzircaedt);
+
+  for (const auto * layout :
+       {&layout_xyzi, &layout_xyzirc, &layout_xyziradrt, &layout_xyzircaedt}) {
+    EXPECT_TRUE(layout->has_xyz());
+    EXPECT_EQ(layout->x.offset, 0);
+    EXPECT_EQ(layout->y.offset, 4);
+    EXPECT_EQ(layout->z.offset, 8);
+  }
+}
+
+TEST(PointCloudLayout, UnsupportedLayout)
+{
+  auto fields = autoware::point_types::create_fields_point_xyzircaedt();
+  fields.at(2).datatype = PointField::FLOAT64;
+
+  const auto layout = autoware::point_types::create_point_cloud_layout(fields);
+  expectSameVerdict(layout, fields);
+  EXPECT_FALSE(layout.is_xyzircaedt);
+  EXPECT_FALSE(layout.has_xyz());
+  EXPECT_TRUE(layout.x.is_valid());
+  EXPECT_FALSE(layout.z.is_valid());
+}
+
+TEST(PointCloudLayout, Cache)
+{
+  autoware::point_types::PointCloudLayoutCache cache;
+
+  const auto fields_xyzirc = autoware::point_types::create_fields_point_xyzirc();
+  const auto fields_xyzircaedt = autoware::point_types::create_fields_point_xyzircaedt();
+  auto fields_renamed = fields_xyzircaedt;
+  fields_renamed.at(5).name = "ring";
+
+  // the cached layouts are the same as the created ones
+  for (int i = 0; i < 2; ++i) {
+    for (const auto & fields : {fields_xyzirc, fields_xyzircaedt, fields_renamed}) {
+      const auto layout = cache.get(fields);
+      EXPECT_EQ(layout.signature, autoware::point_types::calc_layout_signature(fields));
+      expectSameVerdict(layout, fields);
+    }
+  }
+  EXPECT_NE(
+    autoware::point_types::calc_layout_signature(fields_xyzircaedt),
+    autoware::point_types::calc_layout_signature(fields_renamed));
+
+  sensor_msgs::msg::PointCloud2 cloud;
+  cloud.fields = fields_xyzircaedt;
+  EXPECT_TRUE(cache.get(cloud).is_xyzircaedt);
+}
+
+TEST(PointCloudLayout, FieldAccessor)
+{
+  using autoware::point_types::PointXYZIRCAEDT;
+
+  const auto layout = autoware::point_types::create_point_cloud_layout(
+    autoware::point_types::create_fields_point_xyzircaedt());
+
+  PointXYZIRCAEDT point;
+  point.x = 1.0F;
+  point.y = 2.0F;
+  point.z = 3.0F;
+  auto * point_data = reinterpret_cast<std::uint8_t *>(&point);
+  EXPECT_FLOAT_EQ(layout.x.get(point_data), 1.0F);
+  EXPECT_FLOAT_EQ(layout.y.get(point_data), 2.0F);
+  EXPECT_FLOAT_EQ(layout.z.get(point_data), 3.0F);
+
+  layout.z.set(point_data, -3.0F);
+  EXPECT_FLOAT_EQ(point.z, -3.0F);
+  EXPECT_FLOAT_EQ(point.x, 1.0F);
+}
@@ -0,0 +1,169 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/point_types/voxel_grid_downsampler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+using autoware::point_types::VoxelGridDownsampler;
+using PointCloud = pcl::PointCloud<pcl::PointXYZ>;
+
+PointCloud createRandomPointCloud(const std::size_t point_num, const float range)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<float> distribution(-range, range);
+  PointCloud pointcloud;
+  for (std::size_t i = 0; i < point_num; ++i) {
+    pointcloud.push_back(
+      pcl::PointXYZ(distribution(engine), distribution(engine), distribution(engine)));
+  }
+  return pointcloud;
+}
+
+// reference with a std::map, which outputs the voxels in the order of their first points
+PointCloud downsample(const PointCloud & input, const float leaf_size)
+{
+  struct Sum
+  {
+    std::size_t order;
+    std::size_t point_num;
+    std::array<float, 3> sum;
+  };
+  std::map<std::array<int, 3>, Sum> voxels;
+  for (const auto & point : input.points) {
+    const std::array<int, 3> key{
+      static_cast<int>(std::floor(point.x / leaf_size)),
+      static_cast<int>(std::floor(point.y / leaf_size)),
+      static_cast<int>(std::floor(point.z / leaf_size))};
+    auto it = voxels.emplace(key, Sum{voxels.size(), 0, {0.0f, 0.0f, 0.0f}}).first;
+    ++it->second.point_num;
+    it->second.sum[0] += point.x;
+    it->second.sum[1] += point.y;
+    it->second.sum[2] += point.z;
+  }
+
+  PointCloud output;
+  output.resize(voxels.size());
+  for (const auto & [key, voxel] : voxels) {
+    const auto point_num = static_cast<float>(voxel.point_num);
+    output.points[voxel.order] =
+      pcl::PointXYZ(voxel.sum[0] / point_num, voxel.sum[1] / point_num, voxel.sum[2] / point_num);
+  }
+  return output;
+}
+
+void expectSamePoints(const PointCloud & actual, const PointCloud & expected)
+{
+  ASSERT_EQ(actual.size(), expected.size());
+  for (std::size_t i = 0; i < actual.size(); ++i) {
+    EXPECT_FLOAT_EQ(actual.points[i].x, expected.points[i].x);
+    EXPECT_FLOAT_EQ(actual.points[i].y, expected.points[i].y);
+    EXPECT_FLOAT_EQ(actual.points[i].z, expected.points[i].z);
+  }
+}
+}  // namespace
+
+TEST(VoxelGridDownsampler, Centroids)
+{
+  // a leaf size of a power of 2 so that the reference divides exactly like the filter
+  const auto input = createRandomPointCloud(10000, 8.0f);
+  VoxelGridDownsampler downsampler;
+  downsampler.set_leaf_size(0.5f, 0.5f, 0.5f);
+
+  PointCloud output;
+  downsampler.filter(input, output);
+  expectSamePoints(output, downsample(input, 0.5f));
+  EXPECT_EQ(output.width, output.size());
+  EXPECT_EQ(output.height, 1U);
+
+  // each point is in the voxel of its centroid
+  const auto & point_voxel_indices = downsampler.get_point_voxel_indices();
+  ASSERT_EQ(point_voxel_indices.size(), input.size());
+  for (std::size_t i = 0; i < input.size(); ++i) {
+    ASSERT_GE(point_voxel_indices[i], 0);
+    const auto & point = input.points[i];
+    const auto & centroid = output.points[point_voxel_indices[i]];
+    EXPECT_EQ(std::floor(point.x / 0.5f), std::floor(centroid.x / 0.5f));
+    EXPECT_EQ(std::floor(point.y / 0.5f), std::floor(centroid.y / 0.5f));
+    EXPECT_EQ(std::floor(point.z / 0.5f), std::floor(centroid.z / 0.5f));
+  }
+}
+
+TEST(VoxelGridDownsampler, MinPointsNumberPerVoxel)
+{
+  PointCloud input;
+  input.push_back(pcl::PointXYZ(0.1f, 0.1f, 0.1f));
+  input.push_back(pcl::PointXYZ(-0.1f, 0.1f, 0.1f));
+  input.push_back(pcl::PointXYZ(0.3f, 0.1f, 0.1f));
+  VoxelGridDownsampler downsampler;
+  downsampler.set_leaf_size(1.0f, 1.0f, 1.0f);
+  downsampler.set_min_points_number_per_voxel(2);
+
+  // the second point is in another voxel, which has too few points
+  PointCloud output;
+  downsampler.filter(input, output);
+  ASSERT_EQ(output.size(), 1U);
+  EXPECT_FLOAT_EQ(output.points[0].x, 0.2f);
+  EXPECT_EQ(downsampler.get_point_voxel_indices(), (std::vector<int>{0, -1, 0}));
+}
+
+TEST(VoxelGridDownsampler, NonFinitePoints)
+{
+  constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+  constexpr float inf = std::numeric_limits<float>::infinity();
+  PointCloud input;
+  input.push_back(pcl::PointXYZ(nan, 0.0f, 0.0f));
+  input.push_back(pcl::PointXYZ(1.0f, 1.0f, 1.0f));
+  input.push_back(pcl::PointXYZ(0.0f, -inf, 0.0f));
+  input.push_back(pcl::PointXYZ(0.0f, 0.0f, 1e30f));
+  VoxelGridDownsampler downsampler;
+  downsampler.set_leaf_size(1.0f, 1.0f, 1.0f);
+
+  PointCloud output;
+  downsampler.filter(input, output);
+  ASSERT_EQ(output.size(), 1U);
+  EXPECT_TRUE(output.is_dense);
+  EXPECT_EQ(downsampler.get_point_voxel_indices(), (std::vector<int>{-1, 0, -1, -1}));
+}
+
+// the table grown by a large input gives the same result for the following inputs
+TEST(VoxelGridDownsampler, ReusedAcrossCalls)
+{
+  const auto large_input = createRandomPointCloud(100000, 50.0f);
+  const auto small_input = createRandomPointCloud(1000, 2.0f);
+  VoxelGridDownsampler downsampler;
+  downsampler.set_leaf_size(0.25f, 0.25f, 0.25f);
+
+  PointCloud output;
+  downsampler.filter(small_input, output);
+  const auto first_output = output;
+  const auto first_point_voxel_indices = downsampler.get_point_voxel_indices();
+
+  downsampler.filter(large_input, output);
+  expectSamePoints(output, downsample(large_input, 0.25f));
+
+  downsampler.filter(small_input, output);
+  expectSamePoints(output, first_output);
+  EXPECT_EQ(downsampler.get_point_voxel_indices(), first_point_voxel_indices);
+}
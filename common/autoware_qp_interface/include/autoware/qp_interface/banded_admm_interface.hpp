@@ -0,0 +1,129 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__QP_INTERFACE__BANDED_ADMM_INTERFACE_HPP_
+#define AUTOWARE__QP_INTERFACE__BANDED_ADMM_INTERFACE_HPP_
+
+#include "autoware/qp_interface/banded_cholesky.hpp"
+#include "autoware/qp_interface/qp_interface.hpp"
+
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
+
+#include <string>
+#include <vector>
+
+namespace autoware::qp_interface
+{
+/// bounds whose absolute value is larger than this value are considered infinite
+constexpr double BANDED_ADMM_INF = 1e30;
+
+/**
+ * @brief ADMM solver for QPs whose KKT matrix is banded, e.g. problems defined along a path where
+ * the constraints only couple neighboring points
+ * @details The iterations are the same as OSQP (Ruiz equilibration, over-relaxation, adaptive rho)
+ * but the reduced KKT matrix P + sigma * I + A^T * diag(rho) * A is factorized with BandedCholesky,
+ * so the setup and every iteration are linear in the number of variables. The ordering is computed
+ * once for a sparsity pattern and reused while the pattern does not change, and the factorization
+ * is reused until rho is updated. There is no solution polishing.
+ */
+class BandedADMMInterface : public QPInterface
+{
+public:
+  explicit BandedADMMInterface(
+    const bool enable_warm_start = false, const int max_iteration = 4000,
+    const double eps_abs = 1e-4, const double eps_rel = 1e-4, const bool verbose = false);
+  ~BandedADMMInterface() override = default;
+
+  int getIterationNumber() const override;
+  bool isSolved() const override;
+  std::string getStatus() const override;
+
+  void updateEpsAbs(const double eps_abs) override;
+  void updateEpsRel(const double eps_rel) override;
+  void updateVerbose(const bool verbose) override;
+  void updateMaxIter(const int max_iteration) override;
+
+  /// @brief get the dual solution of the latest problem
+  std::vector<double> getDualSolution() const;
+  /// @brief get the bandwidth of the reordered KKT matrix of the latest problem
+  Eigen::Index getBandwidth() const { return kkt_.bandwidth(); }
+  /// @brief get the number of variables eliminated densely (not in the band)
+  Eigen::Index getBorderSize() const { return kkt_.borderSize(); }
+
+private:
+  enum class Status { NOT_RUN, SOLVED, MAX_ITER_REACHED, NUMERICAL_ERROR };
+
+  int max_iteration_;
+  double eps_abs_;
+  double eps_rel_;
+  bool verbose_;
+
+  // problem scaled by Ruiz equilibration: P = c * D * P * D, A = E * A * D, q = c * D * q
+  Eigen::SparseMatrix<double> P_;  // upper triangular part, as given to OSQP
+  Eigen::SparseMatrix<double> P_full_;
+  Eigen::SparseMatrix<double> A_;
+  Eigen::SparseMatrix<double, Eigen::RowMajor> A_rows_;
+  Eigen::VectorXd q_;
+  Eigen::VectorXd l_;
+  Eigen::VectorXd u_;
+  Eigen::VectorXd D_;
+  Eigen::VectorXd E_;
+  double c_{1.0};
+
+  // patterns of the last problem, to reuse the ordering of the KKT matrix
+  Eigen::SparseMatrix<double> P_pattern_;
+  Eigen::SparseMatrix<double> A_pattern_;
+  BandedCholesky kkt_;
+
+  double rho_{0.1};
+  Eigen::VectorXd rho_vec_;
+
+  // iterates in the scaled space
+  Eigen::VectorXd x_;
+  Eigen::VectorXd z_;
+  Eigen::VectorXd y_;
+  Eigen::VectorXd x_tilde_;
+  Eigen::VectorXd z_tilde_;
+  Eigen::VectorXd Ax_;
+  Eigen::VectorXd Px_;
+  Eigen::VectorXd Aty_;
+
+  // unscaled solution of the latest problem
+  Eigen::VectorXd x_solution_;
+  Eigen::VectorXd y_solution_;
+  Eigen::VectorXd z_solution_;
+
+  Status status_{Status::NOT_RUN};
+  int iteration_{0};
+
+  void initializeProblemImpl(
+    const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
+    const std::vector<double> & l, const std::vector<double> & u) override;
+
+  void initializeSparseProblemImpl(
+    const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+    const std::vector<double> & q, const std::vector<double> & l,
+    const std::vector<double> & u) override;
+
+  std::vector<double> optimizeImpl() override;
+
+  void analyzePattern();
+  void scaleProblem();
+  void updateRhoVector();
+  bool factorize();
+};
+}  // namespace autoware::qp_interface
+
+#endif  // AUTOWARE__QP_INTERFACE__BANDED_ADMM_INTERFACE_HPP_
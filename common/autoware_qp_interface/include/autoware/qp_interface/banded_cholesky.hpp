@@ -0,0 +1,100 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__QP_INTERFACE__BANDED_CHOLESKY_HPP_
+#define AUTOWARE__QP_INTERFACE__BANDED_CHOLESKY_HPP_
+
+#include <Eigen/Cholesky>
+#include <Eigen/Core>
+
+#include <vector>
+
+namespace autoware::qp_interface
+{
+/**
+ * @brief Cholesky factorization of a sparse symmetric positive definite matrix with a banded
+ * structure, possibly bordered by a few dense rows and columns
+ * @details The indices are reordered once by analyzePattern() with the reverse Cuthill-McKee
+ * algorithm. Indices connected to a large part of the matrix (e.g. a slack variable shared by all
+ * the constraints) would make the band as wide as the matrix, so they are moved to a dense border
+ * and eliminated with a Schur complement. The factorization costs O(n * w^2) and a solve O(n * w)
+ * for a bandwidth w and a small border.
+ *
+ *   1. analyzePattern(adjacency)       // once for a sparsity pattern
+ *   2. setZero(), addEntry(i, j, v)... // assemble the values in the original indices
+ *   3. factorize(), solve(rhs)...
+ */
+class BandedCholesky
+{
+public:
+  /**
+   * @brief compute the ordering and the band of the matrix
+   * @param adjacency off-diagonal nonzero indices of each row. The pattern must be symmetric.
+   */
+  void analyzePattern(const std::vector<std::vector<Eigen::Index>> & adjacency);
+
+  /// @brief reset the assembled values, keeping the analyzed pattern
+  void setZero();
+
+  /**
+   * @brief add a value to the (row, col) and (col, row) entries of the matrix
+   * @details each off-diagonal pair must be added only once. Throws std::invalid_argument if the
+   * entry is not in the analyzed pattern.
+   */
+  void addEntry(const Eigen::Index row, const Eigen::Index col, const double value);
+
+  /// @brief factorize the assembled matrix. Returns false if it is not positive definite.
+  bool factorize();
+
+  /// @brief solve K x = rhs in place with the last factorization
+  void solve(Eigen::Ref<Eigen::VectorXd> rhs);
+
+  Eigen::Index size() const { return static_cast<Eigen::Index>(position_.size()); }
+  Eigen::Index bandwidth() const { return bandwidth_; }
+  Eigen::Index borderSize() const { return static_cast<Eigen::Index>(border_.size()); }
+
+private:
+  // position of each original index in the band, or -(border index + 1) for the border
+  std::vector<Eigen::Index> position_;
+  // original index of each band position and of each border index
+  std::vector<Eigen::Index> band_;
+  std::vector<Eigen::Index> border_;
+  Eigen::Index bandwidth_{0};
+
+  // lower band stored by rows: (i, k) for i - w <= k <= i at i * (w + 1) + k - i + w
+  std::vector<double> band_values_;
+  // coupling between the band and the border, and K_band^-1 * coupling after factorization
+  Eigen::MatrixXd coupling_;
+  Eigen::MatrixXd solved_coupling_;
+  // border block, factorized as its Schur complement
+  Eigen::MatrixXd border_block_;
+  Eigen::LLT<Eigen::MatrixXd> schur_llt_;
+  Eigen::VectorXd band_rhs_;
+  Eigen::VectorXd border_rhs_;
+
+  double & bandValue(const Eigen::Index i, const Eigen::Index k)
+  {
+    return band_values_[i * (bandwidth_ + 1) + k - i + bandwidth_];
+  }
+  double bandValue(const Eigen::Index i, const Eigen::Index k) const
+  {
+    return band_values_[i * (bandwidth_ + 1) + k - i + bandwidth_];
+  }
+
+  bool factorizeBand();
+  void solveBand(Eigen::Ref<Eigen::VectorXd> rhs) const;
+};
+}  // namespace autoware::qp_interface
+
+#endif  // AUTOWARE__QP_INTERFACE__BANDED_CHOLESKY_HPP_
@@ -16,6 +16,7 @@
 #define AUTOWARE__QP_INTERFACE__OSQP_CSC_MATRIX_CONV_HPP_
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <osqp/glob_opts.h>
 
@@ -38,6 +39,15 @@ struct CSC_Matrix
 CSC_Matrix calCSCMatrix(const Eigen::MatrixXd & mat);
 /// \brief Calculate upper trapezoidal CSC matrix from square Eigen matrix
 CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::MatrixXd & mat);
+/// \brief Calculate CSC matrix from Eigen sparse matrix
+/// \details Every stored entry is kept, even if its value is zero, so that matrices built the
+/// same way always have the same sparsity pattern.
+CSC_Matrix calCSCMatrix(const Eigen::SparseMatrix<double> & mat);
+/// \brief Calculate upper trapezoidal CSC matrix from square Eigen sparse matrix
+/// \details Every stored entry of the upper triangular part is kept, even if its value is zero.
+CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::SparseMatrix<double> & mat);
+/// \brief Check if two CSC matrices have the same sparsity pattern
+bool hasSameStructure(const CSC_Matrix & lhs, const CSC_Matrix & rhs);
 /// \brief Print the given CSC matrix to the standard output
 void printCSCMatrix(const CSC_Matrix & csc_mat);
 
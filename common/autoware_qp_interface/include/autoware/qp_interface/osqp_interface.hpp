@@ -60,6 +60,7 @@ public:
 
   static void OSQPWorkspaceDeleter(OSQPWorkspace * ptr) noexcept;
 
+  using QPInterface::optimize;
   std::vector<double> optimize(
     CSC_Matrix P, CSC_Matrix A, const std::vector<double> & q, const std::vector<double> & l,
     const std::vector<double> & u);
@@ -92,7 +93,7 @@ public:
   void updateU(const std::vector<double> & u_new);
   void updateBounds(const std::vector<double> & l_new, const std::vector<double> & u_new);
 
-  void updateMaxIter(const int iter);
+  void updateMaxIter(const int iter) override;
   void updateRhoInterval(const int rho_interval);
   void updateRho(const double rho);
   void updateAlpha(const double alpha);
@@ -125,7 +126,15 @@ private:
   std::unique_ptr<OSQPWorkspace, std::function<void(OSQPWorkspace *)>> work_;
   std::unique_ptr<OSQPSettings> settings_;
   std::unique_ptr<OSQPData> data_;
-  // store last work info since work is cleaned up at every execution to prevent memory leak.
+  // problem of the current workspace, data_ points to these buffers
+  CSC_Matrix P_csc_;
+  CSC_Matrix A_csc_;
+  std::vector<double> q_;
+  std::vector<double> l_;
+  std::vector<double> u_;
+  // set when a setting used only by osqp_setup is changed, so that the next problem is set up again
+  bool setup_settings_changed_ = false;
+  // store last work info since it is overwritten by the next solution.
   OSQPInfo latest_work_info_;
   // Number of parameters to optimize
   int64_t param_n_;
@@ -138,6 +147,12 @@ private:
     const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
     const std::vector<double> & l, const std::vector<double> & u) override;
 
+  void initializeSparseProblemImpl(
+    const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+    const std::vector<double> & q, const std::vector<double> & l,
+    const std::vector<double> & u) override;
+
+  /// \brief Set up the problem, or only update its values if the workspace has the same structure
   void initializeCSCProblemImpl(
     CSC_Matrix P, CSC_Matrix A, const std::vector<double> & q, const std::vector<double> & l,
     const std::vector<double> & u);
@@ -42,15 +42,24 @@ public:
   void updateEpsAbs(const double eps_abs) override;
   void updateEpsRel(const double eps_rel) override;
   void updateVerbose(const bool verbose) override;
+  void updateMaxIter(const int max_iter) override;
 
 private:
   proxsuite::proxqp::Settings<double> settings_{};
   std::shared_ptr<proxsuite::proxqp::sparse::QP<double, int>> qp_ptr_{nullptr};
+  // matrices of the current problem, used to detect a change of the sparsity pattern
+  Eigen::SparseMatrix<double> P_sparse_;
+  Eigen::SparseMatrix<double> A_sparse_;
 
   void initializeProblemImpl(
     const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
     const std::vector<double> & l, const std::vector<double> & u) override;
 
+  void initializeSparseProblemImpl(
+    const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+    const std::vector<double> & q, const std::vector<double> & l,
+    const std::vector<double> & u) override;
+
   std::vector<double> optimizeImpl() override;
 };
 }  // namespace autoware::qp_interface
@@ -16,6 +16,7 @@
 #define AUTOWARE__QP_INTERFACE__QP_INTERFACE_HPP_
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <optional>
 #include <string>
@@ -23,6 +24,10 @@
 
 namespace autoware::qp_interface
 {
+/// @brief check if two compressed sparse matrices have the same size and sparsity pattern
+bool hasSameSparsityPattern(
+  const Eigen::SparseMatrix<double> & lhs, const Eigen::SparseMatrix<double> & rhs);
+
 class QPInterface
 {
 public:
@@ -33,6 +38,38 @@ public:
     const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
     const std::vector<double> & l, const std::vector<double> & u);
 
+  /**
+   * @brief solve the problem given in sparse form
+   * @details only the stored entries of P and A are used, so the setup cost is linear in the number
+   * of nonzeros. When the sparsity pattern (and the problem size) is the same as in the previous
+   * call, the backend updates the values of its internal problem instead of setting it up again.
+   * @param P (n,n) symmetric cost matrix with both triangular parts
+   * @param A (m,n) constraint matrix
+   */
+  std::vector<double> optimize(
+    const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+    const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u);
+
+  /**
+   * @brief solve the problem whose matrices are given as triplets
+   * @details duplicated triplets are summed. The sizes of the matrices are deduced from q and l.
+   */
+  std::vector<double> optimize(
+    const std::vector<Eigen::Triplet<double>> & P_triplets,
+    const std::vector<Eigen::Triplet<double>> & A_triplets, const std::vector<double> & q,
+    const std::vector<double> & l, const std::vector<double> & u);
+
+  /// @brief true if the last problem was solved by updating the values of the previous one
+  bool isStructureReused() const { return structure_reused_; }
+
+  /**
+   * @brief set the primal initial guess of the next problem
+   * @details the guess is used only by the next call of optimize(), and only when its size is the
+   * number of variables of that problem. It takes precedence over the warm start from the previous
+   * solution. Backends which do not support an initial guess ignore it.
+   */
+  void setInitialGuess(const std::vector<double> & x) { initial_guess_ = x; }
+
   virtual bool isSolved() const = 0;
   virtual int getIterationNumber() const = 0;
   virtual std::string getStatus() const = 0;
@@ -40,9 +77,12 @@ public:
   virtual void updateEpsAbs([[maybe_unused]] const double eps_abs) = 0;
   virtual void updateEpsRel([[maybe_unused]] const double eps_rel) = 0;
   virtual void updateVerbose([[maybe_unused]] const bool verbose) {}
+  virtual void updateMaxIter([[maybe_unused]] const int max_iter) {}
 
 protected:
   bool enable_warm_start_{false};
+  bool structure_reused_{false};
+  std::vector<double> initial_guess_;
 
   void initializeProblem(
     const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
@@ -52,6 +92,15 @@ protected:
     const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
     const std::vector<double> & l, const std::vector<double> & u) = 0;
 
+  void initializeSparseProblem(
+    const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+    const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u);
+
+  /// @brief set up the problem from sparse matrices, by default through the dense implementation
+  virtual void initializeSparseProblemImpl(
+    const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+    const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u);
+
   virtual std::vector<double> optimizeImpl() = 0;
 
   std::optional<size_t> variables_num_{std::nullopt};
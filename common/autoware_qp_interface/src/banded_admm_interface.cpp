@@ -0,0 +1,430 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/qp_interface/banded_admm_interface.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace autoware::qp_interface
+{
+namespace
+{
+// same default values as OSQP
+constexpr double sigma = 1e-6;
+constexpr double alpha = 1.6;
+constexpr double rho_default = 0.1;
+constexpr double rho_min = 1e-6;
+constexpr double rho_max = 1e6;
+constexpr double rho_eq_over_rho_ineq = 1e3;
+constexpr double rho_eq_tolerance = 1e-4;
+constexpr double adaptive_rho_tolerance = 5.0;
+constexpr int scaling_iteration = 10;
+constexpr double min_scaling = 1e-4;
+constexpr double max_scaling = 1e4;
+
+// the residuals are checked every check_termination iterations, and rho is updated every
+// adaptive_rho_interval iterations
+constexpr int check_termination = 5;
+constexpr int adaptive_rho_interval = 25;
+
+template <class Derived>
+double infNorm(const Eigen::MatrixBase<Derived> & v)
+{
+  double norm = 0.0;
+  for (Eigen::Index i = 0; i < v.size(); ++i) {
+    norm = std::max(norm, std::abs(v[i]));
+  }
+  return norm;
+}
+
+/// @brief limit the norm used for scaling, as in OSQP
+double limitScaling(const double norm)
+{
+  if (norm < min_scaling) {
+    return 1.0;
+  }
+  return std::min(norm, max_scaling);
+}
+
+double calcColumnScaling(const double norm)
+{
+  return 1.0 / std::sqrt(limitScaling(norm));
+}
+
+double toScaledBound(const double bound, const double scaling)
+{
+  if (bound <= -BANDED_ADMM_INF) {
+    return -std::numeric_limits<double>::infinity();
+  }
+  if (BANDED_ADMM_INF <= bound) {
+    return std::numeric_limits<double>::infinity();
+  }
+  return scaling * bound;
+}
+}  // namespace
+
+BandedADMMInterface::BandedADMMInterface(
+  const bool enable_warm_start, const int max_iteration, const double eps_abs, const double eps_rel,
+  const bool verbose)
+: QPInterface(enable_warm_start),
+  max_iteration_(max_iteration),
+  eps_abs_(eps_abs),
+  eps_rel_(eps_rel),
+  verbose_(verbose)
+{
+}
+
+void BandedADMMInterface::initializeProblemImpl(
+  const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
+  const std::vector<double> & l, const std::vector<double> & u)
+{
+  initializeSparseProblemImpl(P.sparseView(), A.sparseView(), q, l, u);
+}
+
+void BandedADMMInterface::initializeSparseProblemImpl(
+  const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+  const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u)
+{
+  const auto n = static_cast<Eigen::Index>(q.size());
+  const auto m = static_cast<Eigen::Index>(l.size());
+
+  // only the upper triangular part of P is used, as in OSQP
+  P_ = P.triangularView<Eigen::Upper>();
+  P_.makeCompressed();
+  A_ = A;
+  A_.makeCompressed();
+  q_ = Eigen::Map<const Eigen::VectorXd>(q.data(), n);
+  l_ = Eigen::Map<const Eigen::VectorXd>(l.data(), m);
+  u_ = Eigen::Map<const Eigen::VectorXd>(u.data(), m);
+
+  const bool is_same_structure =
+    hasSameSparsityPattern(P_, P_pattern_) && hasSameSparsityPattern(A_, A_pattern_);
+  if (!is_same_structure) {
+    P_pattern_ = P_;
+    A_pattern_ = A_;
+    analyzePattern();
+    // the adapted rho is kept for the next problem with the same structure
+    rho_ = rho_default;
+  }
+  structure_reused_ = is_same_structure;
+
+  scaleProblem();
+  P_full_ = P_.selfadjointView<Eigen::Upper>();
+  A_rows_ = A_;
+  updateRhoVector();
+
+  const bool warm_start = enable_warm_start_ && x_solution_.size() == n &&
+                          y_solution_.size() == m && status_ != Status::NUMERICAL_ERROR;
+  if (static_cast<Eigen::Index>(initial_guess_.size()) == n) {
+    // the constraint values of the guess are projected on the bounds, the dual starts from zero
+    x_ = Eigen::Map<const Eigen::VectorXd>(initial_guess_.data(), n).cwiseQuotient(D_);
+    z_ = (A_ * x_).cwiseMax(l_).cwiseMin(u_);
+    y_.setZero(m);
+  } else if (warm_start) {
+    x_ = x_solution_.cwiseQuotient(D_);
+    z_ = z_solution_.cwiseProduct(E_);
+    y_ = c_ * y_solution_.cwiseQuotient(E_);
+  } else {
+    x_.setZero(n);
+    z_.setZero(m);
+    y_.setZero(m);
+  }
+  x_tilde_.resize(n);
+  z_tilde_.resize(m);
+  Ax_.resize(m);
+  Px_.resize(n);
+  Aty_.resize(n);
+
+  status_ = Status::NOT_RUN;
+  iteration_ = 0;
+}
+
+void BandedADMMInterface::analyzePattern()
+{
+  // pattern of P + A^T * A
+  std::vector<std::vector<Eigen::Index>> adjacency(P_.rows());
+  for (Eigen::Index j = 0; j < P_.outerSize(); ++j) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(P_, j); it; ++it) {
+      if (it.row() != j) {
+        adjacency[it.row()].push_back(j);
+        adjacency[j].push_back(it.row());
+      }
+    }
+  }
+  const Eigen::SparseMatrix<double, Eigen::RowMajor> A_rows = A_;
+  for (Eigen::Index r = 0; r < A_rows.outerSize(); ++r) {
+    const auto begin = A_rows.outerIndexPtr()[r];
+    const auto end = A_rows.outerIndexPtr()[r + 1];
+    for (auto a = begin; a < end; ++a) {
+      for (auto b = a + 1; b < end; ++b) {
+        adjacency[A_rows.innerIndexPtr()[a]].push_back(A_rows.innerIndexPtr()[b]);
+        adjacency[A_rows.innerIndexPtr()[b]].push_back(A_rows.innerIndexPtr()[a]);
+      }
+    }
+  }
+  for (auto & neighbors : adjacency) {
+    std::sort(neighbors.begin(), neighbors.end());
+    neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+  }
+  kkt_.analyzePattern(adjacency);
+}
+
+void BandedADMMInterface::scaleProblem()
+{
+  const auto n = P_.rows();
+  const auto m = A_.rows();
+
+  D_.setOnes(n);
+  E_.setOnes(m);
+  c_ = 1.0;
+
+  Eigen::VectorXd D_iter(n);
+  Eigen::VectorXd E_iter(m);
+  for (int iter = 0; iter < scaling_iteration; ++iter) {
+    // equilibrate the columns of the KKT matrix [P A^T; A 0]
+    D_iter.setZero();
+    E_iter.setZero();
+    for (Eigen::Index j = 0; j < P_.outerSize(); ++j) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(P_, j); it; ++it) {
+        D_iter[j] = std::max(D_iter[j], std::abs(it.value()));
+        D_iter[it.row()] = std::max(D_iter[it.row()], std::abs(it.value()));
+      }
+    }
+    for (Eigen::Index j = 0; j < A_.outerSize(); ++j) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(A_, j); it; ++it) {
+        D_iter[j] = std::max(D_iter[j], std::abs(it.value()));
+        E_iter[it.row()] = std::max(E_iter[it.row()], std::abs(it.value()));
+      }
+    }
+    D_iter = D_iter.unaryExpr(&calcColumnScaling);
+    E_iter = E_iter.unaryExpr(&calcColumnScaling);
+
+    for (Eigen::Index j = 0; j < P_.outerSize(); ++j) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(P_, j); it; ++it) {
+        it.valueRef() *= D_iter[it.row()] * D_iter[j];
+      }
+    }
+    for (Eigen::Index j = 0; j < A_.outerSize(); ++j) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(A_, j); it; ++it) {
+        it.valueRef() *= E_iter[it.row()] * D_iter[j];
+      }
+    }
+    q_ = q_.cwiseProduct(D_iter);
+    D_ = D_.cwiseProduct(D_iter);
+    E_ = E_.cwiseProduct(E_iter);
+
+    // scale the cost by the mean norm of the columns of P
+    Eigen::VectorXd P_norm = Eigen::VectorXd::Zero(n);
+    for (Eigen::Index j = 0; j < P_.outerSize(); ++j) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(P_, j); it; ++it) {
+        P_norm[j] = std::max(P_norm[j], std::abs(it.value()));
+        P_norm[it.row()] = std::max(P_norm[it.row()], std::abs(it.value()));
+      }
+    }
+    const double P_mean_norm = n > 0 ? P_norm.mean() : 0.0;
+    const double c_iter = 1.0 / limitScaling(std::max(P_mean_norm, infNorm(q_)));
+    P_ *= c_iter;
+    q_ *= c_iter;
+    c_ *= c_iter;
+  }
+
+  for (Eigen::Index i = 0; i < m; ++i) {
+    l_[i] = toScaledBound(l_[i], E_[i]);
+    u_[i] = toScaledBound(u_[i], E_[i]);
+  }
+}
+
+void BandedADMMInterface::updateRhoVector()
+{
+  rho_vec_.resize(l_.size());
+  for (Eigen::Index i = 0; i < l_.size(); ++i) {
+    if (std::isinf(l_[i]) && std::isinf(u_[i])) {
+      rho_vec_[i] = rho_min;
+    } else if (u_[i] - l_[i] < rho_eq_tolerance) {
+      rho_vec_[i] = rho_eq_over_rho_ineq * rho_;
+    } else {
+      rho_vec_[i] = rho_;
+    }
+  }
+}
+
+bool BandedADMMInterface::factorize()
+{
+  // P + sigma * I + A^T * diag(rho) * A
+  kkt_.setZero();
+  for (Eigen::Index j = 0; j < P_.outerSize(); ++j) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(P_, j); it; ++it) {
+      kkt_.addEntry(it.row(), j, it.value());
+    }
+    kkt_.addEntry(j, j, sigma);
+  }
+  const auto * outer = A_rows_.outerIndexPtr();
+  const auto * inner = A_rows_.innerIndexPtr();
+  const auto * values = A_rows_.valuePtr();
+  for (Eigen::Index r = 0; r < A_rows_.outerSize(); ++r) {
+    for (auto a = outer[r]; a < outer[r + 1]; ++a) {
+      const double rho_value = rho_vec_[r] * values[a];
+      for (auto b = a; b < outer[r + 1]; ++b) {
+        kkt_.addEntry(inner[a], inner[b], rho_value * values[b]);
+      }
+    }
+  }
+  return kkt_.factorize();
+}
+
+std::vector<double> BandedADMMInterface::optimizeImpl()
+{
+  const auto n = x_.size();
+  const auto m = z_.size();
+
+  if (!factorize()) {
+    status_ = Status::NUMERICAL_ERROR;
+  } else {
+    status_ = Status::MAX_ITER_REACHED;
+    Ax_.noalias() = A_ * x_;
+  }
+
+  double prim_res = 0.0;
+  double dual_res = 0.0;
+  for (iteration_ = 1; status_ == Status::MAX_ITER_REACHED && iteration_ <= max_iteration_;
+       ++iteration_) {
+    // x_tilde = (P + sigma * I + A^T * diag(rho) * A)^-1 * (sigma * x - q + A^T * (rho * z - y))
+    z_tilde_ = rho_vec_.cwiseProduct(z_) - y_;
+    x_tilde_.noalias() = A_.transpose() * z_tilde_;
+    x_tilde_ += sigma * x_ - q_;
+    kkt_.solve(x_tilde_);
+    z_tilde_.noalias() = A_ * x_tilde_;
+
+    x_ = alpha * x_tilde_ + (1.0 - alpha) * x_;
+    Ax_ = alpha * z_tilde_ + (1.0 - alpha) * Ax_;
+    for (Eigen::Index i = 0; i < m; ++i) {
+      const double z_relaxed = alpha * z_tilde_[i] + (1.0 - alpha) * z_[i];
+      const double z_next = std::clamp(z_relaxed + y_[i] / rho_vec_[i], l_[i], u_[i]);
+      y_[i] += rho_vec_[i] * (z_relaxed - z_next);
+      z_[i] = z_next;
+    }
+
+    if (iteration_ % check_termination != 0 && iteration_ != max_iteration_) {
+      continue;
+    }
+
+    // residuals of the unscaled problem
+    Px_.noalias() = P_full_ * x_;
+    Aty_.noalias() = A_.transpose() * y_;
+    const double prim_norm =
+      std::max(infNorm(Ax_.cwiseQuotient(E_)), infNorm(z_.cwiseQuotient(E_)));
+    prim_res = infNorm((Ax_ - z_).cwiseQuotient(E_));
+    const double dual_norm =
+      std::max({infNorm(Px_.cwiseQuotient(D_)), infNorm(Aty_.cwiseQuotient(D_)),
+                infNorm(q_.cwiseQuotient(D_))}) /
+      c_;
+    dual_res = infNorm((Px_ + q_ + Aty_).cwiseQuotient(D_)) / c_;
+    if (
+      prim_res <= eps_abs_ + eps_rel_ * prim_norm && dual_res <= eps_abs_ + eps_rel_ * dual_norm) {
+      status_ = Status::SOLVED;
+      break;
+    }
+
+    if (iteration_ % adaptive_rho_interval != 0) {
+      continue;
+    }
+
+    // balance the relative residuals of the scaled problem
+    const double scaled_prim_res =
+      infNorm(Ax_ - z_) / (std::max(infNorm(Ax_), infNorm(z_)) + 1e-10);
+    const double scaled_dual_res =
+      infNorm(Px_ + q_ + Aty_) /
+      (std::max({infNorm(Px_), infNorm(Aty_), infNorm(q_)}) + 1e-10);
+    const double rho_estimate =
+      std::clamp(rho_ * std::sqrt(scaled_prim_res / (scaled_dual_res + 1e-10)), rho_min, rho_max);
+    if (
+      rho_estimate > rho_ * adaptive_rho_tolerance ||
+      rho_estimate < rho_ / adaptive_rho_tolerance) {
+      rho_ = rho_estimate;
+      updateRhoVector();
+      if (!factorize()) {
+        status_ = Status::NUMERICAL_ERROR;
+      }
+    }
+  }
+  iteration_ = std::min(iteration_, max_iteration_);
+
+  if (verbose_) {
+    std::cerr << "banded admm: " << getStatus() << ", iteration = " << iteration_
+              << ", primal residual = " << prim_res << ", dual residual = " << dual_res
+              << ", rho = " << rho_ << ", bandwidth = " << kkt_.bandwidth()
+              << ", border = " << kkt_.borderSize() << std::endl;
+  }
+
+  x_solution_ = x_.cwiseProduct(D_);
+  y_solution_ = y_.cwiseProduct(E_) / c_;
+  z_solution_ = z_.cwiseQuotient(E_);
+
+  return std::vector<double>(x_solution_.data(), x_solution_.data() + n);
+}
+
+void BandedADMMInterface::updateEpsAbs(const double eps_abs)
+{
+  eps_abs_ = eps_abs;
+}
+
+void BandedADMMInterface::updateEpsRel(const double eps_rel)
+{
+  eps_rel_ = eps_rel;
+}
+
+void BandedADMMInterface::updateVerbose(const bool verbose)
+{
+  verbose_ = verbose;
+}
+
+void BandedADMMInterface::updateMaxIter(const int max_iteration)
+{
+  max_iteration_ = max_iteration;
+}
+
+std::vector<double> BandedADMMInterface::getDualSolution() const
+{
+  return std::vector<double>(y_solution_.data(), y_solution_.data() + y_solution_.size());
+}
+
+int BandedADMMInterface::getIterationNumber() const
+{
+  return iteration_;
+}
+
+bool BandedADMMInterface::isSolved() const
+{
+  return status_ == Status::SOLVED;
+}
+
+std::string BandedADMMInterface::getStatus() const
+{
+  switch (status_) {
+    case Status::SOLVED:
+      return "BANDED_ADMM_SOLVED";
+    case Status::MAX_ITER_REACHED:
+      return "BANDED_ADMM_MAX_ITER_REACHED";
+    case Status::NUMERICAL_ERROR:
+      return "BANDED_ADMM_NUMERICAL_ERROR";
+    default:
+      return "BANDED_ADMM_NOT_RUN";
+  }
+}
+}  // namespace autoware::qp_interface
@@ -0,0 +1,251 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/qp_interface/banded_cholesky.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace autoware::qp_interface
+{
+void BandedCholesky::analyzePattern(const std::vector<std::vector<Eigen::Index>> & adjacency)
+{
+  const auto n = static_cast<Eigen::Index>(adjacency.size());
+  for (const auto & neighbors : adjacency) {
+    for (const auto j : neighbors) {
+      if (j < 0 || n <= j) {
+        std::stringstream ss;
+        ss << "The adjacency index " << j << " is out of range. size = " << n;
+        throw std::invalid_argument(ss.str());
+      }
+    }
+  }
+
+  // an index connected to more than this number of indices is moved to the border
+  const Eigen::Index max_band_degree = std::max<Eigen::Index>(16, n / 8);
+
+  std::vector<bool> is_border(n, false);
+  border_.clear();
+  for (Eigen::Index i = 0; i < n; ++i) {
+    if (static_cast<Eigen::Index>(adjacency[i].size()) > max_band_degree) {
+      is_border[i] = true;
+      border_.push_back(i);
+    }
+  }
+
+  std::vector<Eigen::Index> degree(n, 0);
+  for (Eigen::Index i = 0; i < n; ++i) {
+    if (is_border[i]) {
+      continue;
+    }
+    for (const auto j : adjacency[i]) {
+      if (j != i && !is_border[j]) {
+        ++degree[i];
+      }
+    }
+  }
+
+  // reverse Cuthill-McKee: breadth-first search from a low degree index of each component,
+  // visiting the neighbors by increasing degree
+  std::vector<Eigen::Index> candidates(n);
+  std::iota(candidates.begin(), candidates.end(), 0);
+  std::stable_sort(candidates.begin(), candidates.end(), [&](const auto lhs, const auto rhs) {
+    return degree[lhs] < degree[rhs];
+  });
+
+  std::vector<bool> visited = is_border;
+  band_.clear();
+  band_.reserve(n - border_.size());
+  std::vector<Eigen::Index> neighbors;
+  for (const auto start : candidates) {
+    if (visited[start]) {
+      continue;
+    }
+    visited[start] = true;
+    size_t head = band_.size();
+    band_.push_back(start);
+    while (head < band_.size()) {
+      const auto i = band_[head++];
+      neighbors.clear();
+      for (const auto j : adjacency[i]) {
+        if (!visited[j]) {
+          visited[j] = true;
+          neighbors.push_back(j);
+        }
+      }
+      std::stable_sort(neighbors.begin(), neighbors.end(), [&](const auto lhs, const auto rhs) {
+        return degree[lhs] < degree[rhs];
+      });
+      band_.insert(band_.end(), neighbors.begin(), neighbors.end());
+    }
+  }
+  std::reverse(band_.begin(), band_.end());
+
+  position_.assign(n, 0);
+  for (size_t p = 0; p < band_.size(); ++p) {
+    position_[band_[p]] = static_cast<Eigen::Index>(p);
+  }
+  for (size_t k = 0; k < border_.size(); ++k) {
+    position_[border_[k]] = -static_cast<Eigen::Index>(k) - 1;
+  }
+
+  bandwidth_ = 0;
+  for (const auto i : band_) {
+    for (const auto j : adjacency[i]) {
+      if (!is_border[j]) {
+        bandwidth_ = std::max(bandwidth_, std::abs(position_[i] - position_[j]));
+      }
+    }
+  }
+
+  const auto band_size = static_cast<Eigen::Index>(band_.size());
+  const auto border_size = static_cast<Eigen::Index>(border_.size());
+  band_values_.resize(band_size * (bandwidth_ + 1));
+  coupling_.resize(band_size, border_size);
+  solved_coupling_.resize(band_size, border_size);
+  border_block_.resize(border_size, border_size);
+  band_rhs_.resize(band_size);
+  border_rhs_.resize(border_size);
+  setZero();
+}
+
+void BandedCholesky::setZero()
+{
+  std::fill(band_values_.begin(), band_values_.end(), 0.0);
+  coupling_.setZero();
+  border_block_.setZero();
+}
+
+void BandedCholesky::addEntry(const Eigen::Index row, const Eigen::Index col, const double value)
+{
+  if (row < 0 || size() <= row || col < 0 || size() <= col) {
+    std::stringstream ss;
+    ss << "The entry (" << row << ", " << col << ") is out of range. size = " << size();
+    throw std::invalid_argument(ss.str());
+  }
+
+  const auto row_position = position_[row];
+  const auto col_position = position_[col];
+  if (0 <= row_position && 0 <= col_position) {
+    const auto upper = std::max(row_position, col_position);
+    const auto lower = std::min(row_position, col_position);
+    if (upper - lower > bandwidth_) {
+      std::stringstream ss;
+      ss << "The entry (" << row << ", " << col << ") is not in the analyzed pattern.";
+      throw std::invalid_argument(ss.str());
+    }
+    bandValue(upper, lower) += value;
+  } else if (0 <= row_position) {
+    coupling_(row_position, -col_position - 1) += value;
+  } else if (0 <= col_position) {
+    coupling_(col_position, -row_position - 1) += value;
+  } else {
+    border_block_(-row_position - 1, -col_position - 1) += value;
+    if (row != col) {
+      border_block_(-col_position - 1, -row_position - 1) += value;
+    }
+  }
+}
+
+bool BandedCholesky::factorize()
+{
+  if (!factorizeBand()) {
+    return false;
+  }
+  if (border_.empty()) {
+    return true;
+  }
+
+  // Schur complement of the band: C - B^T * K_band^-1 * B
+  solved_coupling_ = coupling_;
+  for (Eigen::Index k = 0; k < solved_coupling_.cols(); ++k) {
+    solveBand(solved_coupling_.col(k));
+  }
+  border_block_.noalias() -= coupling_.transpose() * solved_coupling_;
+  schur_llt_.compute(border_block_);
+  return schur_llt_.info() == Eigen::Success;
+}
+
+void BandedCholesky::solve(Eigen::Ref<Eigen::VectorXd> rhs)
+{
+  for (size_t p = 0; p < band_.size(); ++p) {
+    band_rhs_[p] = rhs[band_[p]];
+  }
+  solveBand(band_rhs_);
+
+  if (!border_.empty()) {
+    for (size_t k = 0; k < border_.size(); ++k) {
+      border_rhs_[k] = rhs[border_[k]];
+    }
+    border_rhs_.noalias() -= coupling_.transpose() * band_rhs_;
+    schur_llt_.solveInPlace(border_rhs_);
+    band_rhs_.noalias() -= solved_coupling_ * border_rhs_;
+    for (size_t k = 0; k < border_.size(); ++k) {
+      rhs[border_[k]] = border_rhs_[k];
+    }
+  }
+
+  for (size_t p = 0; p < band_.size(); ++p) {
+    rhs[band_[p]] = band_rhs_[p];
+  }
+}
+
+bool BandedCholesky::factorizeBand()
+{
+  // row-oriented Cholesky restricted to the band
+  const auto n = static_cast<Eigen::Index>(band_.size());
+  for (Eigen::Index i = 0; i < n; ++i) {
+    const Eigen::Index first = std::max<Eigen::Index>(0, i - bandwidth_);
+    for (Eigen::Index k = first; k <= i; ++k) {
+      double sum = bandValue(i, k);
+      for (Eigen::Index j = std::max(first, k - bandwidth_); j < k; ++j) {
+        sum -= bandValue(i, j) * bandValue(k, j);
+      }
+      if (k < i) {
+        bandValue(i, k) = sum / bandValue(k, k);
+      } else if (sum > 0.0 && std::isfinite(sum)) {
+        bandValue(i, i) = std::sqrt(sum);
+      } else {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void BandedCholesky::solveBand(Eigen::Ref<Eigen::VectorXd> rhs) const
+{
+  const auto n = static_cast<Eigen::Index>(band_.size());
+  // L * y = rhs
+  for (Eigen::Index i = 0; i < n; ++i) {
+    double sum = rhs[i];
+    for (Eigen::Index k = std::max<Eigen::Index>(0, i - bandwidth_); k < i; ++k) {
+      sum -= bandValue(i, k) * rhs[k];
+    }
+    rhs[i] = sum / bandValue(i, i);
+  }
+  // L^T * x = y
+  for (Eigen::Index i = n - 1; i >= 0; --i) {
+    double sum = rhs[i];
+    for (Eigen::Index k = i + 1; k <= std::min(n - 1, i + bandwidth_); ++k) {
+      sum -= bandValue(k, i) * rhs[k];
+    }
+    rhs[i] = sum / bandValue(i, i);
+  }
+}
+}  // namespace autoware::qp_interface
@@ -19,6 +19,7 @@
 
 #include <exception>
 #include <iostream>
+#include <stdexcept>
 #include <vector>
 
 namespace autoware::qp_interface
@@ -111,6 +112,59 @@ CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::MatrixXd & mat)
   return csc_matrix;
 }
 
+CSC_Matrix calCSCMatrix(const Eigen::SparseMatrix<double> & mat)
+{
+  const Eigen::Index cols = mat.cols();
+
+  CSC_Matrix csc_matrix;
+  csc_matrix.vals_.reserve(static_cast<size_t>(mat.nonZeros()));
+  csc_matrix.row_idxs_.reserve(static_cast<size_t>(mat.nonZeros()));
+  csc_matrix.col_idxs_.reserve(static_cast<size_t>(cols + 1));
+
+  csc_matrix.col_idxs_.push_back(0);
+  for (Eigen::Index j = 0; j < cols; j++) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(mat, j); it; ++it) {
+      csc_matrix.vals_.push_back(it.value());
+      csc_matrix.row_idxs_.push_back(static_cast<c_int>(it.row()));
+    }
+    csc_matrix.col_idxs_.push_back(static_cast<c_int>(csc_matrix.vals_.size()));
+  }
+
+  return csc_matrix;
+}
+
+CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::SparseMatrix<double> & mat)
+{
+  const Eigen::Index rows = mat.rows();
+  const Eigen::Index cols = mat.cols();
+
+  if (rows != cols) {
+    throw std::invalid_argument("Matrix must be square (n, n)");
+  }
+
+  CSC_Matrix csc_matrix;
+  csc_matrix.vals_.reserve(static_cast<size_t>(mat.nonZeros()));
+  csc_matrix.row_idxs_.reserve(static_cast<size_t>(mat.nonZeros()));
+  csc_matrix.col_idxs_.reserve(static_cast<size_t>(cols + 1));
+
+  csc_matrix.col_idxs_.push_back(0);
+  for (Eigen::Index j = 0; j < cols; j++) {
+    // row indices are sorted in each column, so the upper part ends at the diagonal
+    for (Eigen::SparseMatrix<double>::InnerIterator it(mat, j); it && it.row() <= j; ++it) {
+      csc_matrix.vals_.push_back(it.value());
+      csc_matrix.row_idxs_.push_back(static_cast<c_int>(it.row()));
+    }
+    csc_matrix.col_idxs_.push_back(static_cast<c_int>(csc_matrix.vals_.size()));
+  }
+
+  return csc_matrix;
+}
+
+bool hasSameStructure(const CSC_Matrix & lhs, const CSC_Matrix & rhs)
+{
+  return lhs.row_idxs_ == rhs.row_idxs_ && lhs.col_idxs_ == rhs.col_idxs_;
+}
+
 void printCSCMatrix(const CSC_Matrix & csc_mat)
 {
   std::cout << "[";
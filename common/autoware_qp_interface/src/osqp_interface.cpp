@@ -21,6 +21,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace autoware::qp_interface
@@ -81,17 +82,44 @@ void OSQPInterface::initializeProblemImpl(
   initializeCSCProblemImpl(P_csc, A_csc, q, l, u);
 }
 
+void OSQPInterface::initializeSparseProblemImpl(
+  const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+  const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u)
+{
+  initializeCSCProblemImpl(calCSCMatrixTrapezoidal(P), calCSCMatrix(A), q, l, u);
+}
+
 void OSQPInterface::initializeCSCProblemImpl(
   CSC_Matrix P_csc, CSC_Matrix A_csc, const std::vector<double> & q, const std::vector<double> & l,
   const std::vector<double> & u)
 {
-  // Dynamic float arrays
-  std::vector<double> q_tmp(q.begin(), q.end());
-  std::vector<double> l_tmp(l.begin(), l.end());
-  std::vector<double> u_tmp(u.begin(), u.end());
-  double * q_dyn = q_tmp.data();
-  double * l_dyn = l_tmp.data();
-  double * u_dyn = u_tmp.data();
+  const bool is_same_structure =
+    work__initialized && exitflag_ == 0 && !setup_settings_changed_ &&
+    data_->n == static_cast<c_int>(q.size()) && data_->m == static_cast<c_int>(l.size()) &&
+    hasSameStructure(P_csc, P_csc_) && hasSameStructure(A_csc, A_csc_);
+
+  P_csc_ = std::move(P_csc);
+  A_csc_ = std::move(A_csc);
+  q_.assign(q.begin(), q.end());
+  l_.assign(l.begin(), l.end());
+  u_.assign(u.begin(), u.end());
+
+  if (is_same_structure) {
+    // only the values are updated, the workspace (and the previous solution) is kept
+    exitflag_ = osqp_update_P_A(
+      work_.get(), P_csc_.vals_.data(), OSQP_NULL, static_cast<c_int>(P_csc_.vals_.size()),
+      A_csc_.vals_.data(), OSQP_NULL, static_cast<c_int>(A_csc_.vals_.size()));
+    if (exitflag_ == 0) {
+      exitflag_ = osqp_update_lin_cost(work_.get(), q_.data());
+    }
+    if (exitflag_ == 0) {
+      exitflag_ = osqp_update_bounds(work_.get(), l_.data(), u_.data());
+    }
+    if (exitflag_ == 0) {
+      structure_reused_ = true;
+      return;
+    }
+  }
 
   /**********************
    * OBJECTIVE FUNCTION
@@ -105,21 +133,24 @@ void OSQPInterface::initializeCSCProblemImpl(
   data_->n = param_n_;
   if (data_->P) free(data_->P);
   data_->P = csc_matrix(
-    data_->n, data_->n, static_cast<c_int>(P_csc.vals_.size()), P_csc.vals_.data(),
-    P_csc.row_idxs_.data(), P_csc.col_idxs_.data());
-  data_->q = q_dyn;
+    data_->n, data_->n, static_cast<c_int>(P_csc_.vals_.size()), P_csc_.vals_.data(),
+    P_csc_.row_idxs_.data(), P_csc_.col_idxs_.data());
+  data_->q = q_.data();
   if (data_->A) free(data_->A);
   data_->A = csc_matrix(
-    data_->m, data_->n, static_cast<c_int>(A_csc.vals_.size()), A_csc.vals_.data(),
-    A_csc.row_idxs_.data(), A_csc.col_idxs_.data());
-  data_->l = l_dyn;
-  data_->u = u_dyn;
+    data_->m, data_->n, static_cast<c_int>(A_csc_.vals_.size()), A_csc_.vals_.data(),
+    A_csc_.row_idxs_.data(), A_csc_.col_idxs_.data());
+  data_->l = l_.data();
+  data_->u = u_.data();
 
   // Setup workspace
-  OSQPWorkspace * workspace;
+  OSQPWorkspace * workspace = nullptr;
+  work_.reset();
   exitflag_ = osqp_setup(&workspace, data_.get(), settings_.get());
   work_.reset(workspace);
-  work__initialized = true;
+  work__initialized = work_ != nullptr;
+  setup_settings_changed_ = false;
+  structure_reused_ = false;
 }
 
 void OSQPInterface::OSQPWorkspaceDeleter(OSQPWorkspace * ptr) noexcept
@@ -164,6 +195,7 @@ void OSQPInterface::updateVerbose(const bool is_verbose)
 void OSQPInterface::updateRhoInterval(const int rho_interval)
 {
   settings_->adaptive_rho_interval = rho_interval;  // for default setting
+  setup_settings_changed_ = true;
 }
 
 void OSQPInterface::updateRho(const double rho)
@@ -185,6 +217,7 @@ void OSQPInterface::updateAlpha(const double alpha)
 void OSQPInterface::updateScaling(const int scaling)
 {
   settings_->scaling = scaling;
+  setup_settings_changed_ = true;
 }
 
 void OSQPInterface::updatePolish(const bool polish)
@@ -356,17 +389,25 @@ std::vector<double> OSQPInterface::getDualSolution() const
 
 std::vector<double> OSQPInterface::optimizeImpl()
 {
+  // NOTE: osqp_warm_start_x enables the warm start of the workspace, which is restored after
+  // solving so that the next problems follow the setting again.
+  const bool use_initial_guess =
+    work__initialized && initial_guess_.size() == static_cast<size_t>(param_n_) &&
+    osqp_warm_start_x(work_.get(), initial_guess_.data()) == 0;
+
   osqp_solve(work_.get());
 
+  if (use_initial_guess) {
+    work_->settings->warm_start = settings_->warm_start;
+  }
+
   double * sol_x = work_->solution->x;
   std::vector<double> sol_primal(sol_x, sol_x + param_n_);
 
   latest_work_info_ = *(work_->info);
 
-  if (!enable_warm_start_) {
-    work_.reset();
-    work__initialized = false;
-  }
+  // NOTE: The workspace is kept so that the next problem with the same structure only updates its
+  // values. When warm start is disabled, osqp_solve starts from zero (settings_->warm_start).
 
   return sol_primal;
 }
@@ -377,6 +418,7 @@ std::vector<double> OSQPInterface::optimize(
 {
   initializeCSCProblemImpl(P, A, q, l, u);
   const auto result = optimizeImpl();
+  initial_guess_.clear();
 
   // show polish status if not successful
   const int status_polish = static_cast<int>(latest_work_info_.status_polish);
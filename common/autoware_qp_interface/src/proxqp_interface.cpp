@@ -16,6 +16,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace autoware::qp_interface
@@ -36,56 +37,57 @@ ProxQPInterface::ProxQPInterface(
 void ProxQPInterface::initializeProblemImpl(
   const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
   const std::vector<double> & l, const std::vector<double> & u)
+{
+  initializeSparseProblemImpl(P.sparseView(), A.sparseView(), q, l, u);
+}
+
+void ProxQPInterface::initializeSparseProblemImpl(
+  const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+  const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u)
 {
   const size_t variables_num = q.size();
   const size_t constraints_num = l.size();
 
-  const bool enable_warm_start = [&]() {
-    if (
-      !enable_warm_start_  // Warm start is designated
-      || !qp_ptr_          // QP pointer is initialized
-      // The number of variables is the same as the previous one.
-      || !variables_num_ ||
-      *variables_num_ != variables_num
-      // The number of constraints is the same as the previous one
-      || !constraints_num_ || *constraints_num_ != constraints_num) {
-      return false;
-    }
-    return true;
-  }();
+  Eigen::SparseMatrix<double> P_sparse = P;
+  P_sparse.makeCompressed();
+  Eigen::SparseMatrix<double> A_sparse = A;
+  A_sparse.makeCompressed();
 
-  if (!enable_warm_start) {
+  // NOTE: the sparse solver can only update the values of a problem with the same sparsity pattern
+  const bool is_same_structure = qp_ptr_ && hasSameSparsityPattern(P_sparse, P_sparse_) &&
+                                 hasSameSparsityPattern(A_sparse, A_sparse_);
+
+  if (!is_same_structure) {
     qp_ptr_ = std::make_shared<proxsuite::proxqp::sparse::QP<double, int>>(
       variables_num, 0, constraints_num);
   }
 
-  settings_.initial_guess =
-    enable_warm_start ? proxsuite::proxqp::InitialGuessStatus::WARM_START_WITH_PREVIOUS_RESULT
-                      : proxsuite::proxqp::InitialGuessStatus::NO_INITIAL_GUESS;
+  if (initial_guess_.size() == variables_num) {
+    settings_.initial_guess = proxsuite::proxqp::InitialGuessStatus::WARM_START;
+  } else if (is_same_structure && enable_warm_start_) {
+    settings_.initial_guess =
+      proxsuite::proxqp::InitialGuessStatus::WARM_START_WITH_PREVIOUS_RESULT;
+  } else {
+    settings_.initial_guess = proxsuite::proxqp::InitialGuessStatus::NO_INITIAL_GUESS;
+  }
 
   qp_ptr_->settings = settings_;
 
-  Eigen::SparseMatrix<double> P_sparse(variables_num, constraints_num);
-  P_sparse = P.sparseView();
-
-  // NOTE: const std vector cannot be converted to eigen vector
-  std::vector<double> non_const_q = q;
-  Eigen::VectorXd eigen_q =
-    Eigen::Map<Eigen::VectorXd, Eigen::Unaligned>(non_const_q.data(), non_const_q.size());
-  std::vector<double> l_std_vec = l;
-  Eigen::VectorXd eigen_l =
-    Eigen::Map<Eigen::VectorXd, Eigen::Unaligned>(l_std_vec.data(), l_std_vec.size());
-  std::vector<double> u_std_vec = u;
-  Eigen::VectorXd eigen_u =
-    Eigen::Map<Eigen::VectorXd, Eigen::Unaligned>(u_std_vec.data(), u_std_vec.size());
-
-  if (enable_warm_start) {
+  const Eigen::Map<const Eigen::VectorXd> eigen_q(q.data(), static_cast<Eigen::Index>(q.size()));
+  const Eigen::Map<const Eigen::VectorXd> eigen_l(l.data(), static_cast<Eigen::Index>(l.size()));
+  const Eigen::Map<const Eigen::VectorXd> eigen_u(u.data(), static_cast<Eigen::Index>(u.size()));
+
+  if (is_same_structure) {
     qp_ptr_->update(
-      P_sparse, eigen_q, proxsuite::nullopt, proxsuite::nullopt, A.sparseView(), eigen_l, eigen_u);
+      P_sparse, eigen_q, proxsuite::nullopt, proxsuite::nullopt, A_sparse, eigen_l, eigen_u);
   } else {
     qp_ptr_->init(
-      P_sparse, eigen_q, proxsuite::nullopt, proxsuite::nullopt, A.sparseView(), eigen_l, eigen_u);
+      P_sparse, eigen_q, proxsuite::nullopt, proxsuite::nullopt, A_sparse, eigen_l, eigen_u);
   }
+
+  P_sparse_ = std::move(P_sparse);
+  A_sparse_ = std::move(A_sparse);
+  structure_reused_ = is_same_structure;
 }
 
 void ProxQPInterface::updateEpsAbs(const double eps_abs)
@@ -103,6 +105,11 @@ void ProxQPInterface::updateVerbose(const bool is_verbose)
   settings_.verbose = is_verbose;
 }
 
+void ProxQPInterface::updateMaxIter(const int max_iter)
+{
+  settings_.max_iter = max_iter;
+}
+
 bool ProxQPInterface::isSolved() const
 {
   if (qp_ptr_) {
@@ -146,7 +153,15 @@ std::string ProxQPInterface::getStatus() const
 
 std::vector<double> ProxQPInterface::optimizeImpl()
 {
-  qp_ptr_->solve();
+  if (settings_.initial_guess == proxsuite::proxqp::InitialGuessStatus::WARM_START) {
+    // the dual variables start from zero
+    const Eigen::VectorXd x = Eigen::Map<const Eigen::VectorXd>(
+      initial_guess_.data(), static_cast<Eigen::Index>(initial_guess_.size()));
+    const Eigen::Ref<const Eigen::VectorXd> x_ref(x);
+    qp_ptr_->solve(x_ref, proxsuite::nullopt, proxsuite::nullopt);
+  } else {
+    qp_ptr_->solve();
+  }
 
   std::vector<double> result;
   result.reserve(qp_ptr_->results.x.size());
@@ -14,14 +14,20 @@
 
 #include "autoware/qp_interface/qp_interface.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
 namespace autoware::qp_interface
 {
-void QPInterface::initializeProblem(
-  const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
+namespace
+{
+template <class PMatrix, class AMatrix>
+void checkProblemSize(
+  const PMatrix & P, const AMatrix & A, const std::vector<double> & q,
   const std::vector<double> & l, const std::vector<double> & u)
 {
   // check if arguments are valid
@@ -51,18 +57,106 @@ void QPInterface::initializeProblem(
        << ", u.size() = " << u.size();
     throw std::invalid_argument(ss.str());
   }
+}
+
+void checkTriplets(
+  const std::vector<Eigen::Triplet<double>> & triplets, const Eigen::Index rows,
+  const Eigen::Index cols, const std::string & name)
+{
+  for (const auto & triplet : triplets) {
+    if (
+      triplet.row() < 0 || rows <= triplet.row() || triplet.col() < 0 || cols <= triplet.col()) {
+      std::stringstream ss;
+      ss << "A triplet of " << name << " is out of range. (row, col) = (" << triplet.row() << ", "
+         << triplet.col() << "), size = (" << rows << ", " << cols << ")";
+      throw std::invalid_argument(ss.str());
+    }
+  }
+}
+}  // namespace
+
+bool hasSameSparsityPattern(
+  const Eigen::SparseMatrix<double> & lhs, const Eigen::SparseMatrix<double> & rhs)
+{
+  if (
+    lhs.rows() != rhs.rows() || lhs.cols() != rhs.cols() || lhs.nonZeros() != rhs.nonZeros() ||
+    !lhs.isCompressed() || !rhs.isCompressed()) {
+    return false;
+  }
+  return std::equal(
+           lhs.outerIndexPtr(), lhs.outerIndexPtr() + lhs.outerSize() + 1, rhs.outerIndexPtr()) &&
+         std::equal(lhs.innerIndexPtr(), lhs.innerIndexPtr() + lhs.nonZeros(), rhs.innerIndexPtr());
+}
+
+void QPInterface::initializeProblem(
+  const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
+  const std::vector<double> & l, const std::vector<double> & u)
+{
+  checkProblemSize(P, A, q, l, u);
 
+  structure_reused_ = false;
   initializeProblemImpl(P, A, q, l, u);
 
   variables_num_ = q.size();
   constraints_num_ = l.size();
 }
 
+void QPInterface::initializeSparseProblem(
+  const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+  const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u)
+{
+  checkProblemSize(P, A, q, l, u);
+
+  structure_reused_ = false;
+  initializeSparseProblemImpl(P, A, q, l, u);
+
+  variables_num_ = q.size();
+  constraints_num_ = l.size();
+}
+
+void QPInterface::initializeSparseProblemImpl(
+  const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+  const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u)
+{
+  initializeProblemImpl(Eigen::MatrixXd(P), Eigen::MatrixXd(A), q, l, u);
+}
+
 std::vector<double> QPInterface::optimize(
   const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
   const std::vector<double> & l, const std::vector<double> & u)
 {
   initializeProblem(P, A, q, l, u);
-  return optimizeImpl();
+  auto result = optimizeImpl();
+  initial_guess_.clear();
+  return result;
+}
+
+std::vector<double> QPInterface::optimize(
+  const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+  const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u)
+{
+  initializeSparseProblem(P, A, q, l, u);
+  auto result = optimizeImpl();
+  initial_guess_.clear();
+  return result;
+}
+
+std::vector<double> QPInterface::optimize(
+  const std::vector<Eigen::Triplet<double>> & P_triplets,
+  const std::vector<Eigen::Triplet<double>> & A_triplets, const std::vector<double> & q,
+  const std::vector<double> & l, const std::vector<double> & u)
+{
+  const auto variables_num = static_cast<Eigen::Index>(q.size());
+  const auto constraints_num = static_cast<Eigen::Index>(l.size());
+
+  checkTriplets(P_triplets, variables_num, variables_num, "P");
+  checkTriplets(A_triplets, constraints_num, variables_num, "A");
+
+  Eigen::SparseMatrix<double> P(variables_num, variables_num);
+  P.setFromTriplets(P_triplets.begin(), P_triplets.end());
+  Eigen::SparseMatrix<double> A(constraints_num, variables_num);
+  A.setFromTriplets(A_triplets.begin(), A_triplets.end());
+
+  return optimize(P, A, q, l, u);
 }
 }  // namespace autoware::qp_interface
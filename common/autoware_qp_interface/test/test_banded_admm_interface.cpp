@@ -0,0 +1,181 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/qp_interface/banded_admm_interface.hpp"
+#include "autoware/qp_interface/osqp_interface.hpp"
+#include "gtest/gtest.h"
+
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Same problem as in test_osqp_interface.cpp
+//
+// P = [4, 1], q = [1], A = [1, 1], lb = [   1], ub = [1.0]
+//     [1, 2]      [1]      [1, 0]       [   0]       [0.7]
+//                          [0, 1]       [   0]       [0.7]
+//                          [0, 1]       [-inf]       [inf]
+//
+// The optimal solution is
+// x = [0.3, 0.7]'
+// y = [-2.9, 0.0, 0.2, 0.0]`
+TEST(TestBandedADMMInterface, BasicQp)
+{
+  auto check_result = [](const auto & solution, const std::string & status) {
+    EXPECT_EQ(status, "BANDED_ADMM_SOLVED");
+
+    static const auto ep = 1.0e-6;
+    ASSERT_EQ(solution.size(), size_t(2));
+    EXPECT_NEAR(solution[0], 0.3, ep);
+    EXPECT_NEAR(solution[1], 0.7, ep);
+  };
+
+  const Eigen::MatrixXd P = (Eigen::MatrixXd(2, 2) << 4, 1, 1, 2).finished();
+  const Eigen::MatrixXd A = (Eigen::MatrixXd(4, 2) << 1, 1, 1, 0, 0, 1, 0, 1).finished();
+  const std::vector<double> q = {1.0, 1.0};
+  const std::vector<double> l = {1.0, 0.0, 0.0, -std::numeric_limits<double>::max()};
+  const std::vector<double> u = {1.0, 0.7, 0.7, std::numeric_limits<double>::max()};
+
+  {
+    autoware::qp_interface::BandedADMMInterface admm(false, 10000, 1e-9, 1e-9);
+    const auto solution = admm.QPInterface::optimize(P, A, q, l, u);
+    check_result(solution, admm.getStatus());
+    EXPECT_TRUE(admm.isSolved());
+    EXPECT_FALSE(admm.isStructureReused());
+
+    const auto dual = admm.getDualSolution();
+    ASSERT_EQ(dual.size(), size_t(4));
+    EXPECT_NEAR(dual[0], -2.9, 1e-5);
+    EXPECT_NEAR(dual[2], 0.2, 1e-5);
+  }
+
+  {
+    // the second problem reuses the ordering and starts from the previous solution
+    autoware::qp_interface::BandedADMMInterface admm(true, 10000, 1e-9, 1e-9);
+    const auto solution = admm.QPInterface::optimize(P, A, q, l, u);
+    check_result(solution, admm.getStatus());
+    const int first_iteration = admm.getIterationNumber();
+
+    const auto solution_warm = admm.QPInterface::optimize(P, A, q, l, u);
+    check_result(solution_warm, admm.getStatus());
+    EXPECT_TRUE(admm.isStructureReused());
+    EXPECT_LT(admm.getIterationNumber(), first_iteration);
+  }
+
+  {
+    // the initial guess is used only by the next problem. The first problem is solved twice since
+    // the adapted rho is kept for the problems with the same structure.
+    autoware::qp_interface::BandedADMMInterface admm(false, 10000, 1e-9, 1e-9);
+    admm.QPInterface::optimize(P, A, q, l, u);
+    const auto solution = admm.QPInterface::optimize(P, A, q, l, u);
+    const int cold_iteration = admm.getIterationNumber();
+
+    admm.setInitialGuess(solution);
+    const auto solution_guess = admm.QPInterface::optimize(P, A, q, l, u);
+    check_result(solution_guess, admm.getStatus());
+    EXPECT_LT(admm.getIterationNumber(), cold_iteration);
+
+    admm.QPInterface::optimize(P, A, q, l, u);
+    EXPECT_EQ(admm.getIterationNumber(), cold_iteration);
+
+    // a guess of another size is ignored
+    admm.setInitialGuess({0.0});
+    check_result(admm.QPInterface::optimize(P, A, q, l, u), admm.getStatus());
+    EXPECT_EQ(admm.getIterationNumber(), cold_iteration);
+  }
+
+  {
+    autoware::qp_interface::BandedADMMInterface admm(false, 1, 1e-9, 1e-9);
+    admm.QPInterface::optimize(P, A, q, l, u);
+    EXPECT_FALSE(admm.isSolved());
+    EXPECT_EQ(admm.getStatus(), "BANDED_ADMM_MAX_ITER_REACHED");
+  }
+}
+
+// Smoothing of a squared velocity profile along a path, as in the pseudo-jerk smoothers:
+// min sum (b_i - b_max_i)^2 + w * sum (b_{i+1} - b_i)^2 s.t. b_min <= b_{i+1} - b_i <= b_max,
+// 0 <= b_i <= b_max_i and b_0 fixed
+TEST(TestBandedADMMInterface, MatchOSQPOnChainProblem)
+{
+  const int N = 200;
+  std::vector<double> b_max(N);
+  for (int i = 0; i < N; ++i) {
+    b_max[i] = (i / 40) % 2 == 0 ? 100.0 : 25.0;
+  }
+  b_max.back() = 0.0;
+
+  const double w = 10.0;
+  std::vector<Eigen::Triplet<double>> P_triplets;
+  std::vector<Eigen::Triplet<double>> A_triplets;
+  std::vector<double> q(N);
+  std::vector<double> l;
+  std::vector<double> u;
+  for (int i = 0; i < N; ++i) {
+    const double diagonal = (i == 0 || i == N - 1) ? 1.0 + w : 1.0 + 2.0 * w;
+    P_triplets.emplace_back(i, i, 2.0 * diagonal);
+    if (i + 1 < N) {
+      P_triplets.emplace_back(i, i + 1, -2.0 * w);
+      P_triplets.emplace_back(i + 1, i, -2.0 * w);
+    }
+    q[i] = -2.0 * b_max[i];
+
+    A_triplets.emplace_back(static_cast<int>(l.size()), i, 1.0);
+    l.push_back(i == 0 ? 50.0 : 0.0);
+    u.push_back(i == 0 ? 50.0 : b_max[i]);
+  }
+  for (int i = 0; i + 1 < N; ++i) {
+    const int row = static_cast<int>(l.size());
+    A_triplets.emplace_back(row, i, -1.0);
+    A_triplets.emplace_back(row, i + 1, 1.0);
+    l.push_back(-4.0);
+    u.push_back(2.0);
+  }
+
+  Eigen::SparseMatrix<double> P(N, N);
+  P.setFromTriplets(P_triplets.begin(), P_triplets.end());
+  Eigen::SparseMatrix<double> A(static_cast<Eigen::Index>(l.size()), N);
+  A.setFromTriplets(A_triplets.begin(), A_triplets.end());
+
+  autoware::qp_interface::OSQPInterface osqp(false, 20000, 1e-8, 1e-8);
+  const auto expected = osqp.optimize(P, A, q, l, u);
+  ASSERT_TRUE(osqp.isSolved());
+
+  autoware::qp_interface::BandedADMMInterface admm(false, 20000, 1e-8, 1e-8);
+  const auto solution = admm.optimize(P, A, q, l, u);
+  ASSERT_TRUE(admm.isSolved());
+  EXPECT_LE(admm.getBandwidth(), 2);
+  EXPECT_EQ(admm.getBorderSize(), 0);
+
+  ASSERT_EQ(solution.size(), expected.size());
+  for (size_t i = 0; i < solution.size(); ++i) {
+    EXPECT_NEAR(solution[i], expected[i], 1e-4);
+  }
+
+  // same pattern with other bounds
+  std::fill(u.begin() + N, u.end(), 3.0);
+  const auto expected_new = osqp.optimize(P, A, q, l, u);
+  const auto solution_new = admm.optimize(P, A, q, l, u);
+  ASSERT_TRUE(admm.isSolved());
+  EXPECT_TRUE(admm.isStructureReused());
+  for (size_t i = 0; i < solution_new.size(); ++i) {
+    EXPECT_NEAR(solution_new[i], expected_new[i], 1e-4);
+  }
+}
+}  // namespace
@@ -0,0 +1,121 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/qp_interface/banded_cholesky.hpp"
+#include "gtest/gtest.h"
+
+#include <Eigen/Cholesky>
+#include <Eigen/Core>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+// tridiagonal matrix with the indices shuffled, bordered by one index connected to all the others
+struct BorderedProblem
+{
+  Eigen::MatrixXd K;
+  std::vector<std::vector<Eigen::Index>> adjacency;
+};
+
+BorderedProblem makeBorderedProblem(const Eigen::Index n)
+{
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+  std::vector<Eigen::Index> order(n - 1);
+  for (Eigen::Index i = 0; i < n - 1; ++i) {
+    order[i] = i;
+  }
+  std::shuffle(order.begin(), order.end(), gen);
+
+  BorderedProblem problem;
+  problem.K = Eigen::MatrixXd::Zero(n, n);
+  problem.adjacency.resize(n);
+  const auto connect = [&](const Eigen::Index i, const Eigen::Index j) {
+    const double value = dist(gen);
+    problem.K(i, j) = value;
+    problem.K(j, i) = value;
+    problem.adjacency[i].push_back(j);
+    problem.adjacency[j].push_back(i);
+  };
+  for (Eigen::Index i = 0; i + 1 < n - 1; ++i) {
+    connect(order[i], order[i + 1]);
+  }
+  for (Eigen::Index i = 0; i < n - 1; ++i) {
+    connect(i, n - 1);
+  }
+  // diagonally dominant to be positive definite
+  for (Eigen::Index i = 0; i < n; ++i) {
+    problem.K(i, i) = problem.K.row(i).cwiseAbs().sum() + 1.0;
+  }
+  return problem;
+}
+}  // namespace
+
+TEST(TestBandedCholesky, SolveBorderedProblem)
+{
+  const Eigen::Index n = 100;
+  const auto problem = makeBorderedProblem(n);
+
+  autoware::qp_interface::BandedCholesky cholesky;
+  cholesky.analyzePattern(problem.adjacency);
+  EXPECT_EQ(cholesky.size(), n);
+  EXPECT_EQ(cholesky.bandwidth(), 1);
+  EXPECT_EQ(cholesky.borderSize(), 1);
+
+  cholesky.setZero();
+  for (Eigen::Index i = 0; i < n; ++i) {
+    for (Eigen::Index j = 0; j <= i; ++j) {
+      if (problem.K(i, j) != 0.0) {
+        cholesky.addEntry(i, j, problem.K(i, j));
+      }
+    }
+  }
+  ASSERT_TRUE(cholesky.factorize());
+
+  const Eigen::VectorXd rhs = Eigen::VectorXd::LinSpaced(n, -1.0, 1.0);
+  Eigen::VectorXd x = rhs;
+  cholesky.solve(x);
+
+  const Eigen::VectorXd expected = problem.K.llt().solve(rhs);
+  for (Eigen::Index i = 0; i < n; ++i) {
+    EXPECT_NEAR(x(i), expected(i), 1e-10);
+  }
+}
+
+TEST(TestBandedCholesky, NotPositiveDefinite)
+{
+  autoware::qp_interface::BandedCholesky cholesky;
+  cholesky.analyzePattern({{1}, {0}});
+  cholesky.setZero();
+  cholesky.addEntry(0, 0, 1.0);
+  cholesky.addEntry(1, 0, 2.0);
+  cholesky.addEntry(1, 1, 1.0);
+  EXPECT_FALSE(cholesky.factorize());
+}
+
+TEST(TestBandedCholesky, EntryOutOfPattern)
+{
+  // path graph 0 - 1 - 2 - 3 - 4: the band does not contain (0, 4)
+  autoware::qp_interface::BandedCholesky cholesky;
+  cholesky.analyzePattern({{1}, {0, 2}, {1, 3}, {2, 4}, {3}});
+  EXPECT_EQ(cholesky.bandwidth(), 1);
+  EXPECT_THROW(cholesky.addEntry(0, 4, 1.0), std::invalid_argument);
+  EXPECT_THROW(cholesky.addEntry(0, 5, 1.0), std::invalid_argument);
+  EXPECT_THROW(cholesky.analyzePattern({{1}, {2}}), std::invalid_argument);
+}
@@ -16,6 +16,7 @@
 #include "gtest/gtest.h"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <string>
 #include <tuple>
@@ -164,6 +165,49 @@ TEST(TestCscMatrixConv, Trapezoidal)
     EXPECT_EQ(e.what(), std::string("Matrix must be square (n, n)"));
   }
 }
+TEST(TestCscMatrixConv, Sparse)
+{
+  using autoware::qp_interface::calCSCMatrix;
+  using autoware::qp_interface::calCSCMatrixTrapezoidal;
+  using autoware::qp_interface::CSC_Matrix;
+  using autoware::qp_interface::hasSameStructure;
+
+  auto expect_same = [](const CSC_Matrix & lhs, const CSC_Matrix & rhs) {
+    EXPECT_EQ(lhs.vals_, rhs.vals_);
+    EXPECT_EQ(lhs.row_idxs_, rhs.row_idxs_);
+    EXPECT_EQ(lhs.col_idxs_, rhs.col_idxs_);
+  };
+
+  Eigen::MatrixXd square(3, 3);
+  Eigen::MatrixXd rect(2, 3);
+  square << 0.0, 2.0, 0.0, 4.0, 5.0, 6.0, 0.0, 6.0, 1.0;
+  rect << 0.0, 1.0, 3.0, 2.0, 0.0, 0.0;
+
+  // without explicit zeros, the result is the same as the dense conversion
+  const Eigen::SparseMatrix<double> square_sparse = square.sparseView();
+  const Eigen::SparseMatrix<double> rect_sparse = rect.sparseView();
+  expect_same(calCSCMatrixTrapezoidal(square), calCSCMatrixTrapezoidal(square_sparse));
+  expect_same(calCSCMatrix(rect), calCSCMatrix(rect_sparse));
+
+  // explicit zeros are kept
+  Eigen::SparseMatrix<double> rect_with_zero = rect_sparse;
+  rect_with_zero.insert(1, 1) = 0.0;
+  const CSC_Matrix rect_m = calCSCMatrix(rect_with_zero);
+  ASSERT_EQ(rect_m.vals_.size(), size_t(4));
+  EXPECT_EQ(rect_m.row_idxs_, (std::vector<c_int>{1, 0, 1, 0}));
+  EXPECT_EQ(rect_m.col_idxs_, (std::vector<c_int>{0, 1, 3, 4}));
+  EXPECT_FALSE(hasSameStructure(rect_m, calCSCMatrix(rect)));
+
+  Eigen::SparseMatrix<double> rect_scaled = rect_with_zero * 2.0;
+  EXPECT_TRUE(hasSameStructure(rect_m, calCSCMatrix(rect_scaled)));
+
+  try {
+    const CSC_Matrix rect_m1 = calCSCMatrixTrapezoidal(rect_sparse);
+    FAIL() << "calCSCMatrixTrapezoidal should fail with non-square inputs";
+  } catch (const std::invalid_argument & e) {
+    EXPECT_EQ(e.what(), std::string("Matrix must be square (n, n)"));
+  }
+}
 TEST(TestCscMatrixConv, Print)
 {
   using autoware::qp_interface::calCSCMatrix;
@@ -16,6 +16,7 @@
 #include "gtest/gtest.h"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <iostream>
 #include <string>
@@ -162,9 +163,8 @@ TEST(TestOsqpInterface, BasicQp)
       check_result(solution, status, polish_status);
     }
 
-    // NOTE: This should be true, but currently optimize function reset the workspace, which
-    // disables warm start.
-    // EXPECT_EQ(osqp.getTakenIter(), 1);
+    // the workspace is kept, so the values given to setWarmStart are used
+    EXPECT_TRUE(osqp.isStructureReused());
   }
 }
 
@@ -259,4 +259,60 @@ TEST(TestOsqpInterface, UpdateSettingsAfterInitialization)
   EXPECT_EQ(status, "OSQP_SOLVED");
 }
 
+TEST(TestOsqpInterface, SparseQp)
+{
+  auto check_result = [](const auto & solution, const bool is_solved) {
+    EXPECT_TRUE(is_solved);
+
+    static const auto ep = 1.0e-6;
+    ASSERT_EQ(solution.size(), size_t(2));
+    EXPECT_NEAR(solution[0], 0.3, ep);
+    EXPECT_NEAR(solution[1], 0.7, ep);
+  };
+
+  const std::vector<Eigen::Triplet<double>> P_triplets = {
+    {0, 0, 4.0}, {0, 1, 1.0}, {1, 0, 1.0}, {1, 1, 2.0}};
+  const std::vector<Eigen::Triplet<double>> A_triplets = {
+    {0, 0, 1.0}, {0, 1, 1.0}, {1, 0, 1.0}, {2, 1, 1.0}, {3, 1, 1.0}};
+  const std::vector<double> q = {1.0, 1.0};
+  const std::vector<double> l = {1.0, 0.0, 0.0, -autoware::qp_interface::OSQP_INF};
+  const std::vector<double> u = {1.0, 0.7, 0.7, autoware::qp_interface::OSQP_INF};
+
+  autoware::qp_interface::OSQPInterface osqp(false, 4000, 1e-9, 1e-9);
+  {
+    const auto solution = osqp.optimize(P_triplets, A_triplets, q, l, u);
+    check_result(solution, osqp.isSolved());
+    EXPECT_FALSE(osqp.isStructureReused());
+  }
+  {
+    // same sparsity pattern with other values: x = [0.3, 0.7] is still the solution
+    Eigen::SparseMatrix<double> P(2, 2);
+    P.setFromTriplets(P_triplets.begin(), P_triplets.end());
+    P *= 2.0;
+    Eigen::SparseMatrix<double> A(4, 2);
+    A.setFromTriplets(A_triplets.begin(), A_triplets.end());
+    const std::vector<double> q_new = {2.0, 2.0};
+    const auto solution = osqp.optimize(P, A, q_new, l, u);
+    check_result(solution, osqp.isSolved());
+    EXPECT_TRUE(osqp.isStructureReused());
+  }
+  {
+    // an explicitly stored zero keeps the pattern even if the value vanishes
+    std::vector<Eigen::Triplet<double>> P_triplets_zero = P_triplets;
+    P_triplets_zero.at(1) = {0, 1, 0.0};
+    P_triplets_zero.at(2) = {1, 0, 0.0};
+    osqp.optimize(P_triplets_zero, A_triplets, q, l, u);
+    EXPECT_TRUE(osqp.isSolved());
+    EXPECT_TRUE(osqp.isStructureReused());
+  }
+  {
+    // the dense conversion drops the zeros, so the pattern is different
+    const Eigen::MatrixXd P = (Eigen::MatrixXd(2, 2) << 4, 0, 0, 2).finished();
+    const Eigen::MatrixXd A = (Eigen::MatrixXd(4, 2) << 1, 1, 1, 0, 0, 1, 0, 1).finished();
+    osqp.optimize(P, A, q, l, u);
+    EXPECT_TRUE(osqp.isSolved());
+    EXPECT_FALSE(osqp.isStructureReused());
+  }
+}
+
 }  // namespace
@@ -16,6 +16,7 @@
 #include "gtest/gtest.h"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <limits>
 #include <string>
@@ -91,4 +92,51 @@ TEST(TestProxqpInterface, BasicQp)
     }
   }
 }
+
+TEST(TestProxqpInterface, SparseQp)
+{
+  auto check_result = [](const auto & solution, const std::string & status) {
+    EXPECT_EQ(status, "PROXQP_SOLVED");
+
+    static const auto ep = 1.0e-8;
+    ASSERT_EQ(solution.size(), size_t(2));
+    EXPECT_NEAR(solution[0], 0.3, ep);
+    EXPECT_NEAR(solution[1], 0.7, ep);
+  };
+
+  const std::vector<Eigen::Triplet<double>> P_triplets = {
+    {0, 0, 4.0}, {0, 1, 1.0}, {1, 0, 1.0}, {1, 1, 2.0}};
+  const std::vector<Eigen::Triplet<double>> A_triplets = {
+    {0, 0, 1.0}, {0, 1, 1.0}, {1, 0, 1.0}, {2, 1, 1.0}, {3, 1, 1.0}};
+  const std::vector<double> q = {1.0, 1.0};
+  const std::vector<double> l = {1.0, 0.0, 0.0, -std::numeric_limits<double>::max()};
+  const std::vector<double> u = {1.0, 0.7, 0.7, std::numeric_limits<double>::max()};
+
+  autoware::qp_interface::ProxQPInterface proxqp(false, 4000, 1e-9, 1e-9, false);
+  {
+    const auto solution = proxqp.optimize(P_triplets, A_triplets, q, l, u);
+    check_result(solution, proxqp.getStatus());
+    EXPECT_FALSE(proxqp.isStructureReused());
+  }
+  {
+    // same sparsity pattern with other values: x = [0.3, 0.7] is still the solution
+    Eigen::SparseMatrix<double> P(2, 2);
+    P.setFromTriplets(P_triplets.begin(), P_triplets.end());
+    P *= 2.0;
+    Eigen::SparseMatrix<double> A(4, 2);
+    A.setFromTriplets(A_triplets.begin(), A_triplets.end());
+    const std::vector<double> q_new = {2.0, 2.0};
+    const auto solution = proxqp.optimize(P, A, q_new, l, u);
+    check_result(solution, proxqp.getStatus());
+    EXPECT_TRUE(proxqp.isStructureReused());
+  }
+  {
+    // the dense problem does not store the zeros of P, so its pattern is different
+    const Eigen::MatrixXd P = (Eigen::MatrixXd(2, 2) << 4, 0, 0, 2).finished();
+    const Eigen::MatrixXd A = (Eigen::MatrixXd(4, 2) << 1, 1, 1, 0, 0, 1, 0, 1).finished();
+    proxqp.QPInterface::optimize(P, A, q, l, u);
+    EXPECT_EQ(proxqp.getStatus(), "PROXQP_SOLVED");
+    EXPECT_FALSE(proxqp.isStructureReused());
+  }
+}
 }  // namespace
@@ -132,4 +132,16 @@ TEST(QPInterfaceTest, Optimize_ValidInputs_ReturnsResult)
   EXPECT_EQ(result.size(), 2);
 }
 
+TEST(QPInterfaceTest, Optimize_TripletOutOfRange_ThrowsException)
+{
+  std::vector<Eigen::Triplet<double>> P_triplets = {{0, 0, 1.0}, {1, 1, 1.0}};
+  std::vector<Eigen::Triplet<double>> A_triplets = {{0, 0, 1.0}, {0, 2, 1.0}};
+  std::vector<double> q = {1.0, 2.0};
+  std::vector<double> l = {1.0};
+  std::vector<double> u = {1.0};
+
+  OSQPInterface osqp;
+  EXPECT_THROW(osqp.optimize(P_triplets, A_triplets, q, l, u), std::invalid_argument);
+}
+
 }  // namespace autoware::qp_interface
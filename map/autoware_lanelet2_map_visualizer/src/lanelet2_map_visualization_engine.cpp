@@ -0,0 +1,454 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_visualization_engine.hpp"
+
+#include <autoware_lanelet2_extension/visualization/visualization.hpp>
+#include <rclcpp/serialization.hpp>
+#include <rclcpp/serialized_message.hpp>
+
+#include <std_msgs/msg/color_rgba.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace autoware::lanelet2_map_visualizer
+{
+namespace
+{
+// increment when the content of the generated markers changes to invalidate existing caches
+constexpr int marker_cache_format_version = 1;
+constexpr std::string_view marker_cache_file_prefix = "lanelet2_map_marker_";
+constexpr std::string_view marker_cache_file_suffix = ".bin";
+
+std_msgs::msg::ColorRGBA create_color(double r, double g, double b, double a)
+{
+  std_msgs::msg::ColorRGBA cl;
+  cl.r = static_cast<float>(r);
+  cl.g = static_cast<float>(g);
+  cl.b = static_cast<float>(b);
+  cl.a = static_cast<float>(a);
+  return cl;
+}
+
+/// @brief add the regulatory element to the output if it has the given type and was not added yet
+template <class ConstPtr>
+void add_unique_regulatory_element(
+  const lanelet::RegulatoryElementConstPtr & reg_elem, std::unordered_set<lanelet::Id> & added_ids,
+  std::vector<ConstPtr> & reg_elems)
+{
+  auto typed_reg_elem = std::dynamic_pointer_cast<typename ConstPtr::element_type>(reg_elem);
+  if (typed_reg_elem && added_ids.insert(typed_reg_elem->id()).second) {
+    reg_elems.push_back(typed_reg_elem);
+  }
+}
+}  // namespace
+
+ClassifiedLaneletMap classify_lanelet_map(const lanelet::LaneletMapConstPtr & lanelet_map)
+{
+  ClassifiedLaneletMap classified;
+
+  std::unordered_set<lanelet::Id> aw_tl_ids;
+  std::unordered_set<lanelet::Id> da_ids;
+  std::unordered_set<lanelet::Id> no_ids;
+  std::unordered_set<lanelet::Id> sb_ids;
+  std::unordered_set<lanelet::Id> cw_ids;
+  std::unordered_set<lanelet::Id> no_parking_ids;
+  std::unordered_set<lanelet::Id> bus_stop_ids;
+  for (const auto & ll : lanelet_map->laneletLayer) {
+    const lanelet::ConstLanelet const_ll = ll;
+    const std::string subtype = const_ll.attributeOr(lanelet::AttributeName::Subtype, "none");
+    if (subtype == lanelet::AttributeValueString::Road) {
+      classified.road_lanelets.push_back(const_ll);
+    } else if (subtype == "road_shoulder") {
+      classified.shoulder_lanelets.push_back(const_ll);
+    } else if (subtype == lanelet::AttributeValueString::Crosswalk) {
+      classified.crosswalk_lanelets.push_back(const_ll);
+    } else if (subtype == "walkway") {
+      classified.walkway_lanelets.push_back(const_ll);
+    } else if (subtype == "bicycle_lane") {
+      classified.bicycle_lane_lanelets.push_back(const_ll);
+    }
+
+    for (const auto & reg_elem : const_ll.regulatoryElements()) {
+      add_unique_regulatory_element(reg_elem, aw_tl_ids, classified.aw_tl_reg_elems);
+      add_unique_regulatory_element(reg_elem, da_ids, classified.da_reg_elems);
+      add_unique_regulatory_element(reg_elem, no_ids, classified.no_reg_elems);
+      add_unique_regulatory_element(reg_elem, sb_ids, classified.sb_reg_elems);
+      add_unique_regulatory_element(reg_elem, cw_ids, classified.cw_reg_elems);
+      add_unique_regulatory_element(reg_elem, no_parking_ids, classified.no_parking_reg_elems);
+      add_unique_regulatory_element(reg_elem, bus_stop_ids, classified.bus_stop_reg_elems);
+    }
+  }
+  // only looks at the regulatory elements of the road lanelets
+  classified.stop_lines = lanelet::utils::query::stopLinesLanelets(classified.road_lanelets);
+
+  for (const auto & ls : lanelet_map->lineStringLayer) {
+    const lanelet::ConstLineString3d const_ls = ls;
+    const std::string type = const_ls.attributeOr(lanelet::AttributeName::Type, "none");
+    if (type == "fence") {
+      classified.partitions.push_back(const_ls);
+    } else if (type == "parking_space") {
+      classified.parking_spaces.push_back(const_ls);
+    } else if (type == "curbstone") {
+      classified.curbstones.push_back(const_ls);
+    } else if (type == "waypoints") {
+      classified.waypoints.push_back(const_ls);
+    }
+  }
+  // the pedestrian markings are split into polygons and lines with extra geometric checks
+  classified.pedestrian_polygon_markings =
+    lanelet::utils::query::getAllPedestrianPolygonMarkings(lanelet_map);
+  classified.pedestrian_line_markings =
+    lanelet::utils::query::getAllPedestrianLineMarkings(lanelet_map);
+
+  for (const auto & poly : lanelet_map->polygonLayer) {
+    const lanelet::ConstPolygon3d const_poly = poly;
+    const std::string type = const_poly.attributeOr(lanelet::AttributeName::Type, "none");
+    if (type == "parking_lot") {
+      classified.parking_lots.push_back(const_poly);
+    } else if (type == "obstacle") {
+      classified.obstacle_polygons.push_back(const_poly);
+    } else if (type == "no_obstacle_segmentation_area") {
+      classified.no_obstacle_segmentation_area.push_back(const_poly);
+    } else if (type == "no_obstacle_segmentation_area_for_run_out") {
+      classified.no_obstacle_segmentation_area_for_run_out.push_back(const_poly);
+    } else if (type == "hatched_road_markings") {
+      classified.hatched_road_markings_area.push_back(const_poly);
+    } else if (type == "intersection_area") {
+      classified.intersection_areas.push_back(const_poly);
+    }
+  }
+
+  return classified;
+}
+
+visualization_msgs::msg::MarkerArray create_map_marker_array(
+  const ClassifiedLaneletMap & m, const bool viz_lanelets_centerline, const size_t num_threads)
+{
+  namespace viz = lanelet::visualization;
+
+  const auto cl_road = create_color(0.27, 0.27, 0.27, 0.999);
+  const auto cl_shoulder = create_color(0.15, 0.15, 0.15, 0.999);
+  const auto cl_cross = create_color(0.27, 0.3, 0.27, 0.5);
+  const auto cl_partitions = create_color(0.25, 0.25, 0.25, 0.999);
+  const auto cl_pedestrian_markings = create_color(0.5, 0.5, 0.5, 0.999);
+  const auto cl_ll_borders = create_color(0.5, 0.5, 0.5, 0.999);
+  const auto cl_shoulder_borders = create_color(0.2, 0.2, 0.2, 0.999);
+  const auto cl_stoplines = create_color(0.5, 0.5, 0.5, 0.999);
+  const auto cl_trafficlights = create_color(0.5, 0.5, 0.5, 0.8);
+  const auto cl_detection_areas = create_color(0.27, 0.27, 0.37, 0.5);
+  const auto cl_no_stopping_areas = create_color(0.37, 0.37, 0.37, 0.5);
+  const auto cl_speed_bumps = create_color(0.56, 0.40, 0.27, 0.5);
+  const auto cl_crosswalks = create_color(0.80, 0.80, 0.0, 0.5);
+  const auto cl_obstacle_polygons = create_color(0.4, 0.27, 0.27, 0.5);
+  const auto cl_parking_lots = create_color(1.0, 1.0, 1.0, 0.2);
+  const auto cl_parking_spaces = create_color(1.0, 1.0, 1.0, 0.3);
+  const auto cl_lanelet_id = create_color(0.5, 0.5, 0.5, 0.999);
+  const auto cl_no_obstacle_segmentation_area = create_color(0.37, 0.37, 0.27, 0.5);
+  const auto cl_no_obstacle_segmentation_area_for_run_out = create_color(0.37, 0.7, 0.27, 0.5);
+  const auto cl_hatched_road_markings_area = create_color(0.3, 0.3, 0.3, 0.5);
+  const auto cl_hatched_road_markings_line = create_color(0.5, 0.5, 0.5, 0.999);
+  const auto cl_no_parking_areas = create_color(0.42, 0.42, 0.42, 0.5);
+  const auto cl_curbstones = create_color(0.1, 0.1, 0.2, 0.999);
+  const auto cl_intersection_area = create_color(0.16, 1.0, 0.69, 0.5);
+  const auto cl_bus_stop_area = create_color(0.863, 0.863, 0.863, 0.5);
+  const auto cl_bicycle_lane = create_color(0.0, 0.3843, 0.6274, 0.5);
+  const auto cl_waypoints = create_color(0.6, 0.4, 0.3, 0.999);
+
+  // NOTE: the order of the categories defines the order of the markers in the output
+  using MarkerArray = visualization_msgs::msg::MarkerArray;
+  const std::vector<std::function<MarkerArray()>> categories = {
+    [&] { return viz::lineStringsAsMarkerArray(m.stop_lines, "stop_lines", cl_stoplines, 0.5); },
+    [&] { return viz::lineStringsAsMarkerArray(m.partitions, "partitions", cl_partitions, 0.1); },
+    [&] { return viz::laneletDirectionAsMarkerArray(m.shoulder_lanelets, "shoulder_"); },
+    [&] { return viz::laneletDirectionAsMarkerArray(m.road_lanelets); },
+    [&] {
+      return viz::laneletsAsTriangleMarkerArray(
+        "crosswalk_lanelets", m.crosswalk_lanelets, cl_cross);
+    },
+    [&] {
+      return viz::pedestrianPolygonMarkingsAsMarkerArray(
+        m.pedestrian_polygon_markings, cl_pedestrian_markings);
+    },
+    [&] {
+      return viz::pedestrianLineMarkingsAsMarkerArray(
+        m.pedestrian_line_markings, cl_pedestrian_markings);
+    },
+    [&] {
+      return viz::laneletsAsTriangleMarkerArray("walkway_lanelets", m.walkway_lanelets, cl_cross);
+    },
+    [&] { return viz::obstaclePolygonsAsMarkerArray(m.obstacle_polygons, cl_obstacle_polygons); },
+    [&] { return viz::detectionAreasAsMarkerArray(m.da_reg_elems, cl_detection_areas); },
+    [&] { return viz::noStoppingAreasAsMarkerArray(m.no_reg_elems, cl_no_stopping_areas); },
+    [&] { return viz::speedBumpsAsMarkerArray(m.sb_reg_elems, cl_speed_bumps); },
+    [&] { return viz::crosswalkAreasAsMarkerArray(m.cw_reg_elems, cl_crosswalks); },
+    [&] { return viz::parkingLotsAsMarkerArray(m.parking_lots, cl_parking_lots); },
+    [&] { return viz::parkingSpacesAsMarkerArray(m.parking_spaces, cl_parking_spaces); },
+    [&] {
+      return viz::laneletsBoundaryAsMarkerArray(
+        m.shoulder_lanelets, cl_shoulder_borders, viz_lanelets_centerline, "shoulder_");
+    },
+    [&] {
+      return viz::laneletsBoundaryAsMarkerArray(
+        m.road_lanelets, cl_ll_borders, viz_lanelets_centerline);
+    },
+    [&] { return viz::autowareTrafficLightsAsMarkerArray(m.aw_tl_reg_elems, cl_trafficlights); },
+    [&] {
+      return viz::generateTrafficLightRegulatoryElementIdMaker(m.road_lanelets, cl_trafficlights);
+    },
+    [&] {
+      return viz::generateTrafficLightRegulatoryElementIdMaker(
+        m.crosswalk_lanelets, cl_trafficlights);
+    },
+    [&] { return viz::generateTrafficLightIdMaker(m.aw_tl_reg_elems, cl_trafficlights); },
+    [&] { return viz::generateLaneletIdMarker(m.shoulder_lanelets, cl_lanelet_id); },
+    [&] { return viz::generateLaneletIdMarker(m.road_lanelets, cl_lanelet_id); },
+    [&] {
+      return viz::generateLaneletIdMarker(
+        m.crosswalk_lanelets, cl_lanelet_id, "crosswalk_lanelet_id");
+    },
+    [&] {
+      return viz::laneletsAsTriangleMarkerArray(
+        "shoulder_road_lanelets", m.shoulder_lanelets, cl_shoulder);
+    },
+    [&] { return viz::laneletsAsTriangleMarkerArray("road_lanelets", m.road_lanelets, cl_road); },
+    [&] {
+      return viz::noObstacleSegmentationAreaAsMarkerArray(
+        m.no_obstacle_segmentation_area, cl_no_obstacle_segmentation_area);
+    },
+    [&] {
+      return viz::noObstacleSegmentationAreaForRunOutAsMarkerArray(
+        m.no_obstacle_segmentation_area_for_run_out, cl_no_obstacle_segmentation_area_for_run_out);
+    },
+    [&] {
+      return viz::hatchedRoadMarkingsAreaAsMarkerArray(
+        m.hatched_road_markings_area, cl_hatched_road_markings_area, cl_hatched_road_markings_line);
+    },
+    [&] { return viz::noParkingAreasAsMarkerArray(m.no_parking_reg_elems, cl_no_parking_areas); },
+    [&] { return viz::lineStringsAsMarkerArray(m.curbstones, "curbstone", cl_curbstones, 0.2); },
+    [&] { return viz::intersectionAreaAsMarkerArray(m.intersection_areas, cl_intersection_area); },
+    [&] { return viz::busStopAreasAsMarkerArray(m.bus_stop_reg_elems, cl_bus_stop_area); },
+    [&] { return viz::laneletDirectionAsMarkerArray(m.bicycle_lane_lanelets, "bicycle_lane_"); },
+    [&] {
+      return viz::laneletsBoundaryAsMarkerArray(
+        m.bicycle_lane_lanelets, cl_ll_borders /* use ll_border color */, viz_lanelets_centerline,
+        "bicycle_lane_");
+    },
+    [&] {
+      return viz::generateLaneletIdMarker(
+        m.bicycle_lane_lanelets, cl_lanelet_id /* use lanelet_id color */);
+    },
+    [&] {
+      return viz::laneletsAsTriangleMarkerArray(
+        "bicycle_lane_lanelets", m.bicycle_lane_lanelets, cl_bicycle_lane);
+    },
+    [&] { return viz::lineStringsAsMarkerArray(m.waypoints, "waypoints", cl_waypoints, 0.02); },
+  };
+
+  const size_t num_workers = std::min(std::max<size_t>(num_threads, 1), categories.size());
+  if (num_workers > 1) {
+    // Lanelet2 computes the centerline lazily and caches it in the lanelet without a lock, and a
+    // lanelet is drawn by several categories, so fill the caches before the workers share them
+    for (const auto * lanelets :
+         {&m.road_lanelets, &m.shoulder_lanelets, &m.crosswalk_lanelets, &m.walkway_lanelets,
+          &m.bicycle_lane_lanelets}) {
+      for (const auto & ll : *lanelets) {
+        ll.centerline();
+      }
+    }
+  }
+
+  // each category is written into its own slot so the workers never share an output
+  std::vector<MarkerArray> category_markers(categories.size());
+  std::atomic<size_t> next_category{0};
+  std::exception_ptr worker_exception;
+  std::atomic_flag has_worker_exception = ATOMIC_FLAG_INIT;
+  const auto run_categories = [&]() {
+    for (size_t i = next_category++; i < categories.size(); i = next_category++) {
+      try {
+        category_markers[i] = categories[i]();
+      } catch (...) {
+        if (!has_worker_exception.test_and_set()) {
+          worker_exception = std::current_exception();
+        }
+      }
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(num_workers - 1);
+  for (size_t i = 1; i < num_workers; ++i) {
+    workers.emplace_back(run_categories);
+  }
+  run_categories();
+  for (auto & worker : workers) {
+    worker.join();
+  }
+  if (worker_exception) {
+    std::rethrow_exception(worker_exception);
+  }
+
+  size_t num_markers = 0;
+  for (const auto & markers : category_markers) {
+    num_markers += markers.markers.size();
+  }
+  MarkerArray map_marker_array;
+  map_marker_array.markers.reserve(num_markers);
+  for (auto & markers : category_markers) {
+    std::move(
+      markers.markers.begin(), markers.markers.end(), std::back_inserter(map_marker_array.markers));
+  }
+  return map_marker_array;
+}
+
+std::string compute_map_hash(const autoware_map_msgs::msg::LaneletMapBin & msg)
+{
+  // FNV-1a, which unlike std::hash gives the same key across builds and platforms
+  constexpr uint64_t fnv_offset_basis = 14695981039346656037ULL;
+  constexpr uint64_t fnv_prime = 1099511628211ULL;
+  const auto add_bytes = [](uint64_t hash, const auto & bytes) {
+    for (const auto byte : bytes) {
+      hash ^= static_cast<uint8_t>(byte);
+      hash *= fnv_prime;
+    }
+    return hash;
+  };
+  const uint64_t data_hash = add_bytes(fnv_offset_basis, msg.data);
+  const uint64_t format_hash = add_bytes(
+    fnv_offset_basis, msg.version_map_format + "/" + std::to_string(marker_cache_format_version));
+
+  std::ostringstream ss;
+  ss << std::hex << std::setfill('0') << std::setw(16) << data_hash << std::setw(16)
+     << format_hash << "_" << std::dec << msg.data.size();
+  return ss.str();
+}
+
+std::string get_marker_cache_path(
+  const std::string & directory, const autoware_map_msgs::msg::LaneletMapBin & msg)
+{
+  const std::string file_name = std::string(marker_cache_file_prefix) + compute_map_hash(msg) +
+                                std::string(marker_cache_file_suffix);
+  return (std::filesystem::path(directory) / file_name).string();
+}
+
+std::optional<visualization_msgs::msg::MarkerArray> load_marker_cache(const std::string & path)
+{
+  std::ifstream ifs(path, std::ios::binary | std::ios::ate);
+  if (!ifs) {
+    return std::nullopt;
+  }
+  const auto size = static_cast<size_t>(ifs.tellg());
+  ifs.seekg(0);
+
+  rclcpp::SerializedMessage serialized_msg(size);
+  auto & rcl_serialized_msg = serialized_msg.get_rcl_serialized_message();
+  if (!ifs.read(reinterpret_cast<char *>(rcl_serialized_msg.buffer), size)) {
+    return std::nullopt;
+  }
+  rcl_serialized_msg.buffer_length = size;
+
+  visualization_msgs::msg::MarkerArray marker_array;
+  try {
+    rclcpp::Serialization<visualization_msgs::msg::MarkerArray>().deserialize_message(
+      &serialized_msg, &marker_array);
+  } catch (const std::exception &) {
+    return std::nullopt;
+  }
+
+  // mark the cache as recently used for evict_marker_cache()
+  std::error_code ec;
+  std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+  return marker_array;
+}
+
+bool save_marker_cache(
+  const std::string & path, const visualization_msgs::msg::MarkerArray & marker_array)
+{
+  rclcpp::SerializedMessage serialized_msg;
+  rclcpp::Serialization<visualization_msgs::msg::MarkerArray>().serialize_message(
+    &marker_array, &serialized_msg);
+  const auto & rcl_serialized_msg = serialized_msg.get_rcl_serialized_message();
+
+  // write to a temporary file first so that a concurrent reader never sees a partial cache
+  std::error_code ec;
+  std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+  const std::string tmp_path = path + ".tmp";
+  {
+    std::ofstream ofs(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!ofs) {
+      return false;
+    }
+    ofs.write(
+      reinterpret_cast<const char *>(rcl_serialized_msg.buffer),
+      static_cast<std::streamsize>(rcl_serialized_msg.buffer_length));
+    if (!ofs) {
+      return false;
+    }
+  }
+  std::filesystem::rename(tmp_path, path, ec);
+  return !ec;
+}
+
+size_t evict_marker_cache(const std::string & directory, const size_t max_num_files)
+{
+  namespace fs = std::filesystem;
+
+  std::vector<std::pair<fs::file_time_type, fs::path>> cache_files;
+  std::error_code ec;
+  for (fs::directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec)) {
+    const auto file_name = it->path().filename().string();
+    const bool is_cache_file =
+      file_name.size() > marker_cache_file_prefix.size() + marker_cache_file_suffix.size() &&
+      file_name.compare(0, marker_cache_file_prefix.size(), marker_cache_file_prefix) == 0 &&
+      file_name.compare(
+        file_name.size() - marker_cache_file_suffix.size(), marker_cache_file_suffix.size(),
+        marker_cache_file_suffix) == 0;
+    std::error_code time_ec;
+    const auto write_time = it->last_write_time(time_ec);
+    if (is_cache_file && !time_ec) {
+      cache_files.emplace_back(write_time, it->path());
+    }
+  }
+  if (cache_files.size() <= max_num_files) {
+    return 0;
+  }
+
+  // remove the least recently used ones
+  std::sort(cache_files.begin(), cache_files.end());
+  const size_t num_evicted = cache_files.size() - max_num_files;
+  size_t num_removed = 0;
+  for (size_t i = 0; i < num_evicted; ++i) {
+    std::error_code remove_ec;
+    num_removed += fs::remove(cache_files[i].second, remove_ec) ? 1 : 0;
+  }
+  return num_removed;
+}
+}  // namespace autoware::lanelet2_map_visualizer
@@ -0,0 +1,132 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET2_MAP_VISUALIZATION_ENGINE_HPP_
+#define LANELET2_MAP_VISUALIZATION_ENGINE_HPP_
+
+#include <autoware_lanelet2_extension/regulatory_elements/autoware_traffic_light.hpp>
+#include <autoware_lanelet2_extension/utility/query.hpp>
+
+#include <autoware_map_msgs/msg/lanelet_map_bin.hpp>
+#include <visualization_msgs/msg/marker_array.hpp>
+
+#include <lanelet2_core/LaneletMap.h>
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace autoware::lanelet2_map_visualizer
+{
+/// @brief primitives of a lanelet map sorted into the categories drawn by the visualizer
+/// @details the content and order of each category is the same as the one returned by the
+/// corresponding lanelet::utils::query function
+struct ClassifiedLaneletMap
+{
+  lanelet::ConstLanelets road_lanelets;
+  lanelet::ConstLanelets shoulder_lanelets;
+  lanelet::ConstLanelets crosswalk_lanelets;
+  lanelet::ConstLanelets walkway_lanelets;
+  lanelet::ConstLanelets bicycle_lane_lanelets;
+
+  std::vector<lanelet::ConstLineString3d> stop_lines;
+  std::vector<lanelet::AutowareTrafficLightConstPtr> aw_tl_reg_elems;
+  std::vector<lanelet::DetectionAreaConstPtr> da_reg_elems;
+  std::vector<lanelet::NoStoppingAreaConstPtr> no_reg_elems;
+  std::vector<lanelet::SpeedBumpConstPtr> sb_reg_elems;
+  std::vector<lanelet::CrosswalkConstPtr> cw_reg_elems;
+  std::vector<lanelet::NoParkingAreaConstPtr> no_parking_reg_elems;
+  std::vector<lanelet::BusStopAreaConstPtr> bus_stop_reg_elems;
+
+  lanelet::ConstLineStrings3d partitions;
+  lanelet::ConstLineStrings3d pedestrian_polygon_markings;
+  lanelet::ConstLineStrings3d pedestrian_line_markings;
+  lanelet::ConstLineStrings3d parking_spaces;
+  lanelet::ConstLineStrings3d curbstones;
+  lanelet::ConstLineStrings3d waypoints;
+
+  lanelet::ConstPolygons3d parking_lots;
+  lanelet::ConstPolygons3d obstacle_polygons;
+  lanelet::ConstPolygons3d no_obstacle_segmentation_area;
+  lanelet::ConstPolygons3d no_obstacle_segmentation_area_for_run_out;
+  lanelet::ConstPolygons3d hatched_road_markings_area;
+  lanelet::ConstPolygons3d intersection_areas;
+};
+
+/**
+ * @brief sort the primitives of the map into the visualized categories
+ * @details the lanelet, linestring, and polygon layers are each traversed once
+ * @param lanelet_map lanelet map
+ * @return classified primitives
+ */
+ClassifiedLaneletMap classify_lanelet_map(const lanelet::LaneletMapConstPtr & lanelet_map);
+
+/**
+ * @brief create the markers of all the categories
+ * @details the categories are built concurrently and concatenated once, in a fixed order, so the
+ * result does not depend on the number of threads
+ * @param classified_map classified primitives
+ * @param viz_lanelets_centerline whether to draw the lanelet centerlines
+ * @param num_threads number of threads used to build the categories (0 or 1 to run serially)
+ * @return markers of the whole map
+ */
+visualization_msgs::msg::MarkerArray create_map_marker_array(
+  const ClassifiedLaneletMap & classified_map, const bool viz_lanelets_centerline,
+  const size_t num_threads);
+
+/**
+ * @brief compute the key identifying a map in the marker cache
+ * @param msg binary map message
+ * @return hexadecimal key computed from the format version and the content of the map, which is
+ * stable across builds
+ */
+std::string compute_map_hash(const autoware_map_msgs::msg::LaneletMapBin & msg);
+
+/**
+ * @brief get the path of the cache file of a map
+ * @param directory cache directory
+ * @param msg binary map message
+ * @return path of the cache file in the directory
+ */
+std::string get_marker_cache_path(
+  const std::string & directory, const autoware_map_msgs::msg::LaneletMapBin & msg);
+
+/**
+ * @brief load a serialized marker array
+ * @param path path of the cache file
+ * @details the modification time of a loaded file is updated so that it is evicted last
+ * @return markers, or std::nullopt if the file does not exist or cannot be deserialized
+ */
+std::optional<visualization_msgs::msg::MarkerArray> load_marker_cache(const std::string & path);
+
+/**
+ * @brief save a marker array in serialized form
+ * @param path path of the cache file
+ * @param marker_array markers to save
+ * @return true if the file was written successfully
+ */
+bool save_marker_cache(
+  const std::string & path, const visualization_msgs::msg::MarkerArray & marker_array);
+
+/**
+ * @brief remove the least recently used cache files so that at most max_num_files remain
+ * @param directory cache directory
+ * @param max_num_files maximum number of the cache files kept in the directory
+ * @return number of the removed files
+ */
+size_t evict_marker_cache(const std::string & directory, const size_t max_num_files);
+}  // namespace autoware::lanelet2_map_visualizer
+
+#endif  // LANELET2_MAP_VISUALIZATION_ENGINE_HPP_
@@ -35,6 +35,9 @@ private:
   rclcpp::Publisher<visualization_msgs::msg::MarkerArray>::SharedPtr pub_marker_;
 
   bool viz_lanelets_centerline_;
+  size_t num_threads_;
+  std::string marker_cache_directory_;
+  size_t marker_cache_max_files_;
 
   void on_map_bin(const autoware_map_msgs::msg::LaneletMapBin::ConstSharedPtr msg);
 };
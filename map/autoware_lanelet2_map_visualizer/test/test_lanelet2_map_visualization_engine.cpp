@@ -0,0 +1,215 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/lanelet2_map_visualization_engine.hpp"
+
+#include <autoware_lanelet2_extension/utility/message_conversion.hpp>
+#include <autoware_lanelet2_extension/utility/query.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using autoware::lanelet2_map_visualizer::classify_lanelet_map;
+using autoware::lanelet2_map_visualizer::compute_map_hash;
+using autoware::lanelet2_map_visualizer::create_map_marker_array;
+using autoware::lanelet2_map_visualizer::evict_marker_cache;
+using autoware::lanelet2_map_visualizer::get_marker_cache_path;
+using autoware::lanelet2_map_visualizer::load_marker_cache;
+using autoware::lanelet2_map_visualizer::save_marker_cache;
+
+namespace
+{
+lanelet::Id next_id = 1;
+
+lanelet::LineString3d createLineString(
+  const std::vector<std::pair<double, double>> & points, const std::string & type = "")
+{
+  lanelet::LineString3d ls(next_id++);
+  for (const auto & [x, y] : points) {
+    ls.push_back(lanelet::Point3d{next_id++, x, y, 0.0});
+  }
+  if (!type.empty()) {
+    ls.attributes()[lanelet::AttributeName::Type] = type;
+  }
+  return ls;
+}
+
+lanelet::Lanelet createLanelet(const double offset_y, const std::string & subtype)
+{
+  lanelet::Lanelet ll(
+    next_id++, createLineString({{0.0, offset_y}, {10.0, offset_y}}),
+    createLineString({{0.0, offset_y + 3.0}, {10.0, offset_y + 3.0}}));
+  ll.attributes()[lanelet::AttributeName::Subtype] = subtype;
+  return ll;
+}
+
+lanelet::Polygon3d createPolygon(const double offset_x, const std::string & type)
+{
+  lanelet::Polygon3d poly(next_id++);
+  for (const auto & [x, y] : std::vector<std::pair<double, double>>{
+         {offset_x, 0.0}, {offset_x + 1.0, 0.0}, {offset_x + 1.0, 1.0}}) {
+    poly.push_back(lanelet::Point3d{next_id++, x, y, 0.0});
+  }
+  poly.attributes()[lanelet::AttributeName::Type] = type;
+  return poly;
+}
+
+lanelet::LaneletMapPtr createLaneletMap()
+{
+  auto map = std::make_shared<lanelet::LaneletMap>();
+  const std::vector<std::string> subtypes = {"road",    "road_shoulder", "crosswalk",
+                                             "walkway", "bicycle_lane",  "road"};
+  for (size_t i = 0; i < subtypes.size(); ++i) {
+    map->add(createLanelet(4.0 * static_cast<double>(i), subtypes[i]));
+  }
+  for (const auto & type : {"fence", "parking_space", "curbstone", "waypoints", "fence"}) {
+    map->add(createLineString({{0.0, -1.0}, {5.0, -1.0}}, type));
+  }
+  for (const auto & type :
+       {"parking_lot", "obstacle", "no_obstacle_segmentation_area",
+        "no_obstacle_segmentation_area_for_run_out", "hatched_road_markings", "intersection_area",
+        "parking_lot"}) {
+    map->add(createPolygon(20.0, type));
+  }
+  return map;
+}
+
+template <class T>
+void expectSameIds(const T & expected, const T & actual)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(expected[i].id(), actual[i].id());
+  }
+}
+}  // namespace
+
+TEST(Lanelet2MapVisualizationEngine, classifySameAsQuery)
+{
+  namespace query = lanelet::utils::query;
+  const lanelet::LaneletMapConstPtr map = createLaneletMap();
+  const auto classified = classify_lanelet_map(map);
+
+  const auto all_lanelets = query::laneletLayer(map);
+  expectSameIds(query::roadLanelets(all_lanelets), classified.road_lanelets);
+  expectSameIds(query::shoulderLanelets(all_lanelets), classified.shoulder_lanelets);
+  expectSameIds(query::crosswalkLanelets(all_lanelets), classified.crosswalk_lanelets);
+  expectSameIds(query::walkwayLanelets(all_lanelets), classified.walkway_lanelets);
+  expectSameIds(query::bicycleLaneLanelets(all_lanelets), classified.bicycle_lane_lanelets);
+
+  expectSameIds(query::getAllPartitions(map), classified.partitions);
+  expectSameIds(query::getAllParkingSpaces(map), classified.parking_spaces);
+  expectSameIds(query::curbstones(map), classified.curbstones);
+  expectSameIds(query::getAllWaypoints(map), classified.waypoints);
+
+  expectSameIds(query::getAllParkingLots(map), classified.parking_lots);
+  expectSameIds(query::getAllObstaclePolygons(map), classified.obstacle_polygons);
+  expectSameIds(
+    query::getAllPolygonsByType(map, "no_obstacle_segmentation_area"),
+    classified.no_obstacle_segmentation_area);
+  expectSameIds(
+    query::getAllPolygonsByType(map, "no_obstacle_segmentation_area_for_run_out"),
+    classified.no_obstacle_segmentation_area_for_run_out);
+  expectSameIds(
+    query::getAllPolygonsByType(map, "hatched_road_markings"),
+    classified.hatched_road_markings_area);
+  expectSameIds(
+    query::getAllPolygonsByType(map, "intersection_area"), classified.intersection_areas);
+}
+
+TEST(Lanelet2MapVisualizationEngine, markersIndependentOfThreads)
+{
+  // load a fresh map for each pass like the node does, so that the parallel pass runs first on
+  // lanelets whose centerlines are not computed yet
+  autoware_map_msgs::msg::LaneletMapBin map_bin_msg;
+  lanelet::utils::conversion::toBinMsg(createLaneletMap(), &map_bin_msg);
+  const auto load_map = [&map_bin_msg]() {
+    lanelet::LaneletMapPtr map = std::make_shared<lanelet::LaneletMap>();
+    lanelet::utils::conversion::fromBinMsg(map_bin_msg, map);
+    return map;
+  };
+
+  const auto parallel_markers = create_map_marker_array(classify_lanelet_map(load_map()), true, 8);
+  const auto serial_markers = create_map_marker_array(classify_lanelet_map(load_map()), true, 1);
+  ASSERT_FALSE(serial_markers.markers.empty());
+  EXPECT_EQ(serial_markers, parallel_markers);
+}
+
+TEST(Lanelet2MapVisualizationEngine, markerCache)
+{
+  autoware_map_msgs::msg::LaneletMapBin map_bin_msg;
+  lanelet::utils::conversion::toBinMsg(createLaneletMap(), &map_bin_msg);
+  const auto hash = compute_map_hash(map_bin_msg);
+  EXPECT_EQ(hash, compute_map_hash(map_bin_msg));
+
+  auto modified_map_bin_msg = map_bin_msg;
+  modified_map_bin_msg.data.back() ^= 0xFF;
+  EXPECT_NE(hash, compute_map_hash(modified_map_bin_msg));
+
+  const auto markers = create_map_marker_array(classify_lanelet_map(createLaneletMap()), true, 1);
+  const auto cache_path =
+    get_marker_cache_path(std::filesystem::temp_directory_path().string(), map_bin_msg);
+  EXPECT_NE(cache_path.find(hash), std::string::npos);
+  ASSERT_TRUE(save_marker_cache(cache_path, markers));
+  const auto loaded_markers = load_marker_cache(cache_path);
+  ASSERT_TRUE(loaded_markers.has_value());
+  EXPECT_EQ(markers, *loaded_markers);
+  std::filesystem::remove(cache_path);
+
+  EXPECT_FALSE(load_marker_cache(cache_path).has_value());
+}
+
+TEST(Lanelet2MapVisualizationEngine, evictMarkerCache)
+{
+  namespace fs = std::filesystem;
+  const auto cache_directory = fs::temp_directory_path() / "test_lanelet2_map_marker_eviction";
+  fs::remove_all(cache_directory);
+  fs::create_directories(cache_directory);
+
+  // maps with different contents, saved from the oldest to the newest
+  autoware_map_msgs::msg::LaneletMapBin map_bin_msg;
+  lanelet::utils::conversion::toBinMsg(createLaneletMap(), &map_bin_msg);
+  std::vector<std::string> cache_paths;
+  for (size_t i = 0; i < 4; ++i) {
+    map_bin_msg.data.back() = static_cast<uint8_t>(i);
+    cache_paths.push_back(get_marker_cache_path(cache_directory.string(), map_bin_msg));
+    ASSERT_TRUE(save_marker_cache(cache_paths.back(), visualization_msgs::msg::MarkerArray{}));
+    fs::last_write_time(
+      cache_paths.back(), fs::file_time_type::clock::now() - std::chrono::hours(4 - i));
+  }
+  // a file which is not a cache is never removed
+  std::ofstream(cache_directory / "other.bin") << "other";
+
+  // loading the oldest one makes it the most recently used
+  ASSERT_TRUE(load_marker_cache(cache_paths.front()).has_value());
+
+  EXPECT_EQ(evict_marker_cache(cache_directory.string(), 2), 2U);
+  EXPECT_TRUE(fs::exists(cache_paths[0]));
+  EXPECT_FALSE(fs::exists(cache_paths[1]));
+  EXPECT_FALSE(fs::exists(cache_paths[2]));
+  EXPECT_TRUE(fs::exists(cache_paths[3]));
+  EXPECT_TRUE(fs::exists(cache_directory / "other.bin"));
+
+  EXPECT_EQ(evict_marker_cache(cache_directory.string(), 2), 0U);
+  fs::remove_all(cache_directory);
+}
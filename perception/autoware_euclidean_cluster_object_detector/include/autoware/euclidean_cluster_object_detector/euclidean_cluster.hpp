@@ -19,6 +19,11 @@
 
 #include <pcl/point_types.h>
 
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 namespace autoware::euclidean_cluster
@@ -29,10 +34,18 @@ public:
   EuclideanCluster();
   EuclideanCluster(bool use_height, int min_cluster_size, int max_cluster_size);
   EuclideanCluster(bool use_height, int min_cluster_size, int max_cluster_size, float tolerance);
+  ~EuclideanCluster() override;
+  EuclideanCluster(const EuclideanCluster &) = delete;
+  EuclideanCluster & operator=(const EuclideanCluster &) = delete;
+
   bool cluster(
     const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud,
     std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters) override;
 
+  /** \brief Cluster the pointcloud into the indices of the points, without copying the points */
+  bool cluster(
+    const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud, ClusterIndices & clusters);
+
   bool cluster(
     const sensor_msgs::msg::PointCloud2::ConstSharedPtr & input_msg,
     autoware_perception_msgs::msg::DetectedObjects & output_clusters) override;
@@ -43,9 +56,37 @@ public:
     std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters) override;
 
   void setTolerance(float tolerance) { tolerance_ = tolerance; }
+  /** \brief With more than one thread, the pointcloud is split into tiles clustered in parallel.
+   * The worker threads are started here and kept until the next call or the destruction. */
+  void setNumThreads(int num_threads);
+  void setTileSize(float tile_size) { tile_size_ = tile_size; }
 
 private:
   float tolerance_;
+  int num_threads_{1};
+  float tile_size_{20.0f};
+
+  // the num_threads_ - 1 workers, which run the task of each clusterInTiles() with the caller
+  std::vector<std::thread> workers_;
+  std::mutex workers_mutex_;
+  std::condition_variable task_cv_;
+  std::condition_variable done_cv_;
+  std::function<void()> task_;
+  uint64_t task_id_{0};
+  size_t busy_worker_num_{0};
+  bool stop_workers_{false};
+
+  void startWorkers(int worker_num);
+  void stopWorkers();
+  void runWorkers(uint64_t task_id);
+  /** \brief Run the task on the caller and all the workers, and wait for them to finish */
+  void runOnAllThreads(const std::function<void()> & task);
+
+  /** \brief Cluster the tiles of the XY plane in parallel and merge the clusters sharing points.
+   * The tiles overlap by the tolerance, so the result is the same as clustering the whole
+   * pointcloud. The points with a non-finite coordinate are not clustered. */
+  void clusterInTiles(
+    const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud, ClusterIndices & clusters);
 };
 
 }  // namespace autoware::euclidean_cluster
@@ -22,17 +22,87 @@
 #include <pcl/point_types.h>
 #include <pcl_conversions/pcl_conversions.h>
 
+#include <cstddef>
 #include <vector>
 
 namespace autoware::euclidean_cluster
 {
+/**
+ * @brief clusters represented by the indices of their points in the source pointcloud. The
+ * indices of all the clusters are stored in one array, and cluster i is in
+ * [offsets_[i], offsets_[i + 1]).
+ */
+class ClusterIndices
+{
+public:
+  void clear()
+  {
+    indices_.clear();
+    offsets_.assign(1, 0);
+  }
+
+  void reserve(const std::size_t cluster_num, const std::size_t point_num)
+  {
+    offsets_.reserve(cluster_num + 1);
+    indices_.reserve(point_num);
+  }
+
+  template <class InputIt>
+  void addCluster(InputIt first, InputIt last)
+  {
+    indices_.insert(indices_.end(), first, last);
+    offsets_.push_back(indices_.size());
+  }
+
+  std::size_t size() const { return offsets_.size() - 1; }
+  bool empty() const { return size() == 0; }
+  std::size_t pointNum() const { return indices_.size(); }
+  std::size_t clusterSize(const std::size_t i) const { return offsets_[i + 1] - offsets_[i]; }
+
+  const int * clusterBegin(const std::size_t i) const { return indices_.data() + offsets_[i]; }
+  const int * clusterEnd(const std::size_t i) const { return indices_.data() + offsets_[i + 1]; }
+
+private:
+  std::vector<int> indices_;
+  std::vector<std::size_t> offsets_{0};
+};
+
+/**
+ * @brief features of a cluster, which are reduced in one pass over its points
+ */
+struct ClusterFeature
+{
+  std::size_t point_num{0};
+  geometry_msgs::msg::Point centroid;
+  // axis-aligned bounding box
+  geometry_msgs::msg::Point min_point;
+  geometry_msgs::msg::Point max_point;
+};
+
+ClusterFeature computeClusterFeature(
+  const pcl::PointCloud<pcl::PointXYZ> & pointcloud, const ClusterIndices & clusters,
+  const std::size_t cluster_idx);
+
+/**
+ * @brief centroid of a cluster, without the bounding box of computeClusterFeature()
+ */
+geometry_msgs::msg::Point computeClusterCentroid(
+  const pcl::PointCloud<pcl::PointXYZ> & pointcloud, const ClusterIndices & clusters,
+  const std::size_t cluster_idx);
+
 geometry_msgs::msg::Point getCentroid(const sensor_msgs::msg::PointCloud2 & pointcloud);
 void convertPointCloudClusters2Msg(
   const std_msgs::msg::Header & header,
   const std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters,
   autoware_perception_msgs::msg::DetectedObjects & msg);
+void convertClusterIndices2Msg(
+  const std_msgs::msg::Header & header, const pcl::PointCloud<pcl::PointXYZ> & pointcloud,
+  const ClusterIndices & clusters, autoware_perception_msgs::msg::DetectedObjects & msg);
 
 void convertClusters2SensorMsg(
   const std_msgs::msg::Header & header, const std::vector<pcl::PointCloud<pcl::PointXYZ>> & input,
   sensor_msgs::msg::PointCloud2 & output);
+void convertClusterIndices2SensorMsg(
+  const std_msgs::msg::Header & header, const pcl::PointCloud<pcl::PointXYZ> & pointcloud,
+  const ClusterIndices & clusters, sensor_msgs::msg::PointCloud2 & output);
 }  // namespace autoware::euclidean_cluster
@@ -15,12 +15,12 @@
 #pragma once
 #include <autoware/euclidean_cluster_object_detector/euclidean_cluster_interface.hpp>
 #include <autoware/euclidean_cluster_object_detector/utils.hpp>
+#include <autoware/point_types/voxel_grid_downsampler.hpp>
 #include <autoware_utils_diagnostics/diagnostics_interface.hpp>
 #include <rclcpp/node.hpp>
 
 #include <sensor_msgs/point_cloud2_iterator.hpp>
 
-#include <pcl/filters/voxel_grid.h>
 #include <pcl/point_types.h>
 
 #include <vector>
@@ -57,7 +57,7 @@ public:
   }
 
 private:
-  pcl::VoxelGrid<pcl::PointXYZ> voxel_grid_;
+  autoware::point_types::VoxelGridDownsampler voxel_grid_;
   float tolerance_;
   float voxel_leaf_size_;
   int min_points_number_per_voxel_;
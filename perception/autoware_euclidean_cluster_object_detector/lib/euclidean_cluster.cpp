@@ -17,10 +17,56 @@
 #include <pcl/kdtree/kdtree.h>
 #include <pcl/segmentation/extract_clusters.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <numeric>
 #include <vector>
 
 namespace autoware::euclidean_cluster
 {
+namespace
+{
+class UnionFind
+{
+public:
+  explicit UnionFind(const size_t size) : parents_(size)
+  {
+    std::iota(parents_.begin(), parents_.end(), 0);
+  }
+
+  int find(int i)
+  {
+    while (parents_[i] != i) {
+      parents_[i] = parents_[parents_[i]];
+      i = parents_[i];
+    }
+    return i;
+  }
+
+  // the root is the smallest index in the set
+  void unite(int a, int b)
+  {
+    a = find(a);
+    b = find(b);
+    if (a == b) {
+      return;
+    }
+    if (a < b) {
+      std::swap(a, b);
+    }
+    parents_[a] = b;
+  }
+
+private:
+  std::vector<int> parents_;
+};
+
+// the upper limit of the tiles along an axis, which bounds the tiles of a pointcloud with outliers
+constexpr int max_tile_num_per_axis = 64;
+}  // namespace
+
 EuclideanCluster::EuclideanCluster()
 {
 }
@@ -35,6 +81,77 @@ EuclideanCluster::EuclideanCluster(
 : EuclideanClusterInterface(use_height, min_cluster_size, max_cluster_size), tolerance_(tolerance)
 {
 }
+
+EuclideanCluster::~EuclideanCluster()
+{
+  stopWorkers();
+}
+
+void EuclideanCluster::setNumThreads(int num_threads)
+{
+  num_threads_ = num_threads;
+  stopWorkers();
+  startWorkers(num_threads - 1);
+}
+
+void EuclideanCluster::startWorkers(int worker_num)
+{
+  stop_workers_ = false;
+  workers_.reserve(std::max(worker_num, 0));
+  for (int i = 0; i < worker_num; ++i) {
+    workers_.emplace_back(&EuclideanCluster::runWorkers, this, task_id_);
+  }
+}
+
+void EuclideanCluster::stopWorkers()
+{
+  {
+    std::lock_guard<std::mutex> lock(workers_mutex_);
+    stop_workers_ = true;
+  }
+  task_cv_.notify_all();
+  for (auto & worker : workers_) {
+    worker.join();
+  }
+  workers_.clear();
+}
+
+void EuclideanCluster::runWorkers(uint64_t task_id)
+{
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(workers_mutex_);
+      task_cv_.wait(lock, [&] { return stop_workers_ || task_id_ != task_id; });
+      if (stop_workers_) {
+        return;
+      }
+      task_id = task_id_;
+      task = task_;
+    }
+    task();
+    {
+      std::lock_guard<std::mutex> lock(workers_mutex_);
+      --busy_worker_num_;
+    }
+    done_cv_.notify_one();
+  }
+}
+
+void EuclideanCluster::runOnAllThreads(const std::function<void()> & task)
+{
+  {
+    std::lock_guard<std::mutex> lock(workers_mutex_);
+    task_ = task;
+    ++task_id_;
+    busy_worker_num_ = workers_.size();
+  }
+  task_cv_.notify_all();
+  task();
+  std::unique_lock<std::mutex> lock(workers_mutex_);
+  done_cv_.wait(lock, [this] { return busy_worker_num_ == 0; });
+  task_ = nullptr;
+}
 // TODO(badai-nguyen): implement input field copy for euclidean_cluster.cpp
 bool EuclideanCluster::cluster(
   const sensor_msgs::msg::PointCloud2::ConstSharedPtr & pointcloud_msg,
@@ -59,6 +176,32 @@ bool EuclideanCluster::cluster(
 bool EuclideanCluster::cluster(
   const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud,
   std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters)
+{
+  ClusterIndices cluster_indices;
+  if (!cluster(pointcloud, cluster_indices)) {
+    return false;
+  }
+
+  // build output
+  {
+    for (size_t i = 0; i < cluster_indices.size(); ++i) {
+      pcl::PointCloud<pcl::PointXYZ>::Ptr cloud_cluster(new pcl::PointCloud<pcl::PointXYZ>);
+      cloud_cluster->points.reserve(cluster_indices.clusterSize(i));
+      for (const int * it = cluster_indices.clusterBegin(i); it != cluster_indices.clusterEnd(i);
+           ++it) {
+        cloud_cluster->points.push_back(pointcloud->points[*it]);
+      }
+      clusters.push_back(*cloud_cluster);
+      clusters.back().width = cloud_cluster->points.size();
+      clusters.back().height = 1;
+      clusters.back().is_dense = false;
+    }
+  }
+  return true;
+}
+
+bool EuclideanCluster::cluster(
+  const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud, ClusterIndices & clusters)
 {
   // convert 2d pointcloud
   pcl::PointCloud<pcl::PointXYZ>::ConstPtr pointcloud_ptr(new pcl::PointCloud<pcl::PointXYZ>);
@@ -76,6 +219,11 @@ bool EuclideanCluster::cluster(
     pointcloud_ptr = pointcloud;
   }
 
+  if (num_threads_ > 1) {
+    clusterInTiles(pointcloud_ptr, clusters);
+    return true;
+  }
+
   // create tree
   pcl::search::KdTree<pcl::PointXYZ>::Ptr tree(new pcl::search::KdTree<pcl::PointXYZ>);
   tree->setInputCloud(pointcloud_ptr);
@@ -91,19 +239,172 @@ bool EuclideanCluster::cluster(
   pcl_euclidean_cluster.extract(cluster_indices);
 
   // build output
+  clusters.clear();
+  size_t point_num = 0;
+  for (const auto & cluster : cluster_indices) {
+    point_num += cluster.indices.size();
+  }
+  clusters.reserve(cluster_indices.size(), point_num);
+  for (const auto & cluster : cluster_indices) {
+    clusters.addCluster(cluster.indices.begin(), cluster.indices.end());
+  }
+  return true;
+}
+
+void EuclideanCluster::clusterInTiles(
+  const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud, ClusterIndices & clusters)
+{
+  const auto & points = pointcloud->points;
+  const auto is_finite = [](const pcl::PointXYZ & point) {
+    return std::isfinite(point.x) && std::isfinite(point.y) && std::isfinite(point.z);
+  };
+
+  // create the tiles over the XY range of the pointcloud
+  float min_x = std::numeric_limits<float>::max();
+  float min_y = std::numeric_limits<float>::max();
+  float max_x = std::numeric_limits<float>::lowest();
+  float max_y = std::numeric_limits<float>::lowest();
+  for (const auto & point : points) {
+    if (is_finite(point)) {
+      min_x = std::min(min_x, point.x);
+      min_y = std::min(min_y, point.y);
+      max_x = std::max(max_x, point.x);
+      max_y = std::max(max_y, point.y);
+    }
+  }
+  const float tile_size = std::max(
+    {tile_size_, (max_x - min_x) / max_tile_num_per_axis,
+     (max_y - min_y) / max_tile_num_per_axis});
+  const int tile_num_x = min_x <= max_x ? static_cast<int>((max_x - min_x) / tile_size) + 1 : 0;
+  const int tile_num_y = min_y <= max_y ? static_cast<int>((max_y - min_y) / tile_size) + 1 : 0;
+  const size_t tile_num = static_cast<size_t>(tile_num_x) * static_cast<size_t>(tile_num_y);
+  const auto to_tile_idx = [&](const float value, const float min_value, const int tile_num) {
+    const int tile_idx = static_cast<int>(std::floor((value - min_value) / tile_size));
+    return std::clamp(tile_idx, 0, tile_num - 1);
+  };
+
+  // put each point into the tiles whose area expanded by the tolerance contains it, so that every
+  // pair of points within the tolerance is in the same tile at least once
+  std::vector<size_t> tile_offsets(tile_num + 1, 0);
+  const auto for_each_tile = [&](const pcl::PointXYZ & point, const auto & func) {
+    const int first_x = to_tile_idx(point.x - tolerance_, min_x, tile_num_x);
+    const int last_x = to_tile_idx(point.x + tolerance_, min_x, tile_num_x);
+    const int first_y = to_tile_idx(point.y - tolerance_, min_y, tile_num_y);
+    const int last_y = to_tile_idx(point.y + tolerance_, min_y, tile_num_y);
+    for (int x = first_x; x <= last_x; ++x) {
+      for (int y = first_y; y <= last_y; ++y) {
+        func(static_cast<size_t>(x) * tile_num_y + y);
+      }
+    }
+  };
+  for (const auto & point : points) {
+    if (is_finite(point)) {
+      for_each_tile(point, [&](const size_t tile_idx) { ++tile_offsets[tile_idx + 1]; });
+    }
+  }
+  std::partial_sum(tile_offsets.begin(), tile_offsets.end(), tile_offsets.begin());
+  std::vector<int> tile_point_indices(tile_offsets.back());
   {
-    for (const auto & cluster : cluster_indices) {
-      pcl::PointCloud<pcl::PointXYZ>::Ptr cloud_cluster(new pcl::PointCloud<pcl::PointXYZ>);
-      for (const auto & point_idx : cluster.indices) {
-        cloud_cluster->points.push_back(pointcloud->points[point_idx]);
+    std::vector<size_t> cursors(tile_offsets.begin(), tile_offsets.end() - 1);
+    for (size_t i = 0; i < points.size(); ++i) {
+      if (is_finite(points[i])) {
+        for_each_tile(points[i], [&](const size_t tile_idx) {
+          tile_point_indices[cursors[tile_idx]++] = static_cast<int>(i);
+        });
       }
-      clusters.push_back(*cloud_cluster);
-      clusters.back().width = cloud_cluster->points.size();
-      clusters.back().height = 1;
-      clusters.back().is_dense = false;
     }
   }
-  return true;
+
+  // cluster the tiles without the size limits, which are applied after the merge
+  std::vector<std::vector<pcl::PointIndices>> tile_clusters(tile_num);
+  std::atomic<size_t> next_tile{0};
+  const auto cluster_tiles = [&]() {
+    for (size_t tile_idx = next_tile++; tile_idx < tile_num; tile_idx = next_tile++) {
+      const size_t first = tile_offsets[tile_idx];
+      const size_t last = tile_offsets[tile_idx + 1];
+      if (first == last) {
+        continue;
+      }
+      pcl::PointCloud<pcl::PointXYZ>::Ptr tile_pointcloud(new pcl::PointCloud<pcl::PointXYZ>);
+      tile_pointcloud->points.reserve(last - first);
+      for (size_t i = first; i < last; ++i) {
+        tile_pointcloud->points.push_back(points[tile_point_indices[i]]);
+      }
+      tile_pointcloud->width = tile_pointcloud->points.size();
+      tile_pointcloud->height = 1;
+
+      pcl::search::KdTree<pcl::PointXYZ>::Ptr tree(new pcl::search::KdTree<pcl::PointXYZ>);
+      tree->setInputCloud(tile_pointcloud);
+      pcl::EuclideanClusterExtraction<pcl::PointXYZ> pcl_euclidean_cluster;
+      pcl_euclidean_cluster.setClusterTolerance(tolerance_);
+      pcl_euclidean_cluster.setMinClusterSize(1);
+      pcl_euclidean_cluster.setMaxClusterSize(std::numeric_limits<int>::max());
+      pcl_euclidean_cluster.setSearchMethod(tree);
+      pcl_euclidean_cluster.setInputCloud(tile_pointcloud);
+      pcl_euclidean_cluster.extract(tile_clusters[tile_idx]);
+    }
+  };
+
+  runOnAllThreads(cluster_tiles);
+
+  // merge the clusters sharing points across the tile borders
+  UnionFind union_find(points.size());
+  for (size_t tile_idx = 0; tile_idx < tile_num; ++tile_idx) {
+    const int * tile_indices = &tile_point_indices[tile_offsets[tile_idx]];
+    for (const auto & cluster : tile_clusters[tile_idx]) {
+      const int root = tile_indices[cluster.indices.front()];
+      for (const auto & local_idx : cluster.indices) {
+        union_find.unite(root, tile_indices[local_idx]);
+      }
+    }
+  }
+
+  // apply the size limits, and order the clusters by size as pcl::EuclideanClusterExtraction does.
+  // The non-finite points are in no tile, so they are left out instead of being singleton clusters.
+  std::vector<int> roots(points.size(), -1);
+  std::vector<size_t> cluster_sizes(points.size(), 0);
+  for (size_t i = 0; i < points.size(); ++i) {
+    if (is_finite(points[i])) {
+      roots[i] = union_find.find(static_cast<int>(i));
+      ++cluster_sizes[roots[i]];
+    }
+  }
+  const auto is_valid_size = [this](const size_t cluster_size) {
+    const int size = static_cast<int>(cluster_size);
+    return min_cluster_size_ <= size && size <= max_cluster_size_;
+  };
+  std::vector<int> valid_roots;
+  for (size_t i = 0; i < points.size(); ++i) {
+    if (roots[i] == static_cast<int>(i) && is_valid_size(cluster_sizes[i])) {
+      valid_roots.push_back(static_cast<int>(i));
+    }
+  }
+  std::stable_sort(valid_roots.begin(), valid_roots.end(), [&](const int a, const int b) {
+    return cluster_sizes[a] > cluster_sizes[b];
+  });
+
+  // build output, keeping the points of each cluster in ascending order
+  std::vector<size_t> cluster_offsets(points.size(), 0);
+  size_t point_num = 0;
+  for (const auto root : valid_roots) {
+    cluster_offsets[root] = point_num;
+    point_num += cluster_sizes[root];
+  }
+  std::vector<int> sorted_indices(point_num);
+  std::vector<size_t> cursors = cluster_offsets;
+  for (size_t i = 0; i < points.size(); ++i) {
+    const int root = roots[i];
+    if (root >= 0 && is_valid_size(cluster_sizes[root])) {
+      sorted_indices[cursors[root]++] = static_cast<int>(i);
+    }
+  }
+
+  clusters.clear();
+  clusters.reserve(valid_roots.size(), point_num);
+  for (const auto root : valid_roots) {
+    const auto first = sorted_indices.begin() + cluster_offsets[root];
+    clusters.addCluster(first, first + cluster_sizes[root]);
+  }
 }
 
 }  // namespace autoware::euclidean_cluster
@@ -17,10 +17,133 @@
 #include <sensor_msgs/msg/point_field.hpp>
 #include <sensor_msgs/point_cloud2_iterator.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <vector>
 
 namespace autoware::euclidean_cluster
 {
+namespace
+{
+constexpr uint8_t color_data[] = {200, 0,   0, 0,   200, 0,   0, 0,   200,
+                                  200, 200, 0, 200, 0,   200, 0, 200, 200};  // 6 pattern
+
+autoware_perception_msgs::msg::DetectedObject createObject(
+  const geometry_msgs::msg::Point & centroid)
+{
+  autoware_perception_msgs::msg::DetectedObject object;
+  object.kinematics.pose_with_covariance.pose.position = centroid;
+  autoware_perception_msgs::msg::ObjectClassification classification;
+  classification.label = autoware_perception_msgs::msg::ObjectClassification::UNKNOWN;
+  classification.probability = 1.0f;
+  object.classification.emplace_back(classification);
+  return object;
+}
+
+// writes the points into the data buffer directly instead of going through six iterators
+class ColoredPointCloudWriter
+{
+public:
+  ColoredPointCloudWriter(
+    const std_msgs::msg::Header & header, const size_t pointcloud_size,
+    sensor_msgs::msg::PointCloud2 & output)
+  : output_(output)
+  {
+    output_.header = header;
+
+    sensor_msgs::PointCloud2Modifier modifier(output_);
+    modifier.setPointCloud2Fields(
+      4, "x", 1, sensor_msgs::msg::PointField::FLOAT32, "y", 1,
+      sensor_msgs::msg::PointField::FLOAT32, "z", 1, sensor_msgs::msg::PointField::FLOAT32, "rgb",
+      1, sensor_msgs::msg::PointField::FLOAT32);
+    modifier.resize(pointcloud_size);
+
+    x_offset_ = output_.fields.at(0).offset;
+    y_offset_ = output_.fields.at(1).offset;
+    z_offset_ = output_.fields.at(2).offset;
+    rgb_offset_ = output_.fields.at(3).offset;
+
+    output_.width = pointcloud_size;
+    output_.height = 1;
+    output_.is_dense = false;
+  }
+
+  void write(const pcl::PointXYZ & point, const size_t cluster_idx)
+  {
+    uint8_t * point_data = &output_.data[data_size_];
+    std::memcpy(point_data + x_offset_, &point.x, sizeof(float));
+    std::memcpy(point_data + y_offset_, &point.y, sizeof(float));
+    std::memcpy(point_data + z_offset_, &point.z, sizeof(float));
+    // the packed rgb field is b, g, r, a in memory
+    const uint8_t * color = &color_data[3 * (cluster_idx % 6)];
+    point_data[rgb_offset_ + 0] = color[2];
+    point_data[rgb_offset_ + 1] = color[1];
+    point_data[rgb_offset_ + 2] = color[0];
+    data_size_ += output_.point_step;
+  }
+
+private:
+  sensor_msgs::msg::PointCloud2 & output_;
+  size_t data_size_{0};
+  uint32_t x_offset_;
+  uint32_t y_offset_;
+  uint32_t z_offset_;
+  uint32_t rgb_offset_;
+};
+}  // namespace
+
+ClusterFeature computeClusterFeature(
+  const pcl::PointCloud<pcl::PointXYZ> & pointcloud, const ClusterIndices & clusters,
+  const size_t cluster_idx)
+{
+  ClusterFeature feature;
+  feature.min_point.x = feature.min_point.y = feature.min_point.z =
+    std::numeric_limits<double>::max();
+  feature.max_point.x = feature.max_point.y = feature.max_point.z =
+    std::numeric_limits<double>::lowest();
+
+  const auto * points = pointcloud.points.data();
+  for (const int * it = clusters.clusterBegin(cluster_idx); it != clusters.clusterEnd(cluster_idx);
+       ++it) {
+    const auto & point = points[*it];
+    feature.centroid.x += point.x;
+    feature.centroid.y += point.y;
+    feature.centroid.z += point.z;
+    feature.min_point.x = std::min<double>(feature.min_point.x, point.x);
+    feature.min_point.y = std::min<double>(feature.min_point.y, point.y);
+    feature.min_point.z = std::min<double>(feature.min_point.z, point.z);
+    feature.max_point.x = std::max<double>(feature.max_point.x, point.x);
+    feature.max_point.y = std::max<double>(feature.max_point.y, point.y);
+    feature.max_point.z = std::max<double>(feature.max_point.z, point.z);
+  }
+  feature.point_num = clusters.clusterSize(cluster_idx);
+  feature.centroid.x = feature.centroid.x / static_cast<float>(feature.point_num);
+  feature.centroid.y = feature.centroid.y / static_cast<float>(feature.point_num);
+  feature.centroid.z = feature.centroid.z / static_cast<float>(feature.point_num);
+  return feature;
+}
+
+geometry_msgs::msg::Point computeClusterCentroid(
+  const pcl::PointCloud<pcl::PointXYZ> & pointcloud, const ClusterIndices & clusters,
+  const size_t cluster_idx)
+{
+  geometry_msgs::msg::Point centroid;
+  const auto * points = pointcloud.points.data();
+  for (const int * it = clusters.clusterBegin(cluster_idx); it != clusters.clusterEnd(cluster_idx);
+       ++it) {
+    const auto & point = points[*it];
+    centroid.x += point.x;
+    centroid.y += point.y;
+    centroid.z += point.z;
+  }
+  const size_t point_num = clusters.clusterSize(cluster_idx);
+  centroid.x = centroid.x / static_cast<float>(point_num);
+  centroid.y = centroid.y / static_cast<float>(point_num);
+  centroid.z = centroid.z / static_cast<float>(point_num);
+  return centroid;
+}
+
 geometry_msgs::msg::Point getCentroid(const sensor_msgs::msg::PointCloud2 & pointcloud)
 {
   geometry_msgs::msg::Point centroid;
@@ -49,17 +172,29 @@ void convertPointCloudClusters2Msg(
   autoware_perception_msgs::msg::DetectedObjects & msg)
 {
   msg.header = header;
+  msg.objects.reserve(msg.objects.size() + clusters.size());
   for (const auto & cluster : clusters) {
-    sensor_msgs::msg::PointCloud2 ros_pointcloud;
-    autoware_perception_msgs::msg::DetectedObject object;
-    pcl::toROSMsg(cluster, ros_pointcloud);
-    ros_pointcloud.header = header;
-    object.kinematics.pose_with_covariance.pose.position = getCentroid(ros_pointcloud);
-    autoware_perception_msgs::msg::ObjectClassification classification;
-    classification.label = autoware_perception_msgs::msg::ObjectClassification::UNKNOWN;
-    classification.probability = 1.0f;
-    object.classification.emplace_back(classification);
-    msg.objects.push_back(object);
+    geometry_msgs::msg::Point centroid;
+    for (const auto & point : cluster.points) {
+      centroid.x += point.x;
+      centroid.y += point.y;
+      centroid.z += point.z;
+    }
+    centroid.x = centroid.x / static_cast<float>(cluster.size());
+    centroid.y = centroid.y / static_cast<float>(cluster.size());
+    centroid.z = centroid.z / static_cast<float>(cluster.size());
+    msg.objects.push_back(createObject(centroid));
+  }
+}
+
+void convertClusterIndices2Msg(
+  const std_msgs::msg::Header & header, const pcl::PointCloud<pcl::PointXYZ> & pointcloud,
+  const ClusterIndices & clusters, autoware_perception_msgs::msg::DetectedObjects & msg)
+{
+  msg.header = header;
+  msg.objects.reserve(msg.objects.size() + clusters.size());
+  for (size_t i = 0; i < clusters.size(); ++i) {
+    msg.objects.push_back(createObject(computeClusterCentroid(pointcloud, clusters, i)));
   }
 }
 
@@ -67,45 +202,28 @@ void convertClusters2SensorMsg(
   const std_msgs::msg::Header & header, const std::vector<pcl::PointCloud<pcl::PointXYZ>> & input,
   sensor_msgs::msg::PointCloud2 & output)
 {
-  output.header = header;
-
   size_t pointcloud_size = 0;
   for (const auto & cluster : input) {
     pointcloud_size += cluster.size();
   }
 
-  sensor_msgs::PointCloud2Modifier modifier(output);
-  modifier.setPointCloud2Fields(
-    4, "x", 1, sensor_msgs::msg::PointField::FLOAT32, "y", 1, sensor_msgs::msg::PointField::FLOAT32,
-    "z", 1, sensor_msgs::msg::PointField::FLOAT32, "rgb", 1, sensor_msgs::msg::PointField::FLOAT32);
-  modifier.resize(pointcloud_size);
-
-  sensor_msgs::PointCloud2Iterator<float> iter_out_x(output, "x");
-  sensor_msgs::PointCloud2Iterator<float> iter_out_y(output, "y");
-  sensor_msgs::PointCloud2Iterator<float> iter_out_z(output, "z");
-  sensor_msgs::PointCloud2Iterator<uint8_t> iter_out_r(output, "r");
-  sensor_msgs::PointCloud2Iterator<uint8_t> iter_out_g(output, "g");
-  sensor_msgs::PointCloud2Iterator<uint8_t> iter_out_b(output, "b");
-
-  constexpr uint8_t color_data[] = {200, 0,   0, 0,   200, 0,   0, 0,   200,
-                                    200, 200, 0, 200, 0,   200, 0, 200, 200};  // 6 pattern
-  size_t clusters_size = input.size();
-  for (size_t i = 0; i < clusters_size; ++i) {
-    const auto & cluster = input.at(i);
-    size_t cluster_size = cluster.size();
-    for (size_t j = 0; j < cluster_size;
-         ++iter_out_x, ++iter_out_y, ++iter_out_z, ++iter_out_r, ++iter_out_g, ++iter_out_b, j++) {
-      *iter_out_x = cluster.points[j].x;
-      *iter_out_y = cluster.points[j].y;
-      *iter_out_z = cluster.points[j].z;
-      *iter_out_r = color_data[3 * (i % 6) + 0];
-      *iter_out_g = color_data[3 * (i % 6) + 1];
-      *iter_out_b = color_data[3 * (i % 6) + 2];
+  ColoredPointCloudWriter writer(header, pointcloud_size, output);
+  for (size_t i = 0; i < input.size(); ++i) {
+    for (const auto & point : input[i].points) {
+      writer.write(point, i);
     }
   }
+}
 
-  output.width = pointcloud_size;
-  output.height = 1;
-  output.is_dense = false;
+void convertClusterIndices2SensorMsg(
+  const std_msgs::msg::Header & header, const pcl::PointCloud<pcl::PointXYZ> & pointcloud,
+  const ClusterIndices & clusters, sensor_msgs::msg::PointCloud2 & output)
+{
+  ColoredPointCloudWriter writer(header, clusters.pointNum(), output);
+  for (size_t i = 0; i < clusters.size(); ++i) {
+    for (const int * it = clusters.clusterBegin(i); it != clusters.clusterEnd(i); ++it) {
+      writer.write(pointcloud.points[*it], i);
+    }
+  }
 }
 }  // namespace autoware::euclidean_cluster
@@ -18,8 +18,8 @@
 #include <pcl/kdtree/kdtree.h>
 #include <pcl/segmentation/extract_clusters.h>
 
+#include <algorithm>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 namespace autoware::euclidean_cluster
@@ -98,14 +98,12 @@ bool VoxelGridBasedEuclideanCluster::cluster(
 
   // create voxel
   pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud(new pcl::PointCloud<pcl::PointXYZ>);
-  int point_step = pointcloud_msg->point_step;
   pcl::fromROSMsg(*pointcloud_msg, *pointcloud);
   pcl::PointCloud<pcl::PointXYZ>::Ptr voxel_map_ptr(new pcl::PointCloud<pcl::PointXYZ>);
-  voxel_grid_.setLeafSize(voxel_leaf_size_, voxel_leaf_size_, 100000.0);
-  voxel_grid_.setMinimumPointsNumberPerVoxel(min_points_number_per_voxel_);
-  voxel_grid_.setInputCloud(pointcloud);
-  voxel_grid_.setSaveLeafLayout(true);
-  voxel_grid_.filter(*voxel_map_ptr);
+  voxel_grid_.set_leaf_size(voxel_leaf_size_, voxel_leaf_size_, 100000.0f);
+  voxel_grid_.set_min_points_number_per_voxel(
+    static_cast<size_t>(std::max(min_points_number_per_voxel_, 0)));
+  voxel_grid_.filter(*pointcloud, *voxel_map_ptr);
 
   // voxel is pressed 2d
   pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud_2d_ptr(new pcl::PointCloud<pcl::PointXYZ>);
@@ -131,56 +129,62 @@ bool VoxelGridBasedEuclideanCluster::cluster(
   pcl_euclidean_cluster.setInputCloud(pointcloud_2d_ptr);
   pcl_euclidean_cluster.extract(cluster_indices);
 
-  // create map to search cluster index from voxel grid index
-  std::unordered_map</* voxel grid index */ int, /* cluster index */ int> map;
-  std::vector<sensor_msgs::msg::PointCloud2> temporary_clusters;  // no check about cluster size
-  std::vector<size_t> clusters_data_size;
-  temporary_clusters.resize(cluster_indices.size());
+  // cluster index of each voxel, -1 if the voxel is not in any cluster
+  std::vector<int> voxel_cluster_indices(voxel_map_ptr->size(), -1);
   size_t clusters_size = cluster_indices.size();
   for (size_t cluster_idx = 0; cluster_idx < clusters_size; ++cluster_idx) {
-    const auto & cluster = cluster_indices.at(cluster_idx);
-    auto & temporary_cluster = temporary_clusters.at(cluster_idx);
-    for (const auto & point_idx : cluster.indices) {
-      map[point_idx] = cluster_idx;
+    for (const auto & point_idx : cluster_indices.at(cluster_idx).indices) {
+      voxel_cluster_indices.at(point_idx) = static_cast<int>(cluster_idx);
     }
-    temporary_cluster.height = pointcloud_msg->height;
-    temporary_cluster.fields = pointcloud_msg->fields;
-    temporary_cluster.point_step = point_step;
-    temporary_cluster.data.resize(cluster.indices.size() * point_step);
-    clusters_data_size.push_back(0);
   }
 
-  // create vector of point cloud cluster. vector index is voxel grid index.
+  // find the cluster of each point. A cluster stops collecting points once it exceeds
+  // max_cluster_size, since it is skipped anyway.
   size_t pointcloud_size = pointcloud->points.size();
+  const auto & point_voxel_indices = voxel_grid_.get_point_voxel_indices();
+  std::vector<int> point_cluster_indices(pointcloud_size, -1);
+  std::vector<size_t> cluster_point_offsets(clusters_size + 1, 0);
   for (size_t i = 0; i < pointcloud_size; ++i) {
-    const auto & point = pointcloud->points.at(i);
-    const int index =
-      voxel_grid_.getCentroidIndexAt(voxel_grid_.getGridCoordinates(point.x, point.y, point.z));
-    if (map.find(index) != map.end()) {
-      auto & cluster_data_size = clusters_data_size.at(map[index]);
-      if (
-        cluster_data_size >
-        static_cast<std::size_t>(max_cluster_size_) * static_cast<std::size_t>(point_step)) {
-        continue;
-      }
-      std::memcpy(
-        &temporary_clusters.at(map[index]).data[cluster_data_size],
-        &pointcloud_msg->data[i * point_step], point_step);
-      cluster_data_size += point_step;
-      if (cluster_data_size == temporary_clusters.at(map[index]).data.size()) {
-        temporary_clusters.at(map[index])
-          .data.resize(temporary_clusters.at(map[index]).data.size() * 2);
+    const int voxel_idx = point_voxel_indices.at(i);
+    if (voxel_idx < 0) {
+      continue;
+    }
+    const int cluster_idx = voxel_cluster_indices.at(voxel_idx);
+    if (cluster_idx < 0) {
+      continue;
+    }
+    auto & cluster_point_num = cluster_point_offsets.at(cluster_idx + 1);
+    if (cluster_point_num > static_cast<std::size_t>(max_cluster_size_)) {
+      continue;
+    }
+    point_cluster_indices.at(i) = cluster_idx;
+    ++cluster_point_num;
+  }
+
+  // sort the point indices by cluster, keeping the order of the points in each cluster
+  for (size_t i = 0; i < clusters_size; ++i) {
+    cluster_point_offsets.at(i + 1) += cluster_point_offsets.at(i);
+  }
+  std::vector<int> sorted_point_indices(cluster_point_offsets.back());
+  {
+    std::vector<size_t> cursors(cluster_point_offsets.begin(), cluster_point_offsets.end() - 1);
+    for (size_t i = 0; i < pointcloud_size; ++i) {
+      const int cluster_idx = point_cluster_indices.at(i);
+      if (cluster_idx >= 0) {
+        sorted_point_indices.at(cursors.at(cluster_idx)++) = static_cast<int>(i);
       }
     }
   }
 
   // build output and check cluster size
   {
+    ClusterIndices valid_clusters;
+    valid_clusters.reserve(clusters_size, sorted_point_indices.size());
     size_t skipped_cluster_count = 0;  // Count the skipped clusters
-    size_t temporary_clusters_size = temporary_clusters.size();
-    for (size_t i = 0; i < temporary_clusters_size; ++i) {
-      auto & i_cluster_data_size = clusters_data_size.at(i);
-      int cluster_size = static_cast<int>(i_cluster_data_size / point_step);
+    for (size_t i = 0; i < clusters_size; ++i) {
+      const auto first = cluster_point_offsets.at(i);
+      const auto last = cluster_point_offsets.at(i + 1);
+      int cluster_size = static_cast<int>(last - first);
       if (cluster_size < min_cluster_size_) {
         // Cluster size is below the minimum threshold; skip without messaging.
         continue;
@@ -190,42 +194,21 @@ bool VoxelGridBasedEuclideanCluster::cluster(
         skipped_cluster_count++;
         continue;
       }
-      const auto & cluster = temporary_clusters.at(i);
-
-      // Create a temporary cluster with correct size for getting the centroid
-      sensor_msgs::msg::PointCloud2 temp_cluster = cluster;
-      temp_cluster.data.resize(i_cluster_data_size);
-      // temp_cluster.header = pointcloud_msg->header;
-      // temp_cluster.is_bigendian = pointcloud_msg->is_bigendian;
-      // temp_cluster.is_dense = pointcloud_msg->is_dense;
-      // temp_cluster.point_step = point_step;
-      // temp_cluster.row_step = i_cluster_data_size / pointcloud_msg->height;
-      // temp_cluster.width = i_cluster_data_size / point_step / pointcloud_msg->height;
-
-      autoware_perception_msgs::msg::DetectedObject object;
-      object.kinematics.pose_with_covariance.pose.position = getCentroid(temp_cluster);
-
-      autoware_perception_msgs::msg::ObjectClassification classification;
-      classification.label = autoware_perception_msgs::msg::ObjectClassification::UNKNOWN;
-      classification.probability = 1.0f;
-      object.classification.emplace_back(classification);
+      valid_clusters.addCluster(
+        sorted_point_indices.begin() + first, sorted_point_indices.begin() + last);
+    }
 
-      objects.objects.push_back(object);
+    convertClusterIndices2Msg(pointcloud_msg->header, *pointcloud, valid_clusters, objects);
 
+    for (size_t i = 0; i < valid_clusters.size(); ++i) {
       pcl::PointCloud<pcl::PointXYZ> cluster_point_cloud;
-
-      for (sensor_msgs::PointCloud2ConstIterator<float> iter_x(cluster, "x"), iter_y(cluster, "y"),
-           iter_z(cluster, "z");
-           iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
-        pcl::PointXYZ point;
-        point.x = *iter_x;
-        point.y = *iter_y;
-        point.z = *iter_z;
-        cluster_point_cloud.push_back(point);
+      cluster_point_cloud.reserve(valid_clusters.clusterSize(i));
+      for (const int * it = valid_clusters.clusterBegin(i); it != valid_clusters.clusterEnd(i);
+           ++it) {
+        cluster_point_cloud.push_back(pointcloud->points[*it]);
       }
       clusters.push_back(cluster_point_cloud);
     }
-    objects.header = pointcloud_msg->header;
     // Publish the diagnostics summary.
     publishDiagnosticsSummary(skipped_cluster_count, pointcloud_msg);
   }
@@ -28,8 +28,12 @@ EuclideanClusterNode::EuclideanClusterNode(const rclcpp::NodeOptions & options)
   const int min_cluster_size = this->declare_parameter("min_cluster_size", 3);
   const int max_cluster_size = this->declare_parameter("max_cluster_size", 200);
   const float tolerance = this->declare_parameter("tolerance", 1.0);
+  const int num_threads = this->declare_parameter("num_threads", 1);
+  const float tile_size = this->declare_parameter("tile_size", 20.0);
   cluster_ =
     std::make_shared<EuclideanCluster>(use_height, min_cluster_size, max_cluster_size, tolerance);
+  cluster_->setNumThreads(num_threads);
+  cluster_->setTileSize(tile_size);
 
   using std::placeholders::_1;
   pointcloud_sub_ = this->create_subscription<sensor_msgs::msg::PointCloud2>(
@@ -56,18 +60,18 @@ void EuclideanClusterNode::onPointCloud(
   pcl::fromROSMsg(*input_msg, *raw_pointcloud_ptr);
 
   // clustering
-  std::vector<pcl::PointCloud<pcl::PointXYZ>> clusters;
+  ClusterIndices clusters;
   cluster_->cluster(raw_pointcloud_ptr, clusters);
 
   // build output msg
   autoware_perception_msgs::msg::DetectedObjects output;
-  convertPointCloudClusters2Msg(input_msg->header, clusters, output);
+  convertClusterIndices2Msg(input_msg->header, *raw_pointcloud_ptr, clusters, output);
   cluster_pub_->publish(output);
 
   // build debug msg
   if (debug_pub_->get_subscription_count() >= 1) {
     sensor_msgs::msg::PointCloud2 debug;
-    convertClusters2SensorMsg(input_msg->header, clusters, debug);
+    convertClusterIndices2SensorMsg(input_msg->header, *raw_pointcloud_ptr, clusters, debug);
     debug_pub_->publish(debug);
   }
   if (debug_publisher_) {
@@ -0,0 +1,125 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/euclidean_cluster_object_detector/euclidean_cluster.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+using autoware::euclidean_cluster::ClusterIndices;
+using autoware::euclidean_cluster::EuclideanCluster;
+
+// random points and lines of points which cross many tiles
+pcl::PointCloud<pcl::PointXYZ>::ConstPtr generatePointCloud(const int nb_points)
+{
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<float> dist_xy(-40.0, 40.0);
+  std::uniform_real_distribution<float> dist_z(-1.0, 3.0);
+  std::uniform_real_distribution<float> dist_noise(0.0, 0.2);
+
+  pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud(new pcl::PointCloud<pcl::PointXYZ>);
+  for (int i = 0; i < nb_points; ++i) {
+    if (i % 3 == 0) {
+      const float x = dist_xy(gen);
+      pointcloud->push_back(pcl::PointXYZ(x, 0.3 * x + dist_noise(gen), dist_z(gen)));
+    } else {
+      pointcloud->push_back(pcl::PointXYZ(dist_xy(gen), dist_xy(gen), dist_z(gen)));
+    }
+  }
+  return pointcloud;
+}
+
+std::vector<std::vector<int>> sortClusters(const ClusterIndices & clusters)
+{
+  std::vector<std::vector<int>> sorted_clusters;
+  for (size_t i = 0; i < clusters.size(); ++i) {
+    sorted_clusters.emplace_back(clusters.clusterBegin(i), clusters.clusterEnd(i));
+  }
+  std::sort(sorted_clusters.begin(), sorted_clusters.end());
+  return sorted_clusters;
+}
+}  // namespace
+
+// the clusters of the tiles are the same as the ones of the whole pointcloud
+TEST(EuclideanClusterTest, parallelClustering)
+{
+  const auto pointcloud = generatePointCloud(5000);
+  const float tolerance = 0.7;
+
+  for (const bool use_height : {false, true}) {
+    for (const int min_cluster_size : {1, 3}) {
+      for (const int max_cluster_size : {200, 100000}) {
+        EuclideanCluster serial_cluster(use_height, min_cluster_size, max_cluster_size, tolerance);
+        ClusterIndices expected_clusters;
+        serial_cluster.cluster(pointcloud, expected_clusters);
+
+        for (const float tile_size : {1.0f, 5.0f, 20.0f}) {
+          EuclideanCluster parallel_cluster(
+            use_height, min_cluster_size, max_cluster_size, tolerance);
+          parallel_cluster.setNumThreads(4);
+          parallel_cluster.setTileSize(tile_size);
+          ClusterIndices clusters;
+          parallel_cluster.cluster(pointcloud, clusters);
+
+          EXPECT_EQ(sortClusters(clusters), sortClusters(expected_clusters));
+          for (size_t i = 1; i < clusters.size(); ++i) {
+            EXPECT_GE(clusters.clusterSize(i - 1), clusters.clusterSize(i));
+          }
+        }
+      }
+    }
+  }
+}
+
+// the non-finite points are not clustered, even as singleton clusters with min_cluster_size 1
+TEST(EuclideanClusterTest, parallelClusteringNonFinitePoints)
+{
+  constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+  constexpr float inf = std::numeric_limits<float>::infinity();
+  pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud(new pcl::PointCloud<pcl::PointXYZ>);
+  pointcloud->push_back(pcl::PointXYZ(nan, 0.0, 0.0));
+  pointcloud->push_back(pcl::PointXYZ(0.0, 0.0, 0.0));
+  pointcloud->push_back(pcl::PointXYZ(0.0, inf, 0.0));
+  pointcloud->push_back(pcl::PointXYZ(0.5, 0.0, 0.0));
+  pointcloud->push_back(pcl::PointXYZ(0.0, 0.0, -inf));
+  pointcloud->push_back(pcl::PointXYZ(10.0, 0.0, 0.0));
+
+  for (const bool use_height : {false, true}) {
+    EuclideanCluster parallel_cluster(use_height, 1, 100, 0.7);
+    parallel_cluster.setNumThreads(4);
+    parallel_cluster.setTileSize(1.0f);
+    // the worker threads are reused across the calls
+    for (int i = 0; i < 2; ++i) {
+      ClusterIndices clusters;
+      parallel_cluster.cluster(pointcloud, clusters);
+      // with use_height false, the point with a non-finite z is clustered on the XY plane
+      const auto expected_clusters = use_height
+                                       ? std::vector<std::vector<int>>{{1, 3}, {5}}
+                                       : std::vector<std::vector<int>>{{1, 3, 4}, {5}};
+      EXPECT_EQ(sortClusters(clusters), expected_clusters);
+    }
+  }
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,144 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/euclidean_cluster_object_detector/utils.hpp>
+
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+using autoware::euclidean_cluster::ClusterIndices;
+
+pcl::PointCloud<pcl::PointXYZ> createPointCloud()
+{
+  pcl::PointCloud<pcl::PointXYZ> pointcloud;
+  for (int i = 0; i < 10; ++i) {
+    pointcloud.push_back(pcl::PointXYZ(0.1 * i, -0.2 * i, 0.3 * i));
+  }
+  return pointcloud;
+}
+
+// the clusters {1, 3, 5}, {0, 9} and {2, 4, 6, 7}
+ClusterIndices createClusterIndices()
+{
+  ClusterIndices clusters;
+  for (const auto & indices : std::vector<std::vector<int>>{{1, 3, 5}, {0, 9}, {2, 4, 6, 7}}) {
+    clusters.addCluster(indices.begin(), indices.end());
+  }
+  return clusters;
+}
+
+std::vector<pcl::PointCloud<pcl::PointXYZ>> extractClusters(
+  const pcl::PointCloud<pcl::PointXYZ> & pointcloud, const ClusterIndices & clusters)
+{
+  std::vector<pcl::PointCloud<pcl::PointXYZ>> cluster_pointclouds;
+  for (size_t i = 0; i < clusters.size(); ++i) {
+    pcl::PointCloud<pcl::PointXYZ> cluster_pointcloud;
+    for (const int * it = clusters.clusterBegin(i); it != clusters.clusterEnd(i); ++it) {
+      cluster_pointcloud.push_back(pointcloud.points[*it]);
+    }
+    cluster_pointclouds.push_back(cluster_pointcloud);
+  }
+  return cluster_pointclouds;
+}
+}  // namespace
+
+TEST(EuclideanClusterUtilsTest, clusterIndices)
+{
+  const auto clusters = createClusterIndices();
+  EXPECT_EQ(clusters.size(), 3U);
+  EXPECT_EQ(clusters.pointNum(), 9U);
+  EXPECT_EQ(clusters.clusterSize(0), 3U);
+  EXPECT_EQ(clusters.clusterSize(2), 4U);
+  EXPECT_EQ(*clusters.clusterBegin(1), 0);
+  EXPECT_EQ(*(clusters.clusterEnd(1) - 1), 9);
+
+  ClusterIndices empty_clusters = clusters;
+  empty_clusters.clear();
+  EXPECT_TRUE(empty_clusters.empty());
+  EXPECT_EQ(empty_clusters.pointNum(), 0U);
+}
+
+TEST(EuclideanClusterUtilsTest, computeClusterFeature)
+{
+  const auto pointcloud = createPointCloud();
+  const auto clusters = createClusterIndices();
+
+  const auto feature = autoware::euclidean_cluster::computeClusterFeature(pointcloud, clusters, 0);
+  EXPECT_EQ(feature.point_num, 3U);
+  EXPECT_NEAR(feature.centroid.x, 0.3, 1e-6);
+  EXPECT_NEAR(feature.centroid.y, -0.6, 1e-6);
+  EXPECT_NEAR(feature.centroid.z, 0.9, 1e-6);
+  EXPECT_NEAR(feature.min_point.x, 0.1, 1e-6);
+  EXPECT_NEAR(feature.min_point.y, -1.0, 1e-6);
+  EXPECT_NEAR(feature.max_point.x, 0.5, 1e-6);
+  EXPECT_NEAR(feature.max_point.y, -0.2, 1e-6);
+}
+
+TEST(EuclideanClusterUtilsTest, computeClusterCentroid)
+{
+  const auto pointcloud = createPointCloud();
+  const auto clusters = createClusterIndices();
+
+  for (size_t i = 0; i < clusters.size(); ++i) {
+    const auto centroid =
+      autoware::euclidean_cluster::computeClusterCentroid(pointcloud, clusters, i);
+    const auto feature =
+      autoware::euclidean_cluster::computeClusterFeature(pointcloud, clusters, i);
+    EXPECT_DOUBLE_EQ(centroid.x, feature.centroid.x);
+    EXPECT_DOUBLE_EQ(centroid.y, feature.centroid.y);
+    EXPECT_DOUBLE_EQ(centroid.z, feature.centroid.z);
+  }
+}
+
+// the outputs from the cluster indices are the same as the ones from the cluster pointclouds
+TEST(EuclideanClusterUtilsTest, convertClusterIndices)
+{
+  const auto pointcloud = createPointCloud();
+  const auto clusters = createClusterIndices();
+  const auto cluster_pointclouds = extractClusters(pointcloud, clusters);
+  std_msgs::msg::Header header;
+  header.frame_id = "base_link";
+
+  autoware_perception_msgs::msg::DetectedObjects objects;
+  autoware_perception_msgs::msg::DetectedObjects expected_objects;
+  autoware::euclidean_cluster::convertClusterIndices2Msg(header, pointcloud, clusters, objects);
+  autoware::euclidean_cluster::convertPointCloudClusters2Msg(
+    header, cluster_pointclouds, expected_objects);
+  EXPECT_EQ(objects, expected_objects);
+
+  sensor_msgs::msg::PointCloud2 debug_pointcloud;
+  sensor_msgs::msg::PointCloud2 expected_debug_pointcloud;
+  autoware::euclidean_cluster::convertClusterIndices2SensorMsg(
+    header, pointcloud, clusters, debug_pointcloud);
+  autoware::euclidean_cluster::convertClusters2SensorMsg(
+    header, cluster_pointclouds, expected_debug_pointcloud);
+  EXPECT_EQ(debug_pointcloud, expected_debug_pointcloud);
+  EXPECT_EQ(debug_pointcloud.width, 9U);
+
+  // the color of the second cluster is (0, 200, 0)
+  sensor_msgs::PointCloud2ConstIterator<uint8_t> iter_g(debug_pointcloud, "g");
+  iter_g += 3;
+  EXPECT_EQ(*iter_g, 200);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
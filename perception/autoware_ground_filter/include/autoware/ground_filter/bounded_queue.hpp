@@ -0,0 +1,109 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__GROUND_FILTER__BOUNDED_QUEUE_HPP_
+#define AUTOWARE__GROUND_FILTER__BOUNDED_QUEUE_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+namespace autoware::ground_filter
+{
+/**
+ * @brief FIFO queue to hand off the items between the threads of a pipeline
+ * @details push() waits while the queue is full, so a slow consumer holds back its producer
+ * instead of accumulating the items. A producer which must not wait, e.g. a subscription callback,
+ * uses pushDroppingOldest() instead. After close(), push() fails and pop() fails once the queue
+ * is empty, which stops the threads waiting on the queue.
+ */
+template <class T>
+class BoundedQueue
+{
+public:
+  explicit BoundedQueue(const std::size_t capacity) : capacity_(capacity) {}
+
+  BoundedQueue(const BoundedQueue &) = delete;
+  BoundedQueue & operator=(const BoundedQueue &) = delete;
+
+  /// @brief wait for a free slot and push the item, false if the queue is closed
+  bool push(T item)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_cv_.wait(lock, [this] { return is_closed_ || items_.size() < capacity_; });
+    if (is_closed_) {
+      return false;
+    }
+    items_.push_back(std::move(item));
+    lock.unlock();
+    not_empty_cv_.notify_one();
+    return true;
+  }
+
+  /// @brief push the item without waiting, the oldest item is dropped if the queue is full
+  /// @return false if an item is dropped or the queue is closed
+  bool pushDroppingOldest(T item)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (is_closed_) {
+      return false;
+    }
+    const bool is_full = items_.size() >= capacity_;
+    if (is_full) {
+      items_.pop_front();
+    }
+    items_.push_back(std::move(item));
+    lock.unlock();
+    not_empty_cv_.notify_one();
+    return !is_full;
+  }
+
+  /// @brief wait for an item and pop it, false if the queue is closed and empty
+  bool pop(T & item)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_cv_.wait(lock, [this] { return is_closed_ || !items_.empty(); });
+    if (items_.empty()) {
+      return false;
+    }
+    item = std::move(items_.front());
+    items_.pop_front();
+    lock.unlock();
+    not_full_cv_.notify_one();
+    return true;
+  }
+
+  void close()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      is_closed_ = true;
+    }
+    not_full_cv_.notify_all();
+    not_empty_cv_.notify_all();
+  }
+
+private:
+  std::size_t capacity_;
+  std::deque<T> items_;
+  bool is_closed_{false};
+  std::mutex mutex_;
+  std::condition_variable not_full_cv_;
+  std::condition_variable not_empty_cv_;
+};
+}  // namespace autoware::ground_filter
+
+#endif  // AUTOWARE__GROUND_FILTER__BOUNDED_QUEUE_HPP_
@@ -54,6 +54,20 @@ public:
     point.z = *reinterpret_cast<const float *>(&input->data[data_index + data_offset_z_]);
   }
 
+  inline void getPoint(const uint8_t * point_data, pcl::PointXYZ & point) const
+  {
+    point.x = *reinterpret_cast<const float *>(point_data + data_offset_x_);
+    point.y = *reinterpret_cast<const float *>(point_data + data_offset_y_);
+    point.z = *reinterpret_cast<const float *>(point_data + data_offset_z_);
+  }
+
+  inline void setPoint(const pcl::PointXYZ & point, uint8_t * point_data) const
+  {
+    *reinterpret_cast<float *>(point_data + data_offset_x_) = point.x;
+    *reinterpret_cast<float *>(point_data + data_offset_y_) = point.y;
+    *reinterpret_cast<float *>(point_data + data_offset_z_) = point.z;
+  }
+
 private:
   // data field offsets
   int data_offset_x_ = 0;
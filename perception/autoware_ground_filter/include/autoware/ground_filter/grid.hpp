@@ -20,7 +20,9 @@
 #include <autoware_utils_math/normalization.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -71,6 +73,32 @@ float pseudoArcTan2(const float y, const float x)
   }
 }
 
+inline float pseudoArcTan2Branchless(const float y, const float x)
+{
+  // the same value as pseudoArcTan2 except on the y axis (x == 0), computed without branches so
+  // that a loop over the points is vectorized. The zone is selected by multiplying with 0 or 1,
+  // which is exact.
+
+  const float x_abs = std::abs(x);
+  const float y_abs = std::abs(y);
+  const float ratio = std::min(x_abs, y_abs) /
+                      std::max(std::max(x_abs, y_abs), std::numeric_limits<float>::denorm_min());
+  const float angle = ratio * M_PI_4f;
+
+  // each of the 8 zones of pseudoArcTan2 is an offset plus or minus the angle
+  const int is_y_major = !(x_abs > y_abs);
+  const int is_x_negative = x < 0.0f;
+  const int is_y_negative = y < 0.0f;
+  const float y_major = static_cast<float>(is_y_major);
+  const float x_negative = static_cast<float>(is_x_negative);
+  const float y_negative = static_cast<float>(is_y_negative);
+  const float x_major_offset = x_negative * M_PIf + (1.0f - x_negative) * y_negative * 2.0f * M_PIf;
+  const float y_major_offset = M_PI_2f + y_negative * M_PIf;
+  const float offset = y_major * y_major_offset + (1.0f - y_major) * x_major_offset;
+  const float sign = 1.0f - 2.0f * static_cast<float>(is_y_major ^ is_x_negative ^ is_y_negative);
+  return offset + sign * angle;
+}
+
 float pseudoTan(const float theta)
 {
   // lightweight tangent
@@ -92,6 +120,57 @@ float pseudoTan(const float theta)
   }
   return std::copysign(M_PI_4f / (M_PI_2f - std::abs(normalized_theta)), normalized_theta);
 }
+
+void pseudoDirection(const float theta, float & x, float & y)
+{
+  // unit vector of the angle given by pseudoArcTan2, the inverse of pseudoArcTan2
+
+  // normalize the angle, range of [0, 2pi)
+  constexpr float M_2PIf = 2.0f * M_PIf;
+  float normalized_theta = std::fmod(theta, M_2PIf);
+  if (normalized_theta < 0.0f) normalized_theta += M_2PIf;
+
+  // the same 8 zones as pseudoArcTan2
+  const int zone = std::min(static_cast<int>(normalized_theta / M_PI_4f), 7);
+  const float ratio = normalized_theta / M_PI_4f - static_cast<float>(zone);
+  switch (zone) {
+    case 0:
+      x = 1.0f;
+      y = ratio;
+      break;
+    case 1:
+      x = 1.0f - ratio;
+      y = 1.0f;
+      break;
+    case 2:
+      x = -ratio;
+      y = 1.0f;
+      break;
+    case 3:
+      x = -1.0f;
+      y = 1.0f - ratio;
+      break;
+    case 4:
+      x = -1.0f;
+      y = -ratio;
+      break;
+    case 5:
+      x = ratio - 1.0f;
+      y = -1.0f;
+      break;
+    case 6:
+      x = ratio;
+      y = -1.0f;
+      break;
+    default:
+      x = 1.0f;
+      y = ratio - 1.0f;
+      break;
+  }
+  const float norm = std::hypot(x, y);
+  x /= norm;
+  y /= norm;
+}
 }  // namespace
 
 namespace autoware::ground_filter
@@ -105,12 +184,55 @@ struct Point
   float height;
 };
 
+// point added to the grid, before the points are sorted by the cell
+struct UnsortedPoint
+{
+  Point point;
+  int grid_idx;
+};
+
+// range of the points of a cell, which refers to the flat point array of the grid
+struct PointRange
+{
+  const Point * first = nullptr;
+  const Point * last = nullptr;
+
+  inline const Point * begin() const { return first; }
+  inline const Point * end() const { return last; }
+  inline size_t size() const { return static_cast<size_t>(last - first); }
+  inline bool empty() const { return first == last; }
+};
+
+// block of points in structure-of-arrays layout, the cell indices of a block are computed at once
+struct PointBlock
+{
+  static constexpr size_t capacity = 256;
+
+  // the points after size are not used, but they are computed in addPoints()
+  std::array<float, capacity> x{};
+  std::array<float, capacity> y{};
+  std::array<float, capacity> z{};
+  std::array<size_t, capacity> index{};
+  size_t size = 0;
+
+  inline bool isFull() const { return size == capacity; }
+  inline void clear() { size = 0; }
+  inline void addPoint(const float px, const float py, const float pz, const size_t point_idx)
+  {
+    x[size] = px;
+    y[size] = py;
+    z[size] = pz;
+    index[size] = point_idx;
+    ++size;
+  }
+};
+
 // Concentric Zone Model (CZM) based polar grid
 class Cell
 {
 public:
   // list of point indices
-  std::vector<Point> point_list_;  // point index and distance
+  PointRange point_list_;  // point index and distance
 
   // method to check if the cell is empty
   inline bool isEmpty() const { return point_list_.empty(); }
@@ -123,12 +245,15 @@ public:
   int prev_grid_idx_;
 
   int scan_grid_root_idx_;
+  int scan_ground_root_idx_;  // nearest cell having ground before this cell in the scan
 
   // geometric properties of the cell
   float center_radius_;
   float center_azimuth_;
   float radial_size_;
   float azimuth_size_;
+  float center_x_;  // position of the center in the pointcloud frame
+  float center_y_;
 
   // ground statistics of the points in the cell
   float avg_height_;
@@ -181,6 +306,7 @@ public:
     // initialize and resize cells
     cells_.clear();
     cells_.resize(radial_idx_offsets_.back() + azimuth_grids_per_radial_.back());
+    cell_point_offsets_.assign(cells_.size() + 1, 0);
 
     // set cell geometry
     setCellGeometry();
@@ -206,8 +332,137 @@ public:
     }
     const size_t grid_idx_idx = static_cast<size_t>(grid_idx);
 
-    // add the point to the cell
-    cells_[grid_idx_idx].point_list_.emplace_back(Point{point_idx, radius, z});
+    // add the point to the cell, the points are sorted by the cell in sortPoints()
+    unsorted_points_.emplace_back(UnsortedPoint{Point{point_idx, radius, z}, grid_idx});
+    ++cell_point_offsets_[grid_idx_idx + 1];
+  }
+
+  // method to add a block of points to the grid, the result is the same as addPoint() for each
+  // point. The radius, the azimuth and the radial index are computed for the whole block in loops
+  // without branches, which are vectorized. Then the cell indices are looked up from the tables of
+  // the radial grids, and the points are added in a separate pass.
+  void addPoints(const PointBlock & block)
+  {
+    const size_t point_num = block.size;
+
+    // 1. radius, azimuth and radial index
+    // the square root is taken in its own loop, as it is not vectorized with the errno of sqrtf
+    for (size_t i = 0; i < PointBlock::capacity; ++i) {
+      block_x_[i] = block.x[i] - origin_x_;
+      block_y_[i] = block.y[i] - origin_y_;
+      block_radius_[i] = block_x_[i] * block_x_[i] + block_y_[i] * block_y_[i];
+    }
+    for (size_t i = 0; i < point_num; ++i) {
+      block_radius_[i] = std::sqrt(block_radius_[i]);
+    }
+    const float origin_z = origin_z_;
+    const float radial_limit = grid_radial_limit_;
+    const float dist_size_inv = grid_dist_size_inv_;
+    const float switch_radius = grid_linearity_switch_radius_;
+    const float switch_angle = grid_linearity_switch_angle_;
+    const float size_rad_inv = grid_size_rad_inv_;
+    const int switch_num = grid_linearity_switch_num_;
+    const float * x_fixed = block_x_.data();
+    const float * y_fixed = block_y_.data();
+    const float * radii = block_radius_.data();
+    float * azimuths = block_azimuth_.data();
+    int * radial_indices = block_grid_idx_.data();
+    for (size_t i = 0; i < PointBlock::capacity; ++i) {
+      azimuths[i] = pseudoArcTan2Branchless(y_fixed[i], x_fixed[i]);
+
+      // the same index as getRadialIdx(), -1 if the radius is out of the range or NaN
+      const float radius = radii[i];
+      const float radius_in_range = std::min(radial_limit, radius);
+      const int linear_idx = static_cast<int>(radius_in_range * dist_size_inv);
+      const float angle = pseudoArcTan2Branchless(radius_in_range, origin_z);
+      const int angular_idx =
+        switch_num + static_cast<int>((angle - switch_angle) * size_rad_inv);
+      const int is_angular = radius_in_range >= switch_radius;
+      const int radial_idx = linear_idx + (angular_idx - linear_idx) * is_angular;
+      radial_indices[i] = radial_idx | -static_cast<int>(!(radius < radial_limit));
+    }
+
+    // 2. cell index from the radial index and the azimuth
+    for (size_t i = 0; i < point_num; ++i) {
+      const int radial_idx = block_grid_idx_[i];
+      if (radial_idx < 0) {
+        continue;
+      }
+      if (block_x_[i] == 0.0f) {
+        // the y axis is a special case of pseudoArcTan2, a point on the negative side is out of
+        // the grid as its azimuth is negative, and the azimuth of the origin is 0
+        if (block_y_[i] < 0.0f) {
+          block_grid_idx_[i] = -1;
+          continue;
+        }
+        if (block_y_[i] == 0.0f) {
+          block_azimuth_[i] = 0.0f;
+        }
+      }
+      // the azimuth is not negative, so the truncation is the floor in getAzimuthGridIdx()
+      int azimuth_idx =
+        static_cast<int>(block_azimuth_[i] / azimuth_interval_per_radial_[radial_idx]);
+      if (azimuth_idx == azimuth_grids_per_radial_[radial_idx]) {
+        // loop back to the first grid
+        azimuth_idx = 0;
+      }
+      block_grid_idx_[i] = radial_idx_offsets_[radial_idx] + azimuth_idx;
+    }
+
+    // 3. add the points, the points are sorted by the cell in sortPoints()
+    for (size_t i = 0; i < point_num; ++i) {
+      const int grid_idx = block_grid_idx_[i];
+      if (grid_idx < 0) {
+        continue;
+      }
+      unsorted_points_.emplace_back(
+        UnsortedPoint{Point{block.index[i], block_radius_[i], block.z[i]}, grid_idx});
+      ++cell_point_offsets_[static_cast<size_t>(grid_idx) + 1];
+    }
+  }
+
+  // method to get the index of the cell at the position, -1 means out of the grid
+  int getCellIdx(const float x, const float y) const
+  {
+    const float x_fixed = x - origin_x_;
+    const float y_fixed = y - origin_y_;
+    const float radius = std::sqrt(x_fixed * x_fixed + y_fixed * y_fixed);
+    return getGridIdx(radius, pseudoArcTan2(y_fixed, x_fixed));
+  }
+
+  void reservePoints(const size_t point_num)
+  {
+    unsorted_points_.reserve(point_num);
+    sorted_points_.reserve(point_num);
+  }
+
+  // the points added since resetCells(), in the order of addition
+  const std::vector<UnsortedPoint> & getUnsortedPoints() const { return unsorted_points_; }
+
+  // method to sort the added points by the cell (counting sort), and to set the point list of
+  // each cell. The order of the points in a cell is kept as added.
+  void sortPoints()
+  {
+    std::unique_ptr<ScopedTimeTrack> st_ptr;
+    if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
+
+    // the counts of the points are accumulated to the offsets
+    for (size_t i = 1; i < cell_point_offsets_.size(); ++i) {
+      cell_point_offsets_[i] += cell_point_offsets_[i - 1];
+    }
+
+    // scatter the points to their cells
+    cell_point_cursors_.assign(cell_point_offsets_.begin(), cell_point_offsets_.end() - 1);
+    sorted_points_.resize(unsorted_points_.size());
+    for (const auto & unsorted_point : unsorted_points_) {
+      sorted_points_[cell_point_cursors_[unsorted_point.grid_idx]++] = unsorted_point.point;
+    }
+
+    const Point * points = sorted_points_.data();
+    for (size_t idx = 0; idx < cells_.size(); ++idx) {
+      cells_[idx].point_list_ =
+        PointRange{points + cell_point_offsets_[idx], points + cell_point_offsets_[idx + 1]};
+    }
   }
 
   size_t getGridSize() const { return cells_.size(); }
@@ -227,14 +482,34 @@ public:
     std::unique_ptr<ScopedTimeTrack> st_ptr;
     if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
 
+    unsorted_points_.clear();
+    std::fill(cell_point_offsets_.begin(), cell_point_offsets_.end(), 0);
+
     for (auto & cell : cells_) {
-      cell.point_list_.clear();
+      cell.point_list_ = PointRange{};
+      cell.scan_ground_root_idx_ = -1;
       cell.is_processed_ = false;
       cell.is_ground_initialized_ = false;
       cell.has_ground_ = false;
     }
   }
 
+  // take the ground statistics of the cells from another grid of the same geometry, as the
+  // statistics of a cell are read in the classification before they are updated for the frame
+  void copyGroundStatistics(const Grid & other)
+  {
+    for (size_t idx = 0; idx < cells_.size(); ++idx) {
+      Cell & cell = cells_[idx];
+      const Cell & other_cell = other.cells_[idx];
+      cell.avg_height_ = other_cell.avg_height_;
+      cell.max_height_ = other_cell.max_height_;
+      cell.min_height_ = other_cell.min_height_;
+      cell.avg_radius_ = other_cell.avg_radius_;
+      cell.gradient_ = other_cell.gradient_;
+      cell.intercept_ = other_cell.intercept_;
+    }
+  }
+
   void setGridConnections()
   {
     std::unique_ptr<ScopedTimeTrack> st_ptr;
@@ -255,6 +530,34 @@ public:
     }
   }
 
+  // link the nearest ground cell before the cell in the scan, the cells before the cell have to
+  // be finalized, which is the case for the cells with smaller indices
+  void setScanGroundRoot(const int grid_idx)
+  {
+    Cell & cell = cells_[grid_idx];
+    if (cell.scan_grid_root_idx_ < 0) {
+      return;
+    }
+    const Cell & root_cell = cells_[cell.scan_grid_root_idx_];
+    cell.scan_ground_root_idx_ =
+      root_cell.has_ground_ ? cell.scan_grid_root_idx_ : root_cell.scan_ground_root_idx_;
+  }
+
+  // search for the ground cells close to the grid origin, from the cell of check_idx
+  // the links to the previous ground cell are followed, so only the ground cells are visited
+  void searchGroundCells(const int check_idx, const int search_cnt, std::vector<int> & idx) const
+  {
+    if (check_idx < 0) {
+      return;
+    }
+    const Cell & check_cell = cells_[check_idx];
+    int ground_idx = check_cell.has_ground_ ? check_idx : check_cell.scan_ground_root_idx_;
+    for (int cnt = 0; cnt < search_cnt && ground_idx >= 0; ++cnt) {
+      idx.push_back(ground_idx);
+      ground_idx = cells_[ground_idx].scan_ground_root_idx_;
+    }
+  }
+
 private:
   // given parameters
   float origin_x_;
@@ -284,6 +587,21 @@ private:
   // list of cells
   std::vector<Cell> cells_;
 
+  // points of all the cells in a flat array, the points of a cell are contiguous
+  // cell_point_offsets_[i + 1] counts the points of the i-th cell in addPoint(), and
+  // cell_point_offsets_[i] is the first point of the i-th cell after sortPoints()
+  std::vector<UnsortedPoint> unsorted_points_;
+  std::vector<size_t> cell_point_offsets_;
+  std::vector<size_t> cell_point_cursors_;
+  std::vector<Point> sorted_points_;
+
+  // buffers of addPoints()
+  std::array<float, PointBlock::capacity> block_x_;
+  std::array<float, PointBlock::capacity> block_y_;
+  std::array<float, PointBlock::capacity> block_radius_;
+  std::array<float, PointBlock::capacity> block_azimuth_;
+  std::array<int, PointBlock::capacity> block_grid_idx_;
+
   // debug information
   std::shared_ptr<autoware_utils_debug::TimeKeeper> time_keeper_;
 
@@ -470,6 +788,11 @@ private:
       // set center of the cell
       cell.center_radius_ = grid_radial_boundaries_[radial_idx] + cell.radial_size_ * 0.5f;
       cell.center_azimuth_ = (static_cast<float>(azimuth_idx) + 0.5f) * cell.azimuth_size_;
+      float direction_x = 0.0f;
+      float direction_y = 0.0f;
+      pseudoDirection(cell.center_azimuth_, direction_x, direction_y);
+      cell.center_x_ = origin_x_ + cell.center_radius_ * direction_x;
+      cell.center_y_ = origin_y_ + cell.center_radius_ * direction_y;
 
       // set next grid id, which is radially next
       int next_grid_idx = -1;
@@ -494,6 +817,7 @@ private:
       }
       cell.prev_grid_idx_ = prev_grid_idx;
       cell.scan_grid_root_idx_ = -1;
+      cell.scan_ground_root_idx_ = -1;
     }
   }
 };
@@ -23,6 +23,8 @@
 
 #include <sensor_msgs/msg/point_cloud2.hpp>
 
+#include <Eigen/Geometry>
+
 #include <pcl/PointIndices.h>
 
 #include <algorithm>
@@ -148,6 +150,19 @@ struct GroundFilterParameter
   float virtual_lidar_x;
   float virtual_lidar_y;
   float virtual_lidar_z;
+
+  // temporal ground prior
+  bool use_temporal_prior = false;
+  float temporal_prior_residual_threshold = 0.1f;
+};
+
+// ground of a cell, which is carried over to the next frame
+struct GroundPrior
+{
+  float height = 0.0f;    // ground height at the radius
+  float radius = 0.0f;    // distance from the grid origin
+  float gradient = 0.0f;  // radial slope of the ground
+  bool is_valid = false;
 };
 
 class GroundFilter
@@ -161,10 +176,7 @@ public:
     param_.radial_dividers_num = std::ceil(2.0 * M_PI / param_.radial_divider_angle_rad);
 
     // initialize grid pointer
-    grid_ptr_ = std::make_unique<Grid>(
-      param_.virtual_lidar_x, param_.virtual_lidar_y, param_.virtual_lidar_z);
-    grid_ptr_->initialize(
-      param_.grid_size_m, param_.radial_divider_angle_rad, param_.grid_mode_switch_radius);
+    grid_ptr_ = createGrid();
   }
   ~GroundFilter() = default;
 
@@ -182,8 +194,41 @@ public:
       data_accessor_.setField(in_cloud);
     }
   }
+  // set the ego motion from the previous frame, used when use_temporal_prior is enabled
+  // previous_from_current transforms a point in the current pointcloud frame to the previous one
+  void setEgoMotion(const Eigen::Affine3f & previous_from_current)
+  {
+    previous_from_current_ = previous_from_current;
+    has_ego_motion_ = true;
+  }
+
+  // discard the ground of the previous frame, e.g. when the ego motion is not available
+  void resetTemporalPrior()
+  {
+    prev_ground_.clear();
+    has_ego_motion_ = false;
+  }
+
   void process(const PointCloud2ConstPtr & in_cloud, pcl::PointIndices & out_no_ground_indices);
 
+  // process() split into two stages for the pipelined execution, so that the points of the next
+  // frame are binned into a grid of its own while the current frame is classified
+  std::unique_ptr<Grid> createGrid() const
+  {
+    auto grid_ptr = std::make_unique<Grid>(
+      param_.virtual_lidar_x, param_.virtual_lidar_y, param_.virtual_lidar_z);
+    grid_ptr->initialize(
+      param_.grid_size_m, param_.radial_divider_angle_rad, param_.grid_mode_switch_radius);
+    return grid_ptr;
+  }
+  // assign the points to the cells of the grid, it is safe to call this on a grid which is not
+  // classified while another frame is classified
+  void binPoints(const PointCloud2ConstPtr & in_cloud, Grid & grid) const;
+  // classify the binned grid, the grid is exchanged with the one of the previous frame
+  void classifyBinned(
+    const PointCloud2ConstPtr & in_cloud, std::unique_ptr<Grid> & grid_ptr,
+    pcl::PointIndices & out_no_ground_indices);
+
 private:
   // parameters
   GroundFilterParameter param_;
@@ -195,16 +240,24 @@ private:
   // grid data
   std::unique_ptr<Grid> grid_ptr_;
 
+  // temporal ground prior
+  std::vector<GroundPrior> prev_ground_;   // ground of the previous frame, indexed by cell
+  std::vector<GroundPrior> ground_prior_;  // previous ground moved to the current cells
+  Eigen::Affine3f previous_from_current_ = Eigen::Affine3f::Identity();
+  bool has_ego_motion_ = false;
+
   // debug information
   std::shared_ptr<autoware_utils_debug::TimeKeeper> time_keeper_;
 
-  bool recursiveSearch(const int check_idx, const int search_cnt, std::vector<int> & idx) const;
-  bool recursiveSearch(
-    const int check_idx, const int search_cnt, std::vector<int> & idx, size_t count) const;
   void fitLineFromGndGrid(const std::vector<int> & idx, float & a, float & b) const;
 
   void convert();
   void preprocess();
+  void projectGroundPrior();
+  void storeGroundPrior();
+  bool initializeGroundFromPrior(
+    Cell & cell, PointsCentroid & ground_bin, pcl::PointIndices & out_no_ground_indices) const;
+  bool getLineFromPrior(const int cell_idx, const int ground_idx, float & a, float & b) const;
   void initializeGround(pcl::PointIndices & out_no_ground_indices);
 
   void SegmentContinuousCell(
@@ -214,6 +267,7 @@ private:
   void SegmentBreakCell(
     const Cell & cell, PointsCentroid & ground_bin, pcl::PointIndices & out_no_ground_indices);
   void classify(pcl::PointIndices & out_no_ground_indices);
+  void segment(pcl::PointIndices & out_no_ground_indices);
 };
 
 }  // namespace autoware::ground_filter
@@ -15,9 +15,11 @@
 #ifndef AUTOWARE__GROUND_FILTER__NODE_HPP_
 #define AUTOWARE__GROUND_FILTER__NODE_HPP_
 
+#include "autoware/ground_filter/bounded_queue.hpp"
 #include "autoware/ground_filter/data.hpp"
 #include "autoware/ground_filter/ground_filter.hpp"
 
+#include <autoware/point_types/layout.hpp>
 #include <autoware_utils_debug/time_keeper.hpp>
 #include <autoware_vehicle_info_utils/vehicle_info.hpp>
 
@@ -60,8 +62,13 @@
 #include <tf2_ros/transform_listener.h>
 
 #include <algorithm>
+#include <chrono>
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 class GroundFilterTest;
@@ -189,7 +196,35 @@ private:
   void faster_filter(
     const sensor_msgs::msg::PointCloud2::ConstSharedPtr & input,
     [[maybe_unused]] const pcl::IndicesPtr & indices, sensor_msgs::msg::PointCloud2 & output,
-    [[maybe_unused]] const TransformInfo & transform_info);
+    [[maybe_unused]] const TransformInfo & transform_info,
+    const TransformInfo & output_transform_info);
+
+  /**
+   * A frame in the pipelined execution. The points of frame N+1 are binned, frame N is classified
+   * and the output of frame N-1 is extracted on separate threads, and the frames are handed off
+   * between the threads in this structure.
+   */
+  struct PipelineFrame
+  {
+    sensor_msgs::msg::PointCloud2::ConstSharedPtr cloud;
+    TransformInfo output_transform_info;
+    std::string output_frame_id;
+
+    // pose of the pointcloud in the fixed frame, for the ego motion of the temporal ground prior
+    TransformInfo fixed_from_cloud;
+    bool has_fixed_from_cloud{false};
+
+    // grid whose points are assigned, exchanged with the grid of the previous frame when it is
+    // classified
+    std::unique_ptr<Grid> grid_ptr;
+    pcl::PointIndices no_ground_indices;
+
+    // processing time of each stage
+    std::chrono::steady_clock::time_point received_time;
+    double binning_time_ms{0.0};
+    double classification_time_ms{0.0};
+  };
+  using PipelineFramePtr = std::unique_ptr<PipelineFrame>;
 
   // data accessor
   PclDataAccessor data_accessor_;
@@ -229,9 +264,32 @@ private:
   uint16_t ground_grid_buffer_size_;
   float virtual_lidar_z_;
 
+  // temporal ground prior parameters
+  bool use_temporal_prior_;
+  float temporal_prior_residual_threshold_;
+  std::string temporal_prior_fixed_frame_;
+
+  // pose of the previous pointcloud in the fixed frame, for the ego motion between the frames
+  Eigen::Matrix4f prev_fixed_from_cloud_{Eigen::Matrix4f::Identity()};
+  std::string prev_cloud_frame_;
+  bool has_prev_fixed_from_cloud_{false};
+
+  // pipelined execution
+  bool use_pipelined_execution_;
+  // the frames and the grids handed off between the stages, each stage holds at most one frame so
+  // that the latency is not increased by waiting frames
+  BoundedQueue<PipelineFramePtr> binning_queue_{1};
+  BoundedQueue<PipelineFramePtr> classification_queue_{1};
+  BoundedQueue<PipelineFramePtr> extraction_queue_{1};
+  // the grids which are not classified, one is binned while the other waits for the classification
+  BoundedQueue<std::unique_ptr<Grid>> grid_pool_{2};
+  std::vector<std::thread> pipeline_threads_;
+  std::optional<std::chrono::steady_clock::time_point> last_output_time_;
+
   // pointcloud parameters
   std::string tf_input_frame_;
   std::string tf_output_frame_;
+  bool has_static_tf_only_;
   std::size_t max_queue_size_;
   bool use_indices_;
   bool latched_indices_;
@@ -286,11 +344,37 @@ private:
    * and the other removed as indicated in the indices
    * @param in_cloud_ptr Input PointCloud to which the extraction will be performed
    * @param in_indices Indices of the points to be both removed and kept
+   * @param transform_info Transform applied to the kept points while they are copied
    * @param out_object_cloud Resulting PointCloud with the indices kept
    */
   void extractObjectPoints(
     const sensor_msgs::msg::PointCloud2::ConstSharedPtr & in_cloud_ptr,
-    const pcl::PointIndices & in_indices, sensor_msgs::msg::PointCloud2 & out_object_cloud) const;
+    const pcl::PointIndices & in_indices, const TransformInfo & transform_info,
+    sensor_msgs::msg::PointCloud2 & out_object_cloud) const;
+
+  /*!
+   * Fill the output PointCloud with the non-ground points
+   * @param in_cloud_ptr Input PointCloud
+   * @param in_no_ground_indices Indices of the non-ground points in the input PointCloud
+   * @param transform_info Transform applied to the non-ground points
+   * @param out_object_cloud Resulting PointCloud, its header is the one of the input
+   */
+  void createOutput(
+    const sensor_msgs::msg::PointCloud2::ConstSharedPtr & in_cloud_ptr,
+    const pcl::PointIndices & in_no_ground_indices, const TransformInfo & transform_info,
+    sensor_msgs::msg::PointCloud2 & out_object_cloud) const;
+
+  /*!
+   * Pipelined execution, each stage runs on its own thread until the pipeline is stopped
+   */
+  void start_pipeline();
+  void stop_pipeline();
+  void enqueue_frame(
+    const sensor_msgs::msg::PointCloud2::ConstSharedPtr & cloud,
+    const TransformInfo & output_transform_info);
+  void run_binning_stage();
+  void run_classification_stage();
+  void run_extraction_stage();
 
   /** \brief Parameter service callback result : needed to be hold */
   rclcpp::Node::OnSetParametersCallbackHandle::SharedPtr set_param_res_;
@@ -318,7 +402,11 @@ private:
   bool calculate_transform_matrix(
     const std::string & target_frame, const sensor_msgs::msg::PointCloud2 & from,
     TransformInfo & transform_info /*output*/);
-  bool convert_output_costly(std::unique_ptr<sensor_msgs::msg::PointCloud2> & output);
+  bool calculate_output_transform_matrix(
+    const sensor_msgs::msg::PointCloud2 & from, TransformInfo & transform_info /*output*/);
+  void update_ego_motion(
+    const std::string & cloud_frame, const bool has_fixed_from_cloud,
+    const TransformInfo & fixed_from_cloud);
   void faster_input_indices_callback(
     const sensor_msgs::msg::PointCloud2::ConstSharedPtr cloud,
     const pcl_msgs::msg::PointIndices::ConstSharedPtr indices);
@@ -346,6 +434,13 @@ protected:
 
   std::unique_ptr<autoware_utils_tf::TransformListener> transform_listener_{nullptr};
 
+  /** \brief The output transforms, keyed by the pair of the target and the source frames. Only
+   * used if has_static_tf_only is true. */
+  std::map<std::pair<std::string, std::string>, TransformInfo> output_transform_cache_;
+
+  /** \brief The layouts of the input pointclouds, checked once per distinct field list. */
+  autoware::point_types::PointCloudLayoutCache layout_cache_;
+
   std::unique_ptr<autoware_utils_debug::PublishedTimePublisher> published_time_publisher_;
 
   // To validate if the pointcloud is valid
@@ -381,6 +476,7 @@ protected:
 public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
   explicit GroundFilterComponent(const rclcpp::NodeOptions & options);
+  ~GroundFilterComponent() override;
 
   // for test
   friend GroundFilterTest;
@@ -30,16 +30,35 @@ void GroundFilter::convert()
   std::unique_ptr<ScopedTimeTrack> st_ptr;
   if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
 
-  const size_t in_cloud_data_size = in_cloud_->data.size();
-  const size_t in_cloud_point_step = in_cloud_->point_step;
+  binPoints(in_cloud_, *grid_ptr_);
+}
+
+void GroundFilter::binPoints(const PointCloud2ConstPtr & in_cloud, Grid & grid) const
+{
+  // reset grid cells
+  grid.resetCells();
+
+  const size_t in_cloud_data_size = in_cloud->data.size();
+  const size_t in_cloud_point_step = in_cloud->point_step;
+  grid.reservePoints(in_cloud->width * in_cloud->height);
 
+  // the points are added to the grid in blocks
+  PointBlock block;
   for (size_t data_index = 0; data_index + in_cloud_point_step <= in_cloud_data_size;
        data_index += in_cloud_point_step) {
     // Get Point
     pcl::PointXYZ input_point;
-    data_accessor_.getPoint(in_cloud_, data_index, input_point);
-    grid_ptr_->addPoint(input_point.x, input_point.y, input_point.z, data_index);
+    data_accessor_.getPoint(in_cloud, data_index, input_point);
+    block.addPoint(input_point.x, input_point.y, input_point.z, data_index);
+    if (block.isFull()) {
+      grid.addPoints(block);
+      block.clear();
+    }
   }
+  grid.addPoints(block);
+
+  // gather the points of each cell
+  grid.sortPoints();
 }
 
 // preprocess the grid data, set the grid connections
@@ -52,39 +71,6 @@ void GroundFilter::preprocess()
   grid_ptr_->setGridConnections();
 }
 
-// recursive search for the ground grid cell close to the grid origin
-bool GroundFilter::recursiveSearch(
-  const int check_idx, const int search_cnt, std::vector<int> & idx) const
-{
-  // set the maximum search count
-  constexpr size_t count_limit = 1023;
-  return recursiveSearch(check_idx, search_cnt, idx, count_limit);
-}
-
-bool GroundFilter::recursiveSearch(
-  const int check_idx, const int search_cnt, std::vector<int> & idx, size_t count) const
-{
-  if (count == 0) {
-    return false;
-  }
-  count -= 1;
-  // recursive search
-  if (check_idx < 0) {
-    return false;
-  }
-  if (search_cnt == 0) {
-    return true;
-  }
-  const auto & check_cell = grid_ptr_->getCell(check_idx);
-  if (check_cell.has_ground_) {
-    // the cell has ground, add the index to the list, and search previous cell
-    idx.push_back(check_idx);
-    return recursiveSearch(check_cell.scan_grid_root_idx_, search_cnt - 1, idx, count);
-  }
-  // if the cell does not have ground, search previous cell
-  return recursiveSearch(check_cell.scan_grid_root_idx_, search_cnt, idx, count);
-}
-
 // fit the line from the ground grid cells
 void GroundFilter::fitLineFromGndGrid(const std::vector<int> & idx, float & a, float & b) const
 {
@@ -126,6 +112,144 @@ void GroundFilter::fitLineFromGndGrid(const std::vector<int> & idx, float & a, f
   }
 }
 
+// move the ground of the previous frame to the cells of the current frame by the ego motion
+void GroundFilter::projectGroundPrior()
+{
+  std::unique_ptr<ScopedTimeTrack> st_ptr;
+  if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
+
+  const auto grid_size = grid_ptr_->getGridSize();
+  ground_prior_.assign(grid_size, GroundPrior{});
+  if (!has_ego_motion_ || prev_ground_.size() != grid_size) {
+    return;
+  }
+
+  // the vertical axis of the previous frame in the current frame
+  const Eigen::Vector3f current_up = previous_from_current_.linear().transpose().col(2);
+  for (size_t idx = 0; idx < grid_size; idx++) {
+    const auto & cell = grid_ptr_->getCell(idx);
+    if (cell.isEmpty()) continue;
+    // find the cell of the previous frame at the center of this cell
+    const Eigen::Vector3f center =
+      previous_from_current_ * Eigen::Vector3f(cell.center_x_, cell.center_y_, 0.0f);
+    const int prev_idx = grid_ptr_->getCellIdx(center.x(), center.y());
+    if (prev_idx < 0) continue;
+    const auto & prev_ground = prev_ground_[prev_idx];
+    if (!prev_ground.is_valid) continue;
+
+    // the ground point below the center in the previous frame, moved to the current frame
+    const float prev_dx = center.x() - param_.virtual_lidar_x;
+    const float prev_dy = center.y() - param_.virtual_lidar_y;
+    const float prev_radius = std::sqrt(prev_dx * prev_dx + prev_dy * prev_dy);
+    const float prev_height =
+      prev_ground.height + prev_ground.gradient * (prev_radius - prev_ground.radius);
+    // the center is moved back to the center of this cell, only the height is transformed
+    const Eigen::Vector3f ground_point = Eigen::Vector3f(cell.center_x_, cell.center_y_, 0.0f) +
+                                         (prev_height - center.z()) * current_up;
+
+    const float dx = ground_point.x() - param_.virtual_lidar_x;
+    const float dy = ground_point.y() - param_.virtual_lidar_y;
+
+    auto & prior = ground_prior_[idx];
+    prior.height = ground_point.z();
+    prior.radius = std::sqrt(dx * dx + dy * dy);
+    prior.gradient = prev_ground.gradient;
+    prior.is_valid = true;
+  }
+}
+
+// keep the ground of the cells for the next frame
+void GroundFilter::storeGroundPrior()
+{
+  std::unique_ptr<ScopedTimeTrack> st_ptr;
+  if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
+
+  const auto grid_size = grid_ptr_->getGridSize();
+  prev_ground_.resize(grid_size);
+  for (size_t idx = 0; idx < grid_size; idx++) {
+    const auto & cell = grid_ptr_->getCell(idx);
+    auto & ground = prev_ground_[idx];
+    ground.is_valid = cell.has_ground_;
+    if (!ground.is_valid) continue;
+    ground.height = cell.avg_height_;
+    ground.radius = cell.avg_radius_;
+    ground.gradient = cell.gradient_;
+  }
+
+  // the ego motion is given for every frame
+  has_ego_motion_ = false;
+}
+
+// initialize the ground of the cell from the ground prior
+// returns false if there is no prior, or if the ground points do not fit the prior
+bool GroundFilter::initializeGroundFromPrior(
+  Cell & cell, PointsCentroid & ground_bin, pcl::PointIndices & out_no_ground_indices) const
+{
+  const auto & prior = ground_prior_[cell.grid_idx_];
+  if (!prior.is_valid) {
+    return false;
+  }
+
+  ground_bin.initialize();
+  const size_t no_ground_num = out_no_ground_indices.indices.size();
+  for (const auto & pt : cell.point_list_) {
+    const float prior_height = prior.height + prior.gradient * (pt.distance - prior.radius);
+    const float delta_height = pt.height - prior_height;
+    if (delta_height > param_.non_ground_height_threshold) {
+      // this point is obstacle
+      out_no_ground_indices.indices.push_back(pt.index);
+    } else if (abs(delta_height) < param_.non_ground_height_threshold) {
+      // this point is ground
+      ground_bin.addPoint(pt.distance, pt.height, pt.index);
+    }
+    // else, this point is not classified, not ground nor obstacle
+  }
+
+  // residual check, the ground of this frame has to be close to the prior
+  bool is_prior_fit = false;
+  if (ground_bin.getGroundPointNum() > 0) {
+    ground_bin.processAverage();
+    const float prior_height =
+      prior.height + prior.gradient * (ground_bin.getAverageRadius() - prior.radius);
+    is_prior_fit = abs(ground_bin.getAverageHeight() - prior_height) <=
+                   param_.temporal_prior_residual_threshold;
+  }
+  if (!is_prior_fit) {
+    // revert the classification, the cell is initialized without the prior
+    out_no_ground_indices.indices.resize(no_ground_num);
+    return false;
+  }
+
+  cell.is_processed_ = true;
+  cell.has_ground_ = true;
+  cell.is_ground_initialized_ = true;
+  cell.avg_height_ = ground_bin.getAverageHeight();
+  cell.avg_radius_ = ground_bin.getAverageRadius();
+  cell.max_height_ = ground_bin.getMaxHeight();
+  cell.min_height_ = ground_bin.getMinHeight();
+  cell.gradient_ = prior.gradient;
+  cell.intercept_ = cell.avg_height_ - cell.gradient_ * cell.avg_radius_;
+  return true;
+}
+
+// get the ground line of the cell from the ground prior
+// returns false if there is no prior, or if the nearest ground cell does not fit the prior
+bool GroundFilter::getLineFromPrior(
+  const int cell_idx, const int ground_idx, float & a, float & b) const
+{
+  const auto & prior = ground_prior_[cell_idx];
+  if (!prior.is_valid) {
+    return false;
+  }
+  a = prior.gradient;
+  b = prior.height - a * prior.radius;
+
+  // residual check at the nearest ground cell
+  const auto & ground_cell = grid_ptr_->getCell(ground_idx);
+  const float residual = ground_cell.avg_height_ - (a * ground_cell.avg_radius_ + b);
+  return abs(residual) <= param_.temporal_prior_residual_threshold;
+}
+
 // process the grid data to initialize the ground cells prior to the ground segmentation
 void GroundFilter::initializeGround(pcl::PointIndices & out_no_ground_indices)
 {
@@ -133,6 +257,8 @@ void GroundFilter::initializeGround(pcl::PointIndices & out_no_ground_indices)
   if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
 
   const auto grid_size = grid_ptr_->getGridSize();
+  // the buffer is reused over the cells
+  PointsCentroid ground_bin;
   // loop over grid cells
   for (size_t idx = 0; idx < grid_size; idx++) {
     auto & cell = grid_ptr_->getCell(idx);
@@ -149,9 +275,14 @@ void GroundFilter::initializeGround(pcl::PointIndices & out_no_ground_indices)
       }
     }
 
-    // initialize ground in this cell
+    // initialize ground in this cell, from the ground of the previous frame if it fits
+    if (
+      param_.use_temporal_prior &&
+      initializeGroundFromPrior(cell, ground_bin, out_no_ground_indices)) {
+      continue;
+    }
     bool is_ground_found = false;
-    PointsCentroid ground_bin;
+    ground_bin.initialize();
 
     for (const auto & pt : cell.point_list_) {
       const size_t & pt_idx = pt.index;
@@ -359,12 +490,21 @@ void GroundFilter::classify(pcl::PointIndices & out_no_ground_indices)
   std::unique_ptr<ScopedTimeTrack> st_ptr;
   if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
 
+  // the buffers are reused over the cells
+  std::vector<int> grid_idcs;
+  PointsCentroid ground_bin;
+
   // loop over grid cells
   const auto grid_size = grid_ptr_->getGridSize();
   for (size_t idx = 0; idx < grid_size; idx++) {
     auto & cell = grid_ptr_->getCell(idx);
     // if the cell is empty, skip
     if (cell.isEmpty()) continue;
+
+    // link the nearest ground cell before this cell
+    // the cells before this cell are already finalized since they have smaller indices
+    grid_ptr_->setScanGroundRoot(idx);
+
     if (cell.is_processed_) continue;
 
     // set a cell pointer for the previous cell
@@ -374,11 +514,11 @@ void GroundFilter::classify(pcl::PointIndices & out_no_ground_indices)
     if (!(prev_cell.is_ground_initialized_)) continue;
 
     // get current cell gradient and intercept
-    std::vector<int> grid_idcs;
+    grid_idcs.clear();
     {
       const int search_count = param_.ground_grid_buffer_size;
       const int check_cell_idx = cell.scan_grid_root_idx_;
-      recursiveSearch(check_cell_idx, search_count, grid_idcs);
+      grid_ptr_->searchGroundCells(check_cell_idx, search_count, grid_idcs);
     }
 
     // segment the ground and non-ground points
@@ -401,11 +541,14 @@ void GroundFilter::classify(pcl::PointIndices & out_no_ground_indices)
     }
 
     {
-      PointsCentroid ground_bin;
+      ground_bin.initialize();
       if (mode == SegmentationMode::CONTINUOUS) {
-        // calculate the gradient and intercept by least square method
+        // take the gradient and intercept from the ground of the previous frame if it fits,
+        // otherwise calculate them by least square method
         float a, b;
-        fitLineFromGndGrid(grid_idcs, a, b);
+        if (!(param_.use_temporal_prior && getLineFromPrior(idx, grid_idcs.front(), a, b))) {
+          fitLineFromGndGrid(grid_idcs, a, b);
+        }
         cell.gradient_ = a;
         cell.intercept_ = b;
 
@@ -449,6 +592,17 @@ void GroundFilter::classify(pcl::PointIndices & out_no_ground_indices)
         cell.max_height_ = ground_bin.getMaxHeight();
         cell.min_height_ = ground_bin.getMinHeight();
         cell.has_ground_ = true;
+        if (param_.use_temporal_prior && mode != SegmentationMode::CONTINUOUS) {
+          // the line of the ground is kept for the next frame, it is not fitted in this mode
+          const Cell & ground_cell = grid_ptr_->getCell(grid_idcs.front());
+          const float delta_radius = cell.avg_radius_ - ground_cell.avg_radius_;
+          const float gradient = delta_radius > 0.0f
+                                   ? (cell.avg_height_ - ground_cell.avg_height_) / delta_radius
+                                   : 0.0f;
+          cell.gradient_ = std::clamp(
+            gradient, -param_.global_slope_max_ratio, param_.global_slope_max_ratio);
+          cell.intercept_ = cell.avg_height_ - cell.gradient_ * cell.avg_radius_;
+        }
       } else {
         // copy previous cell
         cell.avg_radius_ = prev_cell.avg_radius_;
@@ -476,20 +630,52 @@ void GroundFilter::process(
   // clear the output indices
   out_no_ground_indices.indices.clear();
 
-  // reset grid cells
-  grid_ptr_->resetCells();
-
   // 1. assign points to grid cells
   convert();
 
+  segment(out_no_ground_indices);
+}
+
+// classify the grid binned by binPoints() in the pipelined execution
+void GroundFilter::classifyBinned(
+  const PointCloud2ConstPtr & in_cloud, std::unique_ptr<Grid> & grid_ptr,
+  pcl::PointIndices & out_no_ground_indices)
+{
+  std::unique_ptr<ScopedTimeTrack> st_ptr;
+  if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
+
+  // set input cloud
+  in_cloud_ = in_cloud;
+
+  // clear the output indices
+  out_no_ground_indices.indices.clear();
+
+  // 1. take the grid whose points are assigned, and give back the grid of the previous frame
+  grid_ptr->copyGroundStatistics(*grid_ptr_);
+  grid_ptr_.swap(grid_ptr);
+
+  segment(out_no_ground_indices);
+}
+
+// segment the ground points of the grid whose points are assigned
+void GroundFilter::segment(pcl::PointIndices & out_no_ground_indices)
+{
   // 2. cell preprocess
   preprocess();
 
-  // 3. initialize ground
+  // 3. initialize ground, with the ground of the previous frame if enabled
+  if (param_.use_temporal_prior) {
+    projectGroundPrior();
+  }
   initializeGround(out_no_ground_indices);
 
   // 4. classify point cloud
   classify(out_no_ground_indices);
+
+  // 5. keep the ground for the next frame
+  if (param_.use_temporal_prior) {
+    storeGroundPrior();
+  }
 }
 
 }  // namespace autoware::ground_filter
@@ -15,16 +15,16 @@
 #include "autoware/ground_filter/node.hpp"
 
 #include "autoware/ground_filter/ground_filter.hpp"
-#include "autoware/ground_filter/sanity_check.hpp"
 
 #include <autoware_utils_geometry/geometry.hpp>
 #include <autoware_utils_math/normalization.hpp>
 #include <autoware_utils_math/unit_conversion.hpp>
 #include <autoware_utils_tf/transform_listener.hpp>
 #include <autoware_vehicle_info_utils/vehicle_info_utils.hpp>
-#include <pcl_ros/transforms.hpp>
 #include <rclcpp/rclcpp.hpp>
 
+#include <chrono>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <utility>
@@ -111,6 +111,23 @@ GroundFilterComponent::GroundFilterComponent(const rclcpp::NodeOptions & options
     ground_grid_buffer_size_ = rclcpp::Node::declare_parameter<int>("ground_grid_buffer_size");
     virtual_lidar_z_ = vehicle_info_.vehicle_height_m;
 
+    // temporal ground prior parameters
+    use_temporal_prior_ = rclcpp::Node::declare_parameter<bool>("use_temporal_prior");
+    temporal_prior_residual_threshold_ = static_cast<float>(
+      rclcpp::Node::declare_parameter<double>("temporal_prior_residual_threshold"));
+    temporal_prior_fixed_frame_ =
+      rclcpp::Node::declare_parameter<std::string>("temporal_prior_fixed_frame");
+
+    // pipelined execution, which is implemented only for elevation_grid_mode
+    use_pipelined_execution_ = rclcpp::Node::declare_parameter<bool>("use_pipelined_execution");
+    if (use_pipelined_execution_ && !elevation_grid_mode_) {
+      RCLCPP_WARN(
+        this->get_logger(),
+        "use_pipelined_execution is applied only for elevation_grid_mode, the frames are processed "
+        "sequentially.");
+      use_pipelined_execution_ = false;
+    }
+
     // initialize grid filter
     {
       GroundFilterParameter param;
@@ -130,6 +147,9 @@ GroundFilterComponent::GroundFilterComponent(const rclcpp::NodeOptions & options
       param.virtual_lidar_y = 0.0f;
       param.virtual_lidar_z = virtual_lidar_z_;
 
+      param.use_temporal_prior = use_temporal_prior_;
+      param.temporal_prior_residual_threshold = temporal_prior_residual_threshold_;
+
       ground_filter_ptr_ = std::make_unique<GroundFilter>(param);
     }
   }
@@ -148,6 +168,13 @@ GroundFilterComponent::GroundFilterComponent(const rclcpp::NodeOptions & options
     stop_watch_ptr_->tic("processing_time");
 
     bool use_time_keeper = rclcpp::Node::declare_parameter<bool>("publish_processing_time_detail");
+    if (use_time_keeper && use_pipelined_execution_) {
+      // the time keeper is not thread safe, the processing time of each stage is published instead
+      RCLCPP_WARN(
+        this->get_logger(),
+        "publish_processing_time_detail is not supported with use_pipelined_execution.");
+      use_time_keeper = false;
+    }
     if (use_time_keeper) {
       detailed_processing_time_publisher_ =
         this->create_publisher<autoware_utils_debug::ProcessingTimeDetail>(
@@ -163,6 +190,7 @@ GroundFilterComponent::GroundFilterComponent(const rclcpp::NodeOptions & options
   // pointcloud parameters
   tf_input_frame_ = static_cast<std::string>(declare_parameter("input_frame", ""));
   tf_output_frame_ = static_cast<std::string>(declare_parameter("output_frame", ""));
+  has_static_tf_only_ = static_cast<bool>(declare_parameter("has_static_tf_only", false));
   max_queue_size_ = static_cast<std::size_t>(declare_parameter("max_queue_size", 5));
   use_indices_ = static_cast<bool>(declare_parameter("use_indices", false));
   latched_indices_ = static_cast<bool>(declare_parameter("latched_indices", false));
@@ -175,6 +203,7 @@ GroundFilterComponent::GroundFilterComponent(const rclcpp::NodeOptions & options
       << " - approximate_sync : " << (approximate_sync_ ? "true" : "false") << std::endl
       << " - use_indices      : " << (use_indices_ ? "true" : "false") << std::endl
       << " - latched_indices  : " << (latched_indices_ ? "true" : "false") << std::endl
+      << " - has_static_tf_only : " << (has_static_tf_only_ ? "true" : "false") << std::endl
       << " - max_queue_size   : " << max_queue_size_);
 
   // Set publisher
@@ -191,9 +220,18 @@ GroundFilterComponent::GroundFilterComponent(const rclcpp::NodeOptions & options
   setupTF();
 
   published_time_publisher_ = std::make_unique<autoware_utils_debug::PublishedTimePublisher>(this);
+
+  if (use_pipelined_execution_) {
+    start_pipeline();
+  }
   RCLCPP_DEBUG(this->get_logger(), "[Filter Constructor] successfully created.");
 }
 
+GroundFilterComponent::~GroundFilterComponent()
+{
+  stop_pipeline();
+}
+
 void GroundFilterComponent::setupTF()
 {
   transform_listener_ = std::make_unique<autoware_utils_tf::TransformListener>(this);
@@ -259,78 +297,216 @@ bool GroundFilterComponent::calculate_transform_matrix(
   return true;
 }
 
-bool GroundFilterComponent::convert_output_costly(
-  std::unique_ptr<sensor_msgs::msg::PointCloud2> & output)
+bool GroundFilterComponent::calculate_output_transform_matrix(
+  const sensor_msgs::msg::PointCloud2 & from, TransformInfo & transform_info /*output*/)
 {
-  // In terms of performance, we should avoid using pcl_ros library function,
-  // but this code path isn't reached in the main use case of Autoware, so it's left as is for now.
-  if (!tf_output_frame_.empty() && output->header.frame_id != tf_output_frame_) {
-    RCLCPP_DEBUG(
-      this->get_logger(), "[convert_output_costly] Transforming output dataset from %s to %s.",
-      output->header.frame_id.c_str(), tf_output_frame_.c_str());
+  // If the transforms are declared static, the transform to the output frame is looked up only
+  // once per frame pair. Otherwise it is looked up at the stamp of every pointcloud. If the output
+  // frame is empty, the output is in the input frame.
+  const auto frame_pair = std::make_pair(tf_output_frame_, from.header.frame_id);
+  if (has_static_tf_only_) {
+    const auto cached_transform = output_transform_cache_.find(frame_pair);
+    if (cached_transform != output_transform_cache_.end()) {
+      transform_info = cached_transform->second;
+      return true;
+    }
+  }
 
-    // Convert the cloud into the different frame
-    auto cloud_transformed = std::make_unique<sensor_msgs::msg::PointCloud2>();
+  if (!calculate_transform_matrix(tf_output_frame_, from, transform_info)) {
+    RCLCPP_ERROR(
+      this->get_logger(),
+      "[calculate_output_transform_matrix] Error converting output dataset from %s to %s.",
+      from.header.frame_id.c_str(), tf_output_frame_.c_str());
+    return false;
+  }
+  if (has_static_tf_only_) {
+    output_transform_cache_.emplace(frame_pair, transform_info);
+  }
+  return true;
+}
 
-    auto tf_ptr = transform_listener_->get_transform(
-      tf_output_frame_, output->header.frame_id, output->header.stamp,
-      rclcpp::Duration::from_seconds(1.0));
-    if (!tf_ptr) {
-      RCLCPP_ERROR(
-        this->get_logger(),
-        "[convert_output_costly] Error converting output dataset from %s to %s.",
-        output->header.frame_id.c_str(), tf_output_frame_.c_str());
-      return false;
-    }
+void GroundFilterComponent::update_ego_motion(
+  const std::string & cloud_frame, const bool has_fixed_from_cloud,
+  const TransformInfo & fixed_from_cloud)
+{
+  // The ego motion from the previous frame is given by the poses of the pointclouds in the fixed
+  // frame. If the pose is not available, the ground of the previous frame is discarded.
+  if (!has_fixed_from_cloud) {
+    RCLCPP_WARN_THROTTLE(
+      this->get_logger(), *this->get_clock(), 5000,
+      "[update_ego_motion] Failed to get the transform from %s to %s, the temporal ground prior "
+      "is reset.",
+      cloud_frame.c_str(), temporal_prior_fixed_frame_.c_str());
+    ground_filter_ptr_->resetTemporalPrior();
+    has_prev_fixed_from_cloud_ = false;
+    return;
+  }
 
-    auto eigen_tf = tf2::transformToEigen(*tf_ptr);
-    pcl_ros::transformPointCloud(eigen_tf.matrix().cast<float>(), *output, *cloud_transformed);
-    output = std::move(cloud_transformed);
+  if (has_prev_fixed_from_cloud_ && cloud_frame == prev_cloud_frame_) {
+    const Eigen::Matrix4f previous_from_current =
+      prev_fixed_from_cloud_.inverse() * fixed_from_cloud.eigen_transform;
+    ground_filter_ptr_->setEgoMotion(Eigen::Affine3f(previous_from_current));
+  } else {
+    ground_filter_ptr_->resetTemporalPrior();
   }
+  prev_fixed_from_cloud_ = fixed_from_cloud.eigen_transform;
+  prev_cloud_frame_ = cloud_frame;
+  has_prev_fixed_from_cloud_ = true;
+}
 
-  // Same as the comment above
-  if (tf_output_frame_.empty() && output->header.frame_id != tf_input_orig_frame_) {
-    // No tf_output_frame given, transform the dataset to its original frame
-    RCLCPP_DEBUG(
-      this->get_logger(), "[convert_output_costly] Transforming output dataset from %s back to %s.",
-      output->header.frame_id.c_str(), tf_input_orig_frame_.c_str());
+void GroundFilterComponent::start_pipeline()
+{
+  // the grid of the filter is classified, while the grids in the pool are binned
+  grid_pool_.push(ground_filter_ptr_->createGrid());
+  grid_pool_.push(ground_filter_ptr_->createGrid());
 
-    auto cloud_transformed = std::make_unique<sensor_msgs::msg::PointCloud2>();
+  pipeline_threads_.emplace_back(&GroundFilterComponent::run_binning_stage, this);
+  pipeline_threads_.emplace_back(&GroundFilterComponent::run_classification_stage, this);
+  pipeline_threads_.emplace_back(&GroundFilterComponent::run_extraction_stage, this);
+}
 
-    auto tf_ptr = transform_listener_->get_transform(
-      tf_input_orig_frame_, output->header.frame_id, output->header.stamp,
-      rclcpp::Duration::from_seconds(1.0));
-    if (!tf_ptr) {
-      return false;
+void GroundFilterComponent::stop_pipeline()
+{
+  // each stage stops at its next hand-off once the queues are closed
+  binning_queue_.close();
+  classification_queue_.close();
+  extraction_queue_.close();
+  grid_pool_.close();
+  for (auto & thread : pipeline_threads_) {
+    thread.join();
+  }
+  pipeline_threads_.clear();
+}
+
+void GroundFilterComponent::enqueue_frame(
+  const sensor_msgs::msg::PointCloud2::ConstSharedPtr & cloud,
+  const TransformInfo & output_transform_info)
+{
+  auto frame = std::make_unique<PipelineFrame>();
+  frame->received_time = std::chrono::steady_clock::now();
+  frame->cloud = cloud;
+  frame->output_transform_info = output_transform_info;
+  frame->output_frame_id =
+    output_transform_info.need_transform ? tf_output_frame_ : cloud->header.frame_id;
+
+  // the field offsets are set once before the first frame, then they are only read by the stages
+  if (!data_accessor_.isInitialized()) {
+    data_accessor_.setField(cloud);
+    ground_filter_ptr_->setDataAccessor(cloud);
+  }
+
+  // the pose is looked up here, and the ego motion is given to the filter in the classification
+  // stage, so that the ego motion is between the frames which are actually classified
+  if (use_temporal_prior_) {
+    frame->has_fixed_from_cloud =
+      calculate_transform_matrix(temporal_prior_fixed_frame_, *cloud, frame->fixed_from_cloud);
+  }
+
+  // the callback does not wait for the binning stage, the oldest frame is dropped instead
+  if (!binning_queue_.pushDroppingOldest(std::move(frame))) {
+    RCLCPP_WARN_THROTTLE(
+      this->get_logger(), *this->get_clock(), 5000,
+      "[enqueue_frame] The pipeline is busy, a frame is dropped.");
+  }
+}
+
+void GroundFilterComponent::run_binning_stage()
+{
+  PipelineFramePtr frame;
+  while (binning_queue_.pop(frame)) {
+    if (!grid_pool_.pop(frame->grid_ptr)) {
+      return;
     }
+    const auto start_time = std::chrono::steady_clock::now();
+    ground_filter_ptr_->binPoints(frame->cloud, *frame->grid_ptr);
+    frame->binning_time_ms =
+      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time)
+        .count();
+
+    if (!classification_queue_.push(std::move(frame))) {
+      return;
+    }
+  }
+}
 
-    auto eigen_tf = tf2::transformToEigen(*tf_ptr);
-    pcl_ros::transformPointCloud(eigen_tf.matrix().cast<float>(), *output, *cloud_transformed);
-    output = std::move(cloud_transformed);
+void GroundFilterComponent::run_classification_stage()
+{
+  PipelineFramePtr frame;
+  while (classification_queue_.pop(frame)) {
+    const auto start_time = std::chrono::steady_clock::now();
+    if (use_temporal_prior_) {
+      update_ego_motion(
+        frame->cloud->header.frame_id, frame->has_fixed_from_cloud, frame->fixed_from_cloud);
+    }
+    ground_filter_ptr_->classifyBinned(frame->cloud, frame->grid_ptr, frame->no_ground_indices);
+    frame->classification_time_ms =
+      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time)
+        .count();
+
+    // the grid of the previous frame is binned again
+    if (!grid_pool_.push(std::move(frame->grid_ptr))) {
+      return;
+    }
+    if (!extraction_queue_.push(std::move(frame))) {
+      return;
+    }
   }
+}
 
-  return true;
+void GroundFilterComponent::run_extraction_stage()
+{
+  PipelineFramePtr frame;
+  while (extraction_queue_.pop(frame)) {
+    const auto start_time = std::chrono::steady_clock::now();
+    auto output = std::make_unique<PointCloud2>();
+    createOutput(frame->cloud, frame->no_ground_indices, frame->output_transform_info, *output);
+    output->header.frame_id = frame->output_frame_id;
+    pub_output_->publish(std::move(output));
+    published_time_publisher_->publish_if_subscribed(pub_output_, frame->cloud->header.stamp);
+
+    const auto end_time = std::chrono::steady_clock::now();
+    if (debug_publisher_ptr_) {
+      const double extraction_time_ms =
+        std::chrono::duration<double, std::milli>(end_time - start_time).count();
+      const double processing_time_ms =
+        std::chrono::duration<double, std::milli>(end_time - frame->received_time).count();
+      debug_publisher_ptr_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
+        "debug/pipeline/binning_time_ms", frame->binning_time_ms);
+      debug_publisher_ptr_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
+        "debug/pipeline/classification_time_ms", frame->classification_time_ms);
+      debug_publisher_ptr_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
+        "debug/pipeline/extraction_time_ms", extraction_time_ms);
+      debug_publisher_ptr_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
+        "debug/processing_time_ms", processing_time_ms);
+      if (last_output_time_) {
+        const double cyclic_time_ms =
+          std::chrono::duration<double, std::milli>(end_time - *last_output_time_).count();
+        debug_publisher_ptr_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
+          "debug/cyclic_time_ms", cyclic_time_ms);
+      }
+    }
+    last_output_time_ = end_time;
+  }
 }
 
 void GroundFilterComponent::faster_input_indices_callback(
   const sensor_msgs::msg::PointCloud2::ConstSharedPtr cloud,
   const pcl_msgs::msg::PointIndices::ConstSharedPtr indices)
 {
-  if (
-    !is_data_layout_compatible_with_point_xyzircaedt(*cloud) &&
-    !is_data_layout_compatible_with_point_xyzirc(*cloud)) {
+  const auto layout = layout_cache_.get(*cloud);
+  if (!layout.is_xyzircaedt && !layout.is_xyzirc) {
     RCLCPP_ERROR(
       get_logger(),
       "The pointcloud layout is not compatible with PointXYZIRCAEDT or PointXYZIRC. Aborting");
 
-    if (is_data_layout_compatible_with_point_xyziradrt(*cloud)) {
+    if (layout.is_xyziradrt) {
       RCLCPP_ERROR(
         get_logger(),
         "The pointcloud layout is compatible with PointXYZIRADRT. You may be using legacy "
         "code/data");
     }
 
-    if (is_data_layout_compatible_with_point_xyzi(*cloud)) {
+    if (layout.is_xyzi) {
       RCLCPP_ERROR(
         get_logger(),
         "The pointcloud layout is compatible with PointXYZI. You may be using legacy "
@@ -375,6 +551,16 @@ void GroundFilterComponent::faster_input_indices_callback(
   TransformInfo transform_info;
   if (!calculate_transform_matrix(tf_input_frame_, *cloud, transform_info)) return;
 
+  // The output transform is applied while the non-ground points are extracted.
+  TransformInfo output_transform_info;
+  if (!calculate_output_transform_matrix(*cloud, output_transform_info)) return;
+
+  // The frame is processed and published by the threads of the pipeline.
+  if (use_pipelined_execution_) {
+    enqueue_frame(cloud, output_transform_info);
+    return;
+  }
+
   // Need setInputCloud() here because we have to extract x/y/z
   pcl::IndicesPtr vindices;
   if (indices) {
@@ -384,10 +570,11 @@ void GroundFilterComponent::faster_input_indices_callback(
   auto output = std::make_unique<PointCloud2>();
 
   // TODO(sykwer): Change to `filter()` call after when the filter nodes conform to new API.
-  faster_filter(cloud, vindices, *output, transform_info);
-
-  if (!convert_output_costly(output)) return;
+  faster_filter(cloud, vindices, *output, transform_info, output_transform_info);
 
+  if (output_transform_info.need_transform) {
+    output->header.frame_id = tf_output_frame_;
+  }
   output->header.stamp = cloud->header.stamp;
   pub_output_->publish(std::move(output));
   published_time_publisher_->publish_if_subscribed(pub_output_, cloud->header.stamp);
@@ -581,26 +768,67 @@ void GroundFilterComponent::classifyPointCloud(
 
 void GroundFilterComponent::extractObjectPoints(
   const sensor_msgs::msg::PointCloud2::ConstSharedPtr & in_cloud_ptr,
-  const pcl::PointIndices & in_indices, sensor_msgs::msg::PointCloud2 & out_object_cloud) const
+  const pcl::PointIndices & in_indices, const TransformInfo & transform_info,
+  sensor_msgs::msg::PointCloud2 & out_object_cloud) const
 {
   std::unique_ptr<autoware_utils_debug::ScopedTimeTrack> st_ptr;
   if (time_keeper_)
     st_ptr = std::make_unique<autoware_utils_debug::ScopedTimeTrack>(__func__, *time_keeper_);
 
+  const auto & indices = in_indices.indices;
+  const size_t point_step = in_cloud_ptr->point_step;
+  const uint8_t * in_data = in_cloud_ptr->data.data();
+  uint8_t * out_data = out_object_cloud.data.data();
   size_t output_data_size = 0;
 
-  for (const auto & idx : in_indices.indices) {
-    std::memcpy(
-      &out_object_cloud.data[output_data_size], &in_cloud_ptr->data[idx],
-      in_cloud_ptr->point_step * sizeof(uint8_t));
-    output_data_size += in_cloud_ptr->point_step;
+  for (size_t i = 0; i < indices.size();) {
+    // the consecutive points in the input are copied at once
+    size_t run_end = i + 1;
+    while (run_end < indices.size() &&
+           static_cast<size_t>(indices[run_end]) == indices[run_end - 1] + point_step) {
+      ++run_end;
+    }
+    const size_t run_data_size = (run_end - i) * point_step;
+    std::memcpy(&out_data[output_data_size], &in_data[indices[i]], run_data_size);
+
+    // transform the copied points while they are in the cache
+    if (transform_info.need_transform) {
+      for (size_t offset = output_data_size; offset < output_data_size + run_data_size;
+           offset += point_step) {
+        pcl::PointXYZ point;
+        data_accessor_.getPoint(&out_data[offset], point);
+        point.getVector4fMap() = transform_info.eigen_transform * point.getVector4fMap();
+        data_accessor_.setPoint(point, &out_data[offset]);
+      }
+    }
+    output_data_size += run_data_size;
+    i = run_end;
   }
 }
 
+void GroundFilterComponent::createOutput(
+  const sensor_msgs::msg::PointCloud2::ConstSharedPtr & in_cloud_ptr,
+  const pcl::PointIndices & in_no_ground_indices, const TransformInfo & transform_info,
+  sensor_msgs::msg::PointCloud2 & out_object_cloud) const
+{
+  out_object_cloud.row_step = in_no_ground_indices.indices.size() * in_cloud_ptr->point_step;
+  out_object_cloud.data.resize(out_object_cloud.row_step);
+  out_object_cloud.width = in_no_ground_indices.indices.size();
+  out_object_cloud.fields = in_cloud_ptr->fields;
+  out_object_cloud.is_dense = true;
+  out_object_cloud.height = in_cloud_ptr->height;
+  out_object_cloud.is_bigendian = in_cloud_ptr->is_bigendian;
+  out_object_cloud.point_step = in_cloud_ptr->point_step;
+  out_object_cloud.header = in_cloud_ptr->header;
+
+  extractObjectPoints(in_cloud_ptr, in_no_ground_indices, transform_info, out_object_cloud);
+}
+
 void GroundFilterComponent::faster_filter(
   const sensor_msgs::msg::PointCloud2::ConstSharedPtr & input,
   [[maybe_unused]] const pcl::IndicesPtr & indices, sensor_msgs::msg::PointCloud2 & output,
-  [[maybe_unused]] const TransformInfo & transform_info)
+  [[maybe_unused]] const TransformInfo & transform_info,
+  const TransformInfo & output_transform_info)
 {
   std::unique_ptr<autoware_utils_debug::ScopedTimeTrack> st_ptr;
   if (time_keeper_)
@@ -618,23 +846,19 @@ void GroundFilterComponent::faster_filter(
   pcl::PointIndices no_ground_indices;
 
   if (elevation_grid_mode_) {
+    if (use_temporal_prior_) {
+      TransformInfo fixed_from_cloud;
+      const bool has_fixed_from_cloud =
+        calculate_transform_matrix(temporal_prior_fixed_frame_, *input, fixed_from_cloud);
+      update_ego_motion(input->header.frame_id, has_fixed_from_cloud, fixed_from_cloud);
+    }
     ground_filter_ptr_->process(input, no_ground_indices);
   } else {
     std::vector<PointCloudVector> radial_ordered_points;
     convertPointcloud(input, radial_ordered_points);
     classifyPointCloud(input, radial_ordered_points, no_ground_indices);
   }
-  output.row_step = no_ground_indices.indices.size() * input->point_step;
-  output.data.resize(output.row_step);
-  output.width = no_ground_indices.indices.size();
-  output.fields = input->fields;
-  output.is_dense = true;
-  output.height = input->height;
-  output.is_bigendian = input->is_bigendian;
-  output.point_step = input->point_step;
-  output.header = input->header;
-
-  extractObjectPoints(input, no_ground_indices, output);
+  createOutput(input, no_ground_indices, output_transform_info, output);
   if (debug_publisher_ptr_ && stop_watch_ptr_) {
     const double cyclic_time_ms = stop_watch_ptr_->toc("cyclic_time", true);
     const double processing_time_ms = stop_watch_ptr_->toc("processing_time", true);
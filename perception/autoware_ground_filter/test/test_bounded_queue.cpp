@@ -0,0 +1,102 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/ground_filter/bounded_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+using autoware::ground_filter::BoundedQueue;
+
+// long enough for a thread to reach the wait on the queue
+constexpr std::chrono::milliseconds wait_time{50};
+}  // namespace
+
+TEST(BoundedQueue, FifoOrder)
+{
+  BoundedQueue<int> queue(3);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_TRUE(queue.push(i));
+  }
+  int item = -1;
+  EXPECT_TRUE(queue.pop(item));
+  EXPECT_EQ(item, 0);
+  EXPECT_TRUE(queue.push(3));
+  for (int i = 1; i < 4; ++i) {
+    EXPECT_TRUE(queue.pop(item));
+    EXPECT_EQ(item, i);
+  }
+}
+
+TEST(BoundedQueue, PushDroppingOldest)
+{
+  BoundedQueue<int> queue(2);
+  EXPECT_TRUE(queue.pushDroppingOldest(0));
+  EXPECT_TRUE(queue.pushDroppingOldest(1));
+  // the queue is full, the oldest item is dropped
+  EXPECT_FALSE(queue.pushDroppingOldest(2));
+  int item = -1;
+  EXPECT_TRUE(queue.pop(item));
+  EXPECT_EQ(item, 1);
+  EXPECT_TRUE(queue.pop(item));
+  EXPECT_EQ(item, 2);
+}
+
+TEST(BoundedQueue, CloseWakesBlockedPush)
+{
+  BoundedQueue<int> queue(1);
+  EXPECT_TRUE(queue.push(0));
+  std::atomic<bool> is_returned{false};
+  bool is_pushed = true;
+  std::thread producer([&]() {
+    is_pushed = queue.push(1);
+    is_returned = true;
+  });
+  std::this_thread::sleep_for(wait_time);
+  EXPECT_FALSE(is_returned);
+
+  queue.close();
+  producer.join();
+  EXPECT_FALSE(is_pushed);
+  EXPECT_FALSE(queue.pushDroppingOldest(2));
+
+  // the item pushed before close() is still popped
+  int item = -1;
+  EXPECT_TRUE(queue.pop(item));
+  EXPECT_EQ(item, 0);
+  EXPECT_FALSE(queue.pop(item));
+}
+
+TEST(BoundedQueue, CloseWakesBlockedPop)
+{
+  BoundedQueue<int> queue(1);
+  std::atomic<bool> is_returned{false};
+  bool is_popped = true;
+  std::thread consumer([&]() {
+    int item = -1;
+    is_popped = queue.pop(item);
+    is_returned = true;
+  });
+  std::this_thread::sleep_for(wait_time);
+  EXPECT_FALSE(is_returned);
+
+  queue.close();
+  consumer.join();
+  EXPECT_FALSE(is_popped);
+}
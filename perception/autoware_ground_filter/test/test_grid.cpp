@@ -0,0 +1,275 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/ground_filter/grid.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+using autoware::ground_filter::Cell;
+using autoware::ground_filter::Grid;
+using autoware::ground_filter::Point;
+using autoware::ground_filter::PointBlock;
+using autoware::ground_filter::UnsortedPoint;
+
+struct InputPoint
+{
+  float x;
+  float y;
+  float z;
+};
+
+Grid createGrid()
+{
+  Grid grid(0.0f, 0.0f, 2.0f);
+  grid.initialize(0.5f, 1.0f * M_PIf / 180.0f, 20.0f);
+  return grid;
+}
+
+// points on the half of the grid with positive y, so that the other half is empty, and some
+// sparse points up to out of the grid, which leave empty cells between them
+std::vector<InputPoint> createPoints(const unsigned int seed)
+{
+  std::mt19937 engine(seed);
+  std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+  std::vector<InputPoint> points;
+  for (size_t i = 0; i < 20000; ++i) {
+    const bool is_sparse = i % 10 == 0;
+    const float radius = is_sparse ? 1.0f + 250.0f * distribution(engine)
+                                   : 1.0f + 60.0f * std::pow(distribution(engine), 2.0f);
+    const float azimuth = (is_sparse ? 2.0f : 1.0f) * M_PIf * distribution(engine);
+    const float z = 0.3f * (distribution(engine) - 0.5f);
+    points.push_back({radius * std::cos(azimuth), radius * std::sin(azimuth), z});
+  }
+  return points;
+}
+
+// the points of each cell in its own vector, in the order of addition
+std::vector<std::vector<Point>> binPointsPerCell(
+  const Grid & grid, const std::vector<InputPoint> & points)
+{
+  std::vector<std::vector<Point>> cell_points(grid.getGridSize());
+  for (size_t i = 0; i < points.size(); ++i) {
+    const auto & p = points[i];
+    const int grid_idx = grid.getCellIdx(p.x, p.y);
+    if (grid_idx < 0) {
+      continue;
+    }
+    cell_points[grid_idx].push_back(Point{i, std::sqrt(p.x * p.x + p.y * p.y), p.z});
+  }
+  return cell_points;
+}
+
+void addPoints(Grid & grid, const std::vector<InputPoint> & points)
+{
+  grid.resetCells();
+  grid.reservePoints(points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    grid.addPoint(points[i].x, points[i].y, points[i].z, i);
+  }
+  grid.sortPoints();
+}
+
+// the points added by addPoint() one by one
+std::vector<UnsortedPoint> addPointsOneByOne(Grid & grid, const std::vector<InputPoint> & points)
+{
+  grid.resetCells();
+  for (size_t i = 0; i < points.size(); ++i) {
+    grid.addPoint(points[i].x, points[i].y, points[i].z, i);
+  }
+  return grid.getUnsortedPoints();
+}
+
+// the points added by addPoints() in blocks, as the ground filter does
+std::vector<UnsortedPoint> addPointsInBlocks(Grid & grid, const std::vector<InputPoint> & points)
+{
+  grid.resetCells();
+  PointBlock block;
+  for (size_t i = 0; i < points.size(); ++i) {
+    block.addPoint(points[i].x, points[i].y, points[i].z, i);
+    if (block.isFull()) {
+      grid.addPoints(block);
+      block.clear();
+    }
+  }
+  grid.addPoints(block);
+  return grid.getUnsortedPoints();
+}
+
+// the recursive search which follows the scan root cells, including the cells without ground
+void searchGroundCellsRecursively(
+  Grid & grid, const int check_idx, const int search_cnt, std::vector<int> & idx)
+{
+  if (check_idx < 0 || search_cnt == 0) {
+    return;
+  }
+  const Cell & check_cell = grid.getCell(check_idx);
+  if (check_cell.has_ground_) {
+    idx.push_back(check_idx);
+    searchGroundCellsRecursively(grid, check_cell.scan_grid_root_idx_, search_cnt - 1, idx);
+    return;
+  }
+  searchGroundCellsRecursively(grid, check_cell.scan_grid_root_idx_, search_cnt, idx);
+}
+}  // namespace
+
+TEST(GroundFilterGrid, FlatPointArrayMatchesPerCellVectors)
+{
+  auto grid = createGrid();
+
+  // the second frame checks that the points of the first frame are cleared
+  for (const unsigned int seed : {0U, 1U}) {
+    const auto points = createPoints(seed);
+    addPoints(grid, points);
+    const auto expected_cell_points = binPointsPerCell(grid, points);
+
+    size_t empty_cell_num = 0;
+    for (size_t idx = 0; idx < grid.getGridSize(); ++idx) {
+      const auto & point_list = grid.getCell(idx).point_list_;
+      const auto & expected_points = expected_cell_points[idx];
+      ASSERT_EQ(point_list.size(), expected_points.size()) << "cell " << idx;
+      EXPECT_EQ(grid.getCell(idx).isEmpty(), expected_points.empty());
+      empty_cell_num += expected_points.empty() ? 1 : 0;
+
+      size_t i = 0;
+      for (const auto & point : point_list) {
+        EXPECT_EQ(point.index, expected_points[i].index);
+        EXPECT_FLOAT_EQ(point.distance, expected_points[i].distance);
+        EXPECT_EQ(point.height, expected_points[i].height);
+        ++i;
+      }
+    }
+    EXPECT_GT(empty_cell_num, grid.getGridSize() / 2);
+  }
+}
+
+TEST(GroundFilterGrid, BlockedAdditionMatchesPointByPoint)
+{
+  auto grid = createGrid();
+  constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+  constexpr float inf = std::numeric_limits<float>::infinity();
+  // the radial limit of the grid, and the switch radius of createGrid()
+  constexpr float radial_limit = 200.0f;
+  constexpr float switch_radius = 20.0f;
+
+  // the special points between random points, the number of the points is not a multiple of the
+  // block size so that the last block is partial
+  auto points = createPoints(0);
+  points.resize(10 * PointBlock::capacity + 37);
+  const std::vector<InputPoint> special_points = {
+    // on the y axis, where the azimuth is special
+    {0.0f, -5.0f, 0.1f},
+    {0.0f, 0.0f, 0.1f},
+    {0.0f, 5.0f, 0.1f},
+    {0.0f, 50.0f, 0.1f},
+    {-0.0f, 5.0f, 0.1f},
+    // non-finite coordinates
+    {nan, 5.0f, 0.1f},
+    {5.0f, nan, 0.1f},
+    {5.0f, 5.0f, nan},
+    {inf, 5.0f, 0.1f},
+    {5.0f, -inf, 0.1f},
+    {5.0f, 5.0f, inf},
+    // around the radial limit
+    {radial_limit, 0.0f, 0.1f},
+    {std::nextafter(radial_limit, 0.0f), 0.0f, 0.1f},
+    {0.0f, radial_limit, 0.1f},
+    {0.0f, std::nextafter(radial_limit, 0.0f), 0.1f},
+    {-std::nextafter(radial_limit, 0.0f), 0.0f, 0.1f},
+    // around the switch radius
+    {switch_radius, 0.0f, 0.1f},
+    {std::nextafter(switch_radius, 0.0f), 0.0f, 0.1f},
+    {std::nextafter(switch_radius, radial_limit), 0.0f, 0.1f},
+    {0.0f, switch_radius, 0.1f},
+    {-switch_radius, 0.0f, 0.1f},
+    {0.0f, -switch_radius, 0.1f},
+  };
+  for (size_t i = 0; i < special_points.size(); ++i) {
+    points[7 * i + 3] = special_points[i];
+  }
+  // the special points in the partial last block as well
+  points.insert(points.end() - 5, special_points.begin(), special_points.end());
+  ASSERT_NE(points.size() % PointBlock::capacity, 0U);
+
+  const auto expected_points = addPointsOneByOne(grid, points);
+  const auto unsorted_points = addPointsInBlocks(grid, points);
+  ASSERT_EQ(unsorted_points.size(), expected_points.size());
+  for (size_t i = 0; i < unsorted_points.size(); ++i) {
+    const auto & point = unsorted_points[i];
+    const auto & expected_point = expected_points[i];
+    EXPECT_EQ(point.grid_idx, expected_point.grid_idx) << "point " << i;
+    EXPECT_EQ(point.point.index, expected_point.point.index) << "point " << i;
+    EXPECT_EQ(point.point.distance, expected_point.point.distance) << "point " << i;
+    if (std::isnan(expected_point.point.height)) {
+      EXPECT_TRUE(std::isnan(point.point.height)) << "point " << i;
+    } else {
+      EXPECT_EQ(point.point.height, expected_point.point.height) << "point " << i;
+    }
+  }
+
+  // the points out of the grid are not added
+  EXPECT_LT(expected_points.size(), points.size());
+}
+
+TEST(GroundFilterGrid, IterativeGroundSearchMatchesRecursiveSearch)
+{
+  auto grid = createGrid();
+  addPoints(grid, createPoints(0));
+  grid.setGridConnections();
+
+  // mark the ground cells at random, except for the cells of small azimuth which have no ground
+  // before them
+  std::mt19937 engine(0);
+  for (size_t idx = 0; idx < grid.getGridSize(); ++idx) {
+    auto & cell = grid.getCell(idx);
+    cell.has_ground_ = !cell.isEmpty() && cell.center_azimuth_ > 0.5f && engine() % 3 != 0;
+  }
+
+  // the links are set in the order of the cells as in the classification
+  for (size_t idx = 0; idx < grid.getGridSize(); ++idx) {
+    if (!grid.getCell(idx).isEmpty()) {
+      grid.setScanGroundRoot(idx);
+    }
+  }
+
+  size_t no_ground_search_num = 0;
+  size_t full_search_num = 0;
+  std::vector<int> idx_iterative;
+  std::vector<int> idx_recursive;
+  for (const int search_cnt : {1, 4, 1000}) {
+    for (size_t idx = 0; idx < grid.getGridSize(); ++idx) {
+      const auto & cell = grid.getCell(idx);
+      if (cell.isEmpty()) {
+        continue;
+      }
+      idx_iterative.clear();
+      idx_recursive.clear();
+      grid.searchGroundCells(cell.scan_grid_root_idx_, search_cnt, idx_iterative);
+      searchGroundCellsRecursively(grid, cell.scan_grid_root_idx_, search_cnt, idx_recursive);
+      ASSERT_EQ(idx_iterative, idx_recursive) << "cell " << idx << ", count " << search_cnt;
+
+      no_ground_search_num += idx_iterative.empty() ? 1 : 0;
+      full_search_num += static_cast<int>(idx_iterative.size()) == search_cnt ? 1 : 0;
+    }
+  }
+  EXPECT_GT(no_ground_search_num, 0U);
+  EXPECT_GT(full_search_num, 0U);
+}
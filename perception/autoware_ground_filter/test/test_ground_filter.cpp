@@ -0,0 +1,346 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/ground_filter/bounded_queue.hpp"
+#include "autoware/ground_filter/ground_filter.hpp"
+
+#include <Eigen/Geometry>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <pcl/PointIndices.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using autoware::ground_filter::BoundedQueue;
+using autoware::ground_filter::Grid;
+using autoware::ground_filter::GroundFilter;
+using autoware::ground_filter::GroundFilterParameter;
+using sensor_msgs::msg::PointCloud2;
+
+struct InputPoint
+{
+  float x;
+  float y;
+  float z;
+};
+
+GroundFilterParameter createParameter(const bool use_temporal_prior)
+{
+  GroundFilterParameter param;
+  param.global_slope_max_angle_rad = 10.0f * M_PIf / 180.0f;
+  param.local_slope_max_angle_rad = 13.0f * M_PIf / 180.0f;
+  param.radial_divider_angle_rad = 1.0f * M_PIf / 180.0f;
+  param.use_recheck_ground_cluster = true;
+  param.use_lowest_point = true;
+  param.detection_range_z_max = 2.5f;
+  param.non_ground_height_threshold = 0.2f;
+  param.grid_size_m = 0.5f;
+  param.grid_mode_switch_radius = 20.0f;
+  param.ground_grid_buffer_size = 4;
+  param.virtual_lidar_x = 0.0f;
+  param.virtual_lidar_y = 0.0f;
+  param.virtual_lidar_z = 2.0f;
+  param.use_temporal_prior = use_temporal_prior;
+  param.temporal_prior_residual_threshold = 0.1f;
+  return param;
+}
+
+PointCloud2::ConstSharedPtr createPointCloud(const std::vector<InputPoint> & points)
+{
+  auto cloud = std::make_shared<PointCloud2>();
+  sensor_msgs::PointCloud2Modifier modifier(*cloud);
+  modifier.setPointCloud2Fields(
+    3, "x", 1, sensor_msgs::msg::PointField::FLOAT32, "y", 1, sensor_msgs::msg::PointField::FLOAT32,
+    "z", 1, sensor_msgs::msg::PointField::FLOAT32);
+  modifier.resize(points.size());
+  sensor_msgs::PointCloud2Iterator<float> iter_x(*cloud, "x");
+  sensor_msgs::PointCloud2Iterator<float> iter_y(*cloud, "y");
+  sensor_msgs::PointCloud2Iterator<float> iter_z(*cloud, "z");
+  for (const auto & point : points) {
+    *iter_x = point.x;
+    *iter_y = point.y;
+    *iter_z = point.z;
+    ++iter_x;
+    ++iter_y;
+    ++iter_z;
+  }
+  return cloud;
+}
+
+/**
+ * @brief flat ground at the height, with tall obstacles in the middle range and low obstacles on
+ * the first ring of the grid. The low obstacles are below the global slope of the ring, so the
+ * ground initialization does not classify them, while they are above the ground of a prior.
+ */
+std::vector<InputPoint> createFlatGround(
+  const float ground_height, std::vector<size_t> & low_obstacle_ids,
+  std::vector<size_t> & obstacle_ids)
+{
+  std::vector<InputPoint> points;
+  low_obstacle_ids.clear();
+  obstacle_ids.clear();
+  for (int i_azimuth = 0; i_azimuth < 720; ++i_azimuth) {
+    const float azimuth = 0.5f * M_PIf / 180.0f * (static_cast<float>(i_azimuth) + 0.5f);
+    const float cos_azimuth = std::cos(azimuth);
+    const float sin_azimuth = std::sin(azimuth);
+    for (int i_radius = 0; i_radius < 112; ++i_radius) {
+      const float radius = 2.05f + 0.25f * static_cast<float>(i_radius);
+      points.push_back({radius * cos_azimuth, radius * sin_azimuth, ground_height});
+    }
+    if (i_azimuth % 20 == 0) {
+      low_obstacle_ids.push_back(points.size());
+      points.push_back({2.4f * cos_azimuth, 2.4f * sin_azimuth, ground_height + 0.25f});
+    }
+    if (i_azimuth % 20 == 10) {
+      for (int i_height = 0; i_height < 5; ++i_height) {
+        obstacle_ids.push_back(points.size());
+        points.push_back(
+          {10.1f * cos_azimuth, 10.1f * sin_azimuth,
+           ground_height + 0.5f + 0.2f * static_cast<float>(i_height)});
+      }
+    }
+  }
+  return points;
+}
+
+// height of the uneven ground in the world
+float getGroundHeight(const float x, const float y)
+{
+  return 0.03f * x + 0.3f * std::sin(0.05f * y);
+}
+
+// uneven ground seen from a vehicle moving on it, with obstacle points above the ground
+std::vector<InputPoint> createFrame(const Eigen::Affine3f & world_from_vehicle, std::mt19937 & gen)
+{
+  std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+  const Eigen::Affine3f vehicle_from_world = world_from_vehicle.inverse();
+  std::vector<InputPoint> points;
+  for (size_t i = 0; i < 20000; ++i) {
+    // some low obstacles on the first ring, which are classified only with the prior
+    const bool is_low_obstacle = i % 50 == 1;
+    const float radius = is_low_obstacle ? 2.0f + 0.5f * dist(gen)
+                                         : 2.0f + 80.0f * std::pow(dist(gen), 2.0f);
+    const float azimuth = 2.0f * M_PIf * dist(gen);
+    Eigen::Vector3f point(radius * std::cos(azimuth), radius * std::sin(azimuth), 0.0f);
+    point = world_from_vehicle * point;
+    point.z() = getGroundHeight(point.x(), point.y()) + 0.06f * (dist(gen) - 0.5f);
+    if (is_low_obstacle) {
+      point.z() += 0.25f;
+    } else if (i % 7 == 0) {
+      point.z() += 0.5f + 2.0f * dist(gen);
+    }
+    point = vehicle_from_world * point;
+    points.push_back({point.x(), point.y(), point.z()});
+  }
+  return points;
+}
+
+Eigen::Affine3f getVehiclePose(const int frame)
+{
+  const float x = 1.0f * static_cast<float>(frame);
+  const float y = 0.2f * static_cast<float>(frame);
+  return Eigen::Translation3f(x, y, getGroundHeight(x, y)) *
+         Eigen::AngleAxisf(0.01f * static_cast<float>(frame), Eigen::Vector3f::UnitZ()) *
+         Eigen::AngleAxisf(-std::atan(0.03f), Eigen::Vector3f::UnitY());
+}
+
+std::vector<size_t> process(GroundFilter & filter, const PointCloud2::ConstSharedPtr & cloud)
+{
+  filter.setDataAccessor(cloud);
+  pcl::PointIndices no_ground_indices;
+  filter.process(cloud, no_ground_indices);
+  std::vector<size_t> point_ids;
+  for (const auto & data_index : no_ground_indices.indices) {
+    point_ids.push_back(static_cast<size_t>(data_index) / cloud->point_step);
+  }
+  std::sort(point_ids.begin(), point_ids.end());
+  return point_ids;
+}
+
+bool contains(const std::vector<size_t> & sorted_ids, const size_t id)
+{
+  return std::binary_search(sorted_ids.begin(), sorted_ids.end(), id);
+}
+}  // namespace
+
+// without the temporal prior, the ego motion and the reset of the prior do not change the output
+// of a sequence of frames
+TEST(GroundFilterTest, TemporalPriorDisabled)
+{
+  auto param = createParameter(false);
+  GroundFilter filter(param);
+  GroundFilter ego_motion_filter(param);
+  std::mt19937 gen(0);
+  for (int frame = 0; frame < 5; ++frame) {
+    const auto cloud = createPointCloud(createFrame(getVehiclePose(frame), gen));
+    if (frame == 3) {
+      ego_motion_filter.resetTemporalPrior();
+    } else if (frame > 0) {
+      ego_motion_filter.setEgoMotion(getVehiclePose(frame - 1).inverse() * getVehiclePose(frame));
+    }
+    const auto no_ground_ids = process(filter, cloud);
+    EXPECT_FALSE(no_ground_ids.empty());
+    EXPECT_EQ(process(ego_motion_filter, cloud), no_ground_ids);
+  }
+}
+
+// the ground of the previous frame seeds the cells, which classifies the low obstacles on the
+// first ring, and nothing is lost against the filter without the prior
+TEST(GroundFilterTest, TemporalPriorIdentityMotion)
+{
+  std::vector<size_t> low_obstacle_ids;
+  std::vector<size_t> obstacle_ids;
+  const auto cloud = createPointCloud(createFlatGround(0.0f, low_obstacle_ids, obstacle_ids));
+
+  auto param = createParameter(false);
+  GroundFilter filter(param);
+  const auto expected_ids = process(filter, cloud);
+  for (const auto id : low_obstacle_ids) {
+    EXPECT_FALSE(contains(expected_ids, id));
+  }
+
+  auto temporal_param = createParameter(true);
+  GroundFilter temporal_filter(temporal_param);
+  // no prior in the first frame
+  EXPECT_EQ(process(temporal_filter, cloud), expected_ids);
+
+  temporal_filter.setEgoMotion(Eigen::Affine3f::Identity());
+  const auto no_ground_ids = process(temporal_filter, cloud);
+  EXPECT_TRUE(
+    std::includes(
+      no_ground_ids.begin(), no_ground_ids.end(), expected_ids.begin(), expected_ids.end()));
+  for (const auto id : obstacle_ids) {
+    EXPECT_TRUE(contains(no_ground_ids, id));
+  }
+  for (const auto id : low_obstacle_ids) {
+    EXPECT_TRUE(contains(no_ground_ids, id));
+  }
+  // only the obstacles are added
+  EXPECT_EQ(no_ground_ids.size(), expected_ids.size() + low_obstacle_ids.size());
+
+  // the prior is discarded without the ego motion
+  temporal_filter.resetTemporalPrior();
+  EXPECT_EQ(process(temporal_filter, cloud), expected_ids);
+}
+
+// the ground steps up between the frames by more than the residual threshold, so the cells do not
+// fit the prior and are initialized without it. The points classified as obstacles from the prior
+// are removed from the output again.
+TEST(GroundFilterTest, TemporalPriorResidualCheck)
+{
+  std::vector<size_t> low_obstacle_ids;
+  std::vector<size_t> obstacle_ids;
+  const auto cloud = createPointCloud(createFlatGround(0.0f, low_obstacle_ids, obstacle_ids));
+  const auto stepped_cloud =
+    createPointCloud(createFlatGround(0.15f, low_obstacle_ids, obstacle_ids));
+
+  auto param = createParameter(false);
+  GroundFilter filter(param);
+  const auto expected_ids = process(filter, stepped_cloud);
+
+  auto temporal_param = createParameter(true);
+  GroundFilter temporal_filter(temporal_param);
+  process(temporal_filter, cloud);
+  temporal_filter.setEgoMotion(Eigen::Affine3f::Identity());
+  const auto no_ground_ids = process(temporal_filter, stepped_cloud);
+
+  // the stepped ground and the low obstacles are above the prior by more than the threshold
+  EXPECT_EQ(no_ground_ids, expected_ids);
+  for (const auto id : low_obstacle_ids) {
+    EXPECT_FALSE(contains(no_ground_ids, id));
+  }
+  for (const auto id : obstacle_ids) {
+    EXPECT_TRUE(contains(no_ground_ids, id));
+  }
+}
+
+// the pipelined execution gives the same output as process() for every frame. As in the node, the
+// points of the next frames are binned on another thread into the grids of a pool of two, which
+// rotate with the grid of the filter.
+TEST(GroundFilterTest, PipelinedExecution)
+{
+  constexpr int frame_num = 8;
+  std::mt19937 gen(0);
+  std::vector<PointCloud2::ConstSharedPtr> clouds;
+  for (int frame = 0; frame < frame_num; ++frame) {
+    clouds.push_back(createPointCloud(createFrame(getVehiclePose(frame), gen)));
+  }
+
+  for (const bool use_temporal_prior : {false, true}) {
+    auto param = createParameter(use_temporal_prior);
+    GroundFilter filter(param);
+    GroundFilter pipelined_filter(param);
+    filter.setDataAccessor(clouds.front());
+    pipelined_filter.setDataAccessor(clouds.front());
+
+    BoundedQueue<std::unique_ptr<Grid>> grid_pool(2);
+    grid_pool.push(pipelined_filter.createGrid());
+    grid_pool.push(pipelined_filter.createGrid());
+    BoundedQueue<std::unique_ptr<Grid>> binned_grids(1);
+    std::thread binning_thread([&]() {
+      for (const auto & cloud : clouds) {
+        std::unique_ptr<Grid> grid_ptr;
+        if (!grid_pool.pop(grid_ptr)) {
+          return;
+        }
+        pipelined_filter.binPoints(cloud, *grid_ptr);
+        if (!binned_grids.push(std::move(grid_ptr))) {
+          return;
+        }
+      }
+    });
+
+    for (int frame = 0; frame < frame_num; ++frame) {
+      if (frame > 0) {
+        const auto ego_motion = getVehiclePose(frame - 1).inverse() * getVehiclePose(frame);
+        filter.setEgoMotion(ego_motion);
+        pipelined_filter.setEgoMotion(ego_motion);
+      }
+      pcl::PointIndices expected_indices;
+      filter.process(clouds[frame], expected_indices);
+
+      std::unique_ptr<Grid> grid_ptr;
+      ASSERT_TRUE(binned_grids.pop(grid_ptr));
+      pcl::PointIndices no_ground_indices;
+      pipelined_filter.classifyBinned(clouds[frame], grid_ptr, no_ground_indices);
+      ASSERT_TRUE(grid_pool.push(std::move(grid_ptr)));
+
+      EXPECT_FALSE(expected_indices.indices.empty());
+      EXPECT_EQ(no_ground_indices.indices, expected_indices.indices)
+        << "frame " << frame << ", temporal prior " << use_temporal_prior;
+    }
+    grid_pool.close();
+    binned_grids.close();
+    binning_thread.join();
+  }
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,256 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/ground_filter/node.hpp"
+
+#include <Eigen/Geometry>
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <rclcpp/rclcpp.hpp>
+#include <tf2_eigen/tf2_eigen.hpp>
+#include <tf2_ros/static_transform_broadcaster.h>
+#include <tf2_ros/transform_broadcaster.h>
+
+#include <geometry_msgs/msg/transform_stamped.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace
+{
+using autoware::ground_filter::GroundFilterComponent;
+using sensor_msgs::msg::PointCloud2;
+
+constexpr char sensor_frame[] = "velodyne";
+constexpr char output_frame[] = "base_link";
+
+std::shared_ptr<GroundFilterComponent> generateNode(const bool has_static_tf_only)
+{
+  auto node_options = rclcpp::NodeOptions{};
+  node_options.append_parameter_override("output_frame", output_frame);
+  node_options.append_parameter_override("has_static_tf_only", has_static_tf_only);
+  const auto ground_filter_dir =
+    ament_index_cpp::get_package_share_directory("autoware_ground_filter");
+  const auto vehicle_info_dir =
+    ament_index_cpp::get_package_share_directory("autoware_vehicle_info_utils");
+  node_options.arguments(
+    {"--ros-args", "--params-file", ground_filter_dir + "/config/ground_filter.param.yaml",
+     "--params-file", vehicle_info_dir + "/config/vehicle_info.param.yaml"});
+  return std::make_shared<GroundFilterComponent>(node_options);
+}
+
+geometry_msgs::msg::TransformStamped createTransform(
+  const rclcpp::Time & stamp, const double x, const double yaw)
+{
+  geometry_msgs::msg::TransformStamped transform;
+  transform.header.stamp = stamp;
+  transform.header.frame_id = output_frame;
+  transform.child_frame_id = sensor_frame;
+  transform.transform.translation.x = x;
+  transform.transform.translation.y = 0.5;
+  transform.transform.translation.z = 0.3;
+  transform.transform.rotation.z = std::sin(yaw / 2.0);
+  transform.transform.rotation.w = std::cos(yaw / 2.0);
+  return transform;
+}
+
+/**
+ * @brief flat ground with obstacle points, the intensity is the index of the point. The obstacles
+ * are a run of consecutive points and isolated points between the ground points, so that the
+ * output is copied both at once and point by point.
+ */
+PointCloud2 createPointCloud(const rclcpp::Time & stamp, std::set<int> & obstacle_ids)
+{
+  struct InputPoint
+  {
+    float x;
+    float y;
+    float z;
+  };
+  std::vector<InputPoint> points;
+  obstacle_ids.clear();
+  for (int ix = 0; ix < 49; ++ix) {
+    for (int iy = 0; iy < 33; ++iy) {
+      const float x = 2.0f + 0.25f * static_cast<float>(ix);
+      const float y = -4.0f + 0.25f * static_cast<float>(iy);
+      points.push_back({x, y, 0.0f});
+      if (x >= 3.0f && x <= 8.0f && iy % 8 == 4) {
+        obstacle_ids.insert(static_cast<int>(points.size()));
+        points.push_back({x + 0.1f, y + 0.1f, 1.5f});
+      }
+    }
+    if (ix == 24) {
+      for (int i = 0; i < 20; ++i) {
+        obstacle_ids.insert(static_cast<int>(points.size()));
+        points.push_back(
+          {6.5f, 1.1f + 0.02f * static_cast<float>(i), 1.2f + 0.04f * static_cast<float>(i)});
+      }
+    }
+  }
+
+  PointCloud2 cloud;
+  cloud.header.stamp = stamp;
+  cloud.header.frame_id = sensor_frame;
+  sensor_msgs::PointCloud2Modifier modifier(cloud);
+  modifier.setPointCloud2Fields(
+    4, "x", 1, sensor_msgs::msg::PointField::FLOAT32, "y", 1, sensor_msgs::msg::PointField::FLOAT32,
+    "z", 1, sensor_msgs::msg::PointField::FLOAT32, "intensity", 1,
+    sensor_msgs::msg::PointField::FLOAT32);
+  modifier.resize(points.size());
+  sensor_msgs::PointCloud2Iterator<float> iter_x(cloud, "x");
+  sensor_msgs::PointCloud2Iterator<float> iter_y(cloud, "y");
+  sensor_msgs::PointCloud2Iterator<float> iter_z(cloud, "z");
+  sensor_msgs::PointCloud2Iterator<float> iter_intensity(cloud, "intensity");
+  for (size_t i = 0; i < points.size(); ++i, ++iter_x, ++iter_y, ++iter_z, ++iter_intensity) {
+    *iter_x = points[i].x;
+    *iter_y = points[i].y;
+    *iter_z = points[i].z;
+    *iter_intensity = static_cast<float>(i);
+  }
+  return cloud;
+}
+
+class GroundFilterNodeTest : public ::testing::Test
+{
+protected:
+  void SetUp() override { rclcpp::init(0, nullptr); }
+  void TearDown() override { rclcpp::shutdown(); }
+
+  void setUpNodes(const bool has_static_tf_only)
+  {
+    target_node_ = generateNode(has_static_tf_only);
+    test_node_ = std::make_shared<rclcpp::Node>("ground_filter_test_node");
+    static_tf_broadcaster_ = std::make_shared<tf2_ros::StaticTransformBroadcaster>(test_node_);
+    tf_broadcaster_ = std::make_shared<tf2_ros::TransformBroadcaster>(test_node_);
+    input_pub_ = test_node_->create_publisher<PointCloud2>("input", rclcpp::SensorDataQoS());
+    output_sub_ = test_node_->create_subscription<PointCloud2>(
+      "output", rclcpp::SensorDataQoS(),
+      [this](const PointCloud2::ConstSharedPtr msg) { output_ = msg; });
+    executor_.add_node(target_node_);
+    executor_.add_node(test_node_);
+    spinUntil([this]() {
+      return input_pub_->get_subscription_count() > 0 && output_sub_->get_publisher_count() > 0;
+    });
+  }
+
+  bool spinUntil(const std::function<bool()> & condition)
+  {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!condition() && std::chrono::steady_clock::now() < deadline) {
+      executor_.spin_some(std::chrono::milliseconds(10));
+    }
+    return condition();
+  }
+
+  // publish the pointcloud after the transform is received, and wait for the output
+  PointCloud2::ConstSharedPtr filter(const PointCloud2 & cloud)
+  {
+    const auto tf_wait_end = std::chrono::steady_clock::now() + std::chrono::milliseconds(200);
+    spinUntil([&tf_wait_end]() { return std::chrono::steady_clock::now() > tf_wait_end; });
+    output_.reset();
+    input_pub_->publish(cloud);
+    spinUntil([this]() { return output_ != nullptr; });
+    return output_;
+  }
+
+  // the output points are the obstacle points in the output frame
+  static void expectTransformedObstacles(
+    const PointCloud2 & input, const PointCloud2 & output, const std::set<int> & obstacle_ids,
+    const geometry_msgs::msg::TransformStamped & transform)
+  {
+    EXPECT_EQ(output.header.frame_id, output_frame);
+    EXPECT_EQ(output.header.stamp, input.header.stamp);
+    ASSERT_EQ(output.fields.size(), input.fields.size());
+    ASSERT_EQ(output.point_step, input.point_step);
+
+    std::vector<Eigen::Vector3d> input_points;
+    for (sensor_msgs::PointCloud2ConstIterator<float> iter(input, "x"); iter != iter.end();
+         ++iter) {
+      input_points.emplace_back(iter[0], iter[1], iter[2]);
+    }
+
+    const Eigen::Isometry3d output_from_sensor = tf2::transformToEigen(transform);
+    std::set<int> output_ids;
+    sensor_msgs::PointCloud2ConstIterator<float> iter_x(output, "x");
+    sensor_msgs::PointCloud2ConstIterator<float> iter_intensity(output, "intensity");
+    for (; iter_x != iter_x.end(); ++iter_x, ++iter_intensity) {
+      const int id = static_cast<int>(*iter_intensity);
+      ASSERT_GE(id, 0);
+      ASSERT_LT(static_cast<size_t>(id), input_points.size());
+      output_ids.insert(id);
+
+      const Eigen::Vector3d expected = output_from_sensor * input_points[id];
+      EXPECT_NEAR(iter_x[0], expected.x(), 1e-4) << "point " << id;
+      EXPECT_NEAR(iter_x[1], expected.y(), 1e-4) << "point " << id;
+      EXPECT_NEAR(iter_x[2], expected.z(), 1e-4) << "point " << id;
+    }
+    EXPECT_EQ(output_ids, obstacle_ids);
+  }
+
+  std::shared_ptr<GroundFilterComponent> target_node_;
+  rclcpp::Node::SharedPtr test_node_;
+  std::shared_ptr<tf2_ros::StaticTransformBroadcaster> static_tf_broadcaster_;
+  std::shared_ptr<tf2_ros::TransformBroadcaster> tf_broadcaster_;
+  rclcpp::Publisher<PointCloud2>::SharedPtr input_pub_;
+  rclcpp::Subscription<PointCloud2>::SharedPtr output_sub_;
+  PointCloud2::ConstSharedPtr output_;
+  rclcpp::executors::SingleThreadedExecutor executor_;
+};
+}  // namespace
+
+TEST_F(GroundFilterNodeTest, OutputInOutputFrameWithStaticTf)
+{
+  setUpNodes(true);
+
+  const auto stamp = test_node_->now();
+  const auto transform = createTransform(stamp, 1.0, 0.5);
+  static_tf_broadcaster_->sendTransform(transform);
+
+  std::set<int> obstacle_ids;
+  const auto cloud = createPointCloud(stamp, obstacle_ids);
+  const auto output = filter(cloud);
+  ASSERT_NE(output, nullptr);
+  expectTransformedObstacles(cloud, *output, obstacle_ids, transform);
+}
+
+// the transform to the output frame is looked up for every pointcloud unless it is static
+TEST_F(GroundFilterNodeTest, OutputFollowsDynamicTf)
+{
+  setUpNodes(false);
+
+  std::set<int> obstacle_ids;
+  const auto first_stamp = test_node_->now();
+  const auto first_transform = createTransform(first_stamp, 1.0, 0.5);
+  tf_broadcaster_->sendTransform(first_transform);
+  const auto first_cloud = createPointCloud(first_stamp, obstacle_ids);
+  const auto first_output = filter(first_cloud);
+  ASSERT_NE(first_output, nullptr);
+  expectTransformedObstacles(first_cloud, *first_output, obstacle_ids, first_transform);
+
+  const auto second_stamp = first_stamp + rclcpp::Duration::from_seconds(0.1);
+  const auto second_transform = createTransform(second_stamp, 3.0, -0.5);
+  tf_broadcaster_->sendTransform(second_transform);
+  const auto second_cloud = createPointCloud(second_stamp, obstacle_ids);
+  const auto second_output = filter(second_cloud);
+  ASSERT_NE(second_output, nullptr);
+  expectTransformedObstacles(second_cloud, *second_output, obstacle_ids, second_transform);
+}
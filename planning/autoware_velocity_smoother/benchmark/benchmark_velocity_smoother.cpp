@@ -0,0 +1,285 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks of the smoothers on synthetic trajectories. The smoothers are created from the
+// parameter files of this package on a node which is never spun, so no other node is needed.
+// The "allocations" counter is the number of calls of operator new per iteration, and the
+// "qp_iterations" counter is the number of the QP iterations per apply().
+
+#include "autoware/velocity_smoother/smoother/analytical_jerk_constrained_smoother/analytical_jerk_constrained_smoother.hpp"
+#include "autoware/velocity_smoother/smoother/jerk_filtered_smoother.hpp"
+#include "autoware/velocity_smoother/smoother/l2_pseudo_jerk_smoother.hpp"
+#include "autoware/velocity_smoother/smoother/linf_pseudo_jerk_smoother.hpp"
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <autoware_utils_geometry/geometry.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace
+{
+std::atomic<size_t> allocation_count{0};
+}  // namespace
+
+// not inlined, since GCC warns about the mismatched malloc() and operator delete otherwise
+[[gnu::noinline]] void * operator new(std::size_t size)
+{
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void * ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+[[gnu::noinline]] void operator delete(void * ptr) noexcept
+{
+  std::free(ptr);
+}
+
+[[gnu::noinline]] void operator delete(void * ptr, [[maybe_unused]] std::size_t size) noexcept
+{
+  std::free(ptr);
+}
+
+namespace
+{
+using autoware::velocity_smoother::AnalyticalJerkConstrainedSmoother;
+using autoware::velocity_smoother::JerkFilteredSmoother;
+using autoware::velocity_smoother::L2PseudoJerkSmoother;
+using autoware::velocity_smoother::LinfPseudoJerkSmoother;
+using autoware::velocity_smoother::TrajectoryPoint;
+using autoware::velocity_smoother::TrajectoryPoints;
+
+constexpr double wheel_base = 2.79;
+const std::vector<int64_t> trajectory_sizes = {50, 100, 200, 500, 1000, 2000};
+
+enum class Scenario { STRAIGHT, CURVY, STOP_IN_MIDDLE, LONG_HORIZON };
+
+const std::map<Scenario, std::string> scenario_names = {
+  {Scenario::STRAIGHT, "straight"},
+  {Scenario::CURVY, "curvy"},
+  {Scenario::STOP_IN_MIDDLE, "stop_in_middle"},
+  {Scenario::LONG_HORIZON, "long_horizon"},
+};
+
+/**
+ * @brief generate a deterministic trajectory by integrating the curvature of the scenario
+ */
+TrajectoryPoints generateTrajectory(const Scenario scenario, const size_t num_points)
+{
+  const double interval = scenario == Scenario::LONG_HORIZON ? 2.0 : 1.0;
+  const double velocity = scenario == Scenario::LONG_HORIZON ? 20.0 : 10.0;
+  const auto calc_curvature = [&](const double s) {
+    switch (scenario) {
+      case Scenario::CURVY:
+        return 0.05 * std::sin(2.0 * M_PI * s / 100.0);
+      case Scenario::LONG_HORIZON:
+        return 0.005 * std::sin(2.0 * M_PI * s / 500.0);
+      default:
+        return 0.0;
+    }
+  };
+
+  TrajectoryPoints points;
+  points.reserve(num_points);
+  double x = 0.0;
+  double y = 0.0;
+  double yaw = 0.0;
+  for (size_t i = 0; i < num_points; ++i) {
+    TrajectoryPoint p;
+    p.pose.position.x = x;
+    p.pose.position.y = y;
+    p.pose.orientation = autoware_utils_geometry::create_quaternion_from_yaw(yaw);
+    const bool is_after_stop = scenario == Scenario::STOP_IN_MIDDLE && num_points / 2 <= i;
+    p.longitudinal_velocity_mps = is_after_stop ? 0.0 : velocity;
+    points.push_back(p);
+
+    x += interval * std::cos(yaw);
+    y += interval * std::sin(yaw);
+    yaw += interval * calc_curvature(i * interval);
+  }
+  return points;
+}
+
+template <class SmootherT>
+struct SmootherTraits;
+
+template <>
+struct SmootherTraits<JerkFilteredSmoother>
+{
+  static constexpr const char * name = "JerkFiltered";
+};
+
+template <>
+struct SmootherTraits<L2PseudoJerkSmoother>
+{
+  static constexpr const char * name = "L2";
+};
+
+template <>
+struct SmootherTraits<LinfPseudoJerkSmoother>
+{
+  static constexpr const char * name = "Linf";
+};
+
+template <>
+struct SmootherTraits<AnalyticalJerkConstrainedSmoother>
+{
+  static constexpr const char * name = "Analytical";
+};
+
+/**
+ * @brief create the smoother once with the default parameters. The node only holds the parameters.
+ */
+template <class SmootherT>
+SmootherT & getSmoother()
+{
+  static const auto smoother = []() {
+    if (!rclcpp::ok()) {
+      rclcpp::init(0, nullptr);
+    }
+    const std::string name = SmootherTraits<SmootherT>::name;
+    const auto config_dir =
+      ament_index_cpp::get_package_share_directory("autoware_velocity_smoother") + "/config/";
+    rclcpp::NodeOptions node_options;
+    node_options.arguments(
+      {"--ros-args", "--params-file", config_dir + "default_velocity_smoother.param.yaml",
+       "--params-file", config_dir + "default_common.param.yaml", "--params-file",
+       config_dir + name + ".param.yaml"});
+
+    static std::vector<std::shared_ptr<rclcpp::Node>> nodes;
+    nodes.push_back(std::make_shared<rclcpp::Node>("benchmark_" + name, node_options));
+    auto smoother = std::make_shared<SmootherT>(
+      *nodes.back(), std::make_shared<autoware_utils_debug::TimeKeeper>());
+    smoother->setWheelBase(wheel_base);
+    return smoother;
+  }();
+  return *smoother;
+}
+
+void setAllocationCounter(benchmark::State & state, const size_t allocation_count_before)
+{
+  state.counters["allocations"] = benchmark::Counter(
+    static_cast<double>(allocation_count.load() - allocation_count_before),
+    benchmark::Counter::kAvgIterations);
+}
+
+template <class SmootherT>
+void benchmarkApply(benchmark::State & state, const Scenario scenario)
+{
+  auto & smoother = getSmoother<SmootherT>();
+  const auto input = generateTrajectory(scenario, state.range(0));
+  const double v0 = input.front().longitudinal_velocity_mps;
+
+  TrajectoryPoints output;
+  std::vector<TrajectoryPoints> debug_trajectories;
+  double qp_iterations = 0.0;
+  const size_t allocation_count_before = allocation_count.load();
+  for (auto _ : state) {
+    if (!smoother.apply(v0, 0.0, input, output, debug_trajectories, false)) {
+      state.SkipWithError("apply() failed");
+      break;
+    }
+    qp_iterations += smoother.getQPIterationNumber();
+    benchmark::DoNotOptimize(output.data());
+  }
+  setAllocationCounter(state, allocation_count_before);
+  state.counters["qp_iterations"] =
+    benchmark::Counter(qp_iterations, benchmark::Counter::kAvgIterations);
+}
+
+template <class SmootherT>
+void benchmarkLateralAccelerationFilter(benchmark::State & state, const Scenario scenario)
+{
+  const auto & smoother = getSmoother<SmootherT>();
+  const auto input = generateTrajectory(scenario, state.range(0));
+  const double v0 = input.front().longitudinal_velocity_mps;
+
+  const size_t allocation_count_before = allocation_count.load();
+  for (auto _ : state) {
+    const auto output = smoother.applyLateralAccelerationFilter(input, v0, 0.0, true, true);
+    benchmark::DoNotOptimize(output.data());
+  }
+  setAllocationCounter(state, allocation_count_before);
+}
+
+template <class SmootherT>
+void benchmarkSteeringRateLimit(benchmark::State & state, const Scenario scenario)
+{
+  const auto & smoother = getSmoother<SmootherT>();
+  const auto input = generateTrajectory(scenario, state.range(0));
+
+  const size_t allocation_count_before = allocation_count.load();
+  for (auto _ : state) {
+    const auto output = smoother.applySteeringRateLimit(input, false);
+    benchmark::DoNotOptimize(output.data());
+  }
+  setAllocationCounter(state, allocation_count_before);
+}
+
+template <class SmootherT>
+void benchmarkResampleTrajectory(benchmark::State & state, const Scenario scenario)
+{
+  const auto & smoother = getSmoother<SmootherT>();
+  const auto input = generateTrajectory(scenario, state.range(0));
+  const double v0 = input.front().longitudinal_velocity_mps;
+  const auto current_pose = input.front().pose;
+
+  const size_t allocation_count_before = allocation_count.load();
+  for (auto _ : state) {
+    const auto output = smoother.resampleTrajectory(input, v0, current_pose, 3.0, 1.046);
+    benchmark::DoNotOptimize(output.data());
+  }
+  setAllocationCounter(state, allocation_count_before);
+}
+
+template <class SmootherT>
+void registerBenchmarks()
+{
+  const std::string smoother_name = SmootherTraits<SmootherT>::name;
+  for (const auto & [scenario, scenario_name] : scenario_names) {
+    const auto suffix = "/" + smoother_name + "/" + scenario_name;
+    const auto register_benchmark = [&](const std::string & name, auto func) {
+      auto * registered = benchmark::RegisterBenchmark((name + suffix).c_str(), func, scenario);
+      registered->ArgName("N")->Unit(benchmark::kMicrosecond);
+      for (const auto size : trajectory_sizes) {
+        registered->Arg(size);
+      }
+    };
+    register_benchmark("apply", benchmarkApply<SmootherT>);
+    register_benchmark(
+      "applyLateralAccelerationFilter", benchmarkLateralAccelerationFilter<SmootherT>);
+    register_benchmark("applySteeringRateLimit", benchmarkSteeringRateLimit<SmootherT>);
+    register_benchmark("resampleTrajectory", benchmarkResampleTrajectory<SmootherT>);
+  }
+}
+
+[[maybe_unused]] const bool is_registered = []() {
+  registerBenchmarks<JerkFilteredSmoother>();
+  registerBenchmarks<L2PseudoJerkSmoother>();
+  registerBenchmarks<LinfPseudoJerkSmoother>();
+  registerBenchmarks<AnalyticalJerkConstrainedSmoother>();
+  return true;
+}();
+}  // namespace
@@ -0,0 +1,69 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__VELOCITY_SMOOTHER__DEFERRED_DEBUG_PUBLISHER_HPP_
+#define AUTOWARE__VELOCITY_SMOOTHER__DEFERRED_DEBUG_PUBLISHER_HPP_
+
+#include "rclcpp/rclcpp.hpp"
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace autoware::velocity_smoother
+{
+/**
+ * @brief run the conversion and the publication of debug messages on a low priority worker thread
+ * @details The main thread only records snapshots of the debug data and enqueues a job. A job which
+ * has not started yet is replaced by a newer job with the same key, so a slow worker skips stale
+ * debug data instead of accumulating it. The jobs must not access the mutable state of the caller.
+ */
+class DeferredDebugPublisher
+{
+public:
+  using Job = std::function<void()>;
+
+  DeferredDebugPublisher();
+  ~DeferredDebugPublisher();
+
+  DeferredDebugPublisher(const DeferredDebugPublisher &) = delete;
+  DeferredDebugPublisher & operator=(const DeferredDebugPublisher &) = delete;
+
+  /// @brief enqueue a job. The key identifies the debug data, e.g. a publisher.
+  void enqueue(const void * key, Job job);
+
+  template <class PublisherT>
+  static bool hasSubscribers(const std::shared_ptr<PublisherT> & publisher)
+  {
+    return publisher &&
+           publisher->get_subscription_count() + publisher->get_intra_process_subscription_count() >
+             0;
+  }
+
+private:
+  std::mutex mutex_;
+  std::condition_variable job_cv_;
+  std::vector<std::pair<const void *, Job>> jobs_;
+  bool stop_{false};
+  std::thread worker_;
+
+  void run();
+};
+}  // namespace autoware::velocity_smoother
+
+#endif  // AUTOWARE__VELOCITY_SMOOTHER__DEFERRED_DEBUG_PUBLISHER_HPP_
@@ -0,0 +1,59 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__VELOCITY_SMOOTHER__INPUT_FINGERPRINT_HPP_
+#define AUTOWARE__VELOCITY_SMOOTHER__INPUT_FINGERPRINT_HPP_
+
+#include "autoware_planning_msgs/msg/trajectory_point.hpp"
+#include "geometry_msgs/msg/pose.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace autoware::velocity_smoother
+{
+using autoware_planning_msgs::msg::TrajectoryPoint;
+using TrajectoryPoints = std::vector<TrajectoryPoint>;
+
+/**
+ * @brief 64 bit FNV-1a hash of the inputs of a planning cycle
+ * @details The values are hashed by their bit pattern: the same inputs give the same fingerprint,
+ * and any change of an input, however small, gives another one (except for hash collisions).
+ */
+class InputFingerprint
+{
+public:
+  template <class T, std::enable_if_t<std::is_arithmetic_v<T>, std::nullptr_t> = nullptr>
+  InputFingerprint & add(const T value)
+  {
+    addBytes(&value, sizeof(T));
+    return *this;
+  }
+
+  InputFingerprint & add(const geometry_msgs::msg::Pose & pose);
+  InputFingerprint & add(const TrajectoryPoint & point);
+  InputFingerprint & add(const TrajectoryPoints & points);
+
+  uint64_t value() const { return hash_; }
+
+private:
+  uint64_t hash_{14695981039346656037ULL};
+
+  void addBytes(const void * data, const size_t size);
+};
+}  // namespace autoware::velocity_smoother
+
+#endif  // AUTOWARE__VELOCITY_SMOOTHER__INPUT_FINGERPRINT_HPP_
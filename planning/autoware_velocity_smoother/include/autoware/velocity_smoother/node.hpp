@@ -18,6 +18,8 @@
 #include "autoware/motion_utils/trajectory/conversion.hpp"
 #include "autoware/motion_utils/trajectory/trajectory.hpp"
 #include "autoware/osqp_interface/osqp_interface.hpp"
+#include "autoware/velocity_smoother/deferred_debug_publisher.hpp"
+#include "autoware/velocity_smoother/input_fingerprint.hpp"
 #include "autoware/velocity_smoother/resample.hpp"
 #include "autoware/velocity_smoother/smoother/analytical_jerk_constrained_smoother/analytical_jerk_constrained_smoother.hpp"
 #include "autoware/velocity_smoother/smoother/jerk_filtered_smoother.hpp"
@@ -49,6 +51,7 @@
 
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -159,8 +162,50 @@ private:
     AlgorithmType algorithm_type;  // Option : JerkFiltered, Linf, L2
 
     bool plan_from_ego_speed_on_manual_mode = true;
+    bool enable_result_reuse = true;  // reuse or warm start from the previous result
   } node_param_{};
 
+  // incremented on every parameter update, since the parameters are inputs of the planning
+  size_t parameter_version_{0};
+
+  // outputs of calcTrajectoryVelocity() for the debug topics. They are published after the
+  // planning, so that they are published from the cache as well when the result is reused.
+  struct DebugOutputs
+  {
+    std::optional<Pose> virtual_wall_pose;
+    std::optional<float> closest_max_velocity;
+    std::vector<std::pair<rclcpp::Publisher<Trajectory>::SharedPtr, TrajectoryPoints>>
+      trajectories;
+    // inputs of publishDebugTrajectories(), recorded only when the topics have subscribers
+    bool has_jerk_filtered_trajectories{false};
+    std::vector<TrajectoryPoints> jerk_filtered_trajectories;
+    TrajectoryPoints behind_points;
+    double v0{0.0};
+  };
+
+  // previous result and the fingerprints of its inputs
+  struct ResultCache
+  {
+    bool is_valid{false};
+    uint64_t input_hash{0};  // input trajectory, velocity limits and parameters
+    uint64_t ego_hash{0};    // ego state and previous output
+    TrajectoryPoints output;
+    std::optional<bool> is_stop_velocity_exceeded;
+    DebugOutputs debug_outputs;
+  } result_cache_{};
+
+  struct ResultReuseStatistics
+  {
+    size_t reused{0};        // the previous result is reused as is
+    size_t warm_started{0};  // the optimization is a correction of the previous result
+    size_t computed{0};      // the optimization is solved from scratch
+  } result_reuse_statistics_{};
+
+  // set by overwriteStopPoint to be cached with the result
+  mutable std::optional<bool> is_stop_velocity_exceeded_{std::nullopt};
+  // recorded by calcTrajectoryVelocity to be cached with the result
+  mutable DebugOutputs debug_outputs_{};
+
   struct AccelerationRequest
   {
     bool request{false};
@@ -197,6 +242,9 @@ private:
 
   void calcExternalVelocityLimit();
 
+  // fingerprints of the inputs of calcTrajectoryVelocity: (input hash, ego hash)
+  std::pair<uint64_t, uint64_t> calcInputFingerprint(const TrajectoryPoints & input_points) const;
+
   // publish methods
   void publishTrajectory(const TrajectoryPoints & traj) const;
 
@@ -236,11 +284,24 @@ private:
 
   bool isEngageStatus(const double target_vel) const;
 
-  void publishDebugTrajectories(const std::vector<TrajectoryPoints> & debug_trajectories) const;
+  /// @brief record the debug trajectory to be published by publishDebugOutputs()
+  void recordDebugTrajectory(
+    const rclcpp::Publisher<Trajectory>::SharedPtr & pub, const TrajectoryPoints & points) const;
+
+  /// @brief whether the smoother has to record the jerk filtered trajectories
+  bool isJerkFilteredDebugRequested() const;
 
-  void publishClosestVelocity(
-    const TrajectoryPoints & trajectory, const Pose & current_pose,
-    const rclcpp::Publisher<Float32Stamped>::SharedPtr pub) const;
+  /// @brief publish the virtual wall and the debug topics of the planning
+  void publishDebugOutputs(const DebugOutputs & debug_outputs) const;
+
+  /// @brief enqueue the debug trajectory to the worker only when the topic has subscribers
+  void publishDebugTrajectory(
+    const rclcpp::Publisher<Trajectory>::SharedPtr & pub, const TrajectoryPoints & points) const;
+
+  /// @brief resample and publish the jerk filtered trajectories on the worker
+  void publishDebugTrajectories(
+    std::vector<TrajectoryPoints> debug_trajectories, TrajectoryPoints behind_points,
+    const double v0) const;
 
   Trajectory toTrajectoryMsg(
     const TrajectoryPoints & points, const std_msgs::msg::Header * header = nullptr) const;
@@ -267,6 +328,8 @@ private:
   rclcpp::Publisher<Float32Stamped>::SharedPtr debug_closest_acc_;
   rclcpp::Publisher<Float32Stamped>::SharedPtr debug_closest_jerk_;
   rclcpp::Publisher<Float64Stamped>::SharedPtr debug_calculation_time_;
+  rclcpp::Publisher<Float64Stamped>::SharedPtr debug_result_reuse_ratio_;
+  rclcpp::Publisher<Float64Stamped>::SharedPtr debug_warm_start_ratio_;
   rclcpp::Publisher<Float32Stamped>::SharedPtr debug_closest_max_velocity_;
   rclcpp::Publisher<autoware_utils_debug::ProcessingTimeDetail>::SharedPtr
     debug_processing_time_detail_;
@@ -289,6 +352,9 @@ private:
   mutable std::shared_ptr<autoware_utils_debug::TimeKeeper> time_keeper_{nullptr};
 
   std::unique_ptr<DiagnosticsInterface> diagnostics_interface_{nullptr};
+
+  // declared last to be destroyed first, since the jobs use the publishers
+  std::unique_ptr<DeferredDebugPublisher> debug_publisher_{nullptr};
 };
 }  // namespace autoware::velocity_smoother
 
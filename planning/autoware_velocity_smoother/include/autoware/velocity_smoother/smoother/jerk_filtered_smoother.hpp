@@ -56,6 +56,17 @@ public:
     const geometry_msgs::msg::Pose & current_pose, const double nearest_dist_threshold,
     const double nearest_yaw_threshold) const override;
 
+  void setWarmStartProfile(const TrajectoryPoints & profile) override;
+  bool isWarmStarted() const override;
+
+  /**
+   * @brief resample a debug trajectory given by apply() in the same way as the trajectory to
+   * optimize. It only depends on the arguments, so it can be called from another thread.
+   */
+  static TrajectoryPoints resampleDebugTrajectory(
+    const TrajectoryPoints & debug_trajectory, const double v0,
+    const resampling::ResampleParam & resample_param);
+
   void setParam(const Param & param);
   Param getParam() const;
 
@@ -64,6 +75,10 @@ private:
   std::shared_ptr<autoware::qp_interface::QPInterface> qp_interface_;
   rclcpp::Logger logger_{rclcpp::get_logger("smoother").get_child("jerk_filtered_smoother")};
 
+  // profile to start the next optimization from, and if the last optimization converged from it
+  TrajectoryPoints warm_start_profile_;
+  bool is_warm_started_{false};
+
   TrajectoryPoints forwardJerkFilter(
     const double v0, const double a0, const double a_max, const double a_stop, const double j_max,
     const TrajectoryPoints & input) const;
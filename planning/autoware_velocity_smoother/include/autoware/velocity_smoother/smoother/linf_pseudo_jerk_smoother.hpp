@@ -17,6 +17,7 @@
 
 #include "autoware/motion_utils/trajectory/trajectory.hpp"
 #include "autoware/osqp_interface/osqp_interface.hpp"
+#include "autoware/qp_interface/banded_admm_interface.hpp"
 #include "autoware/velocity_smoother/smoother/smoother_base.hpp"
 
 #include <autoware_utils_debug/time_keeper.hpp>
@@ -38,6 +39,7 @@ public:
     double pseudo_jerk_weight;
     double over_v_weight;
     double over_a_weight;
+    QPSolverType qp_solver_type;
   };
 
   explicit LinfPseudoJerkSmoother(
@@ -58,6 +60,7 @@ public:
 private:
   Param smoother_param_;
   autoware::osqp_interface::OSQPInterface qp_solver_;
+  autoware::qp_interface::BandedADMMInterface banded_qp_solver_;
   rclcpp::Logger logger_{rclcpp::get_logger("smoother").get_child("linf_pseudo_jerk_smoother")};
 };
 }  // namespace autoware::velocity_smoother
@@ -24,6 +24,7 @@
 
 #include <limits>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace autoware::velocity_smoother
@@ -31,6 +32,14 @@ namespace autoware::velocity_smoother
 using autoware_planning_msgs::msg::TrajectoryPoint;
 using TrajectoryPoints = std::vector<TrajectoryPoint>;
 
+// QP solver used by the pseudo-jerk smoothers
+enum class QPSolverType {
+  OSQP = 0,
+  BANDED_ADMM = 1,
+};
+
+QPSolverType getQPSolverType(const std::string & solver_name);
+
 class SmootherBase
 {
 public:
@@ -65,6 +74,19 @@ public:
     TrajectoryPoints & output, std::vector<TrajectoryPoints> & debug_trajectories,
     const bool publish_debug_trajs) = 0;
 
+  /**
+   * @brief set the velocity profile from which the next apply() starts the optimization, e.g. the
+   * previous output when the input has not changed. It is used once. The smoothers which do not
+   * support it ignore it.
+   */
+  virtual void setWarmStartProfile([[maybe_unused]] const TrajectoryPoints & profile) {}
+
+  /// @brief true if the last apply() converged from the warm start profile
+  virtual bool isWarmStarted() const { return false; }
+
+  /// @brief total number of the QP iterations in the last apply(), or 0 if no QP was solved
+  int getQPIterationNumber() const { return qp_iteration_number_; }
+
   virtual TrajectoryPoints resampleTrajectory(
     const TrajectoryPoints & input, const double v0, const geometry_msgs::msg::Pose & current_pose,
     const double nearest_dist_threshold, const double nearest_yaw_threshold) const = 0;
@@ -92,6 +114,7 @@ public:
 
 protected:
   BaseParam base_param_;
+  int qp_iteration_number_{0};
   mutable std::shared_ptr<autoware_utils_debug::TimeKeeper> time_keeper_{nullptr};
 };
 }  // namespace autoware::velocity_smoother
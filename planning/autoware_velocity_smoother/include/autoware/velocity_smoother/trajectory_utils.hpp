@@ -43,6 +43,13 @@ std::vector<double> calcTrajectoryIntervalDistance(const TrajectoryPoints & traj
 std::vector<double> calcTrajectoryCurvatureFrom3Points(
   const TrajectoryPoints & trajectory, size_t idx_dist);
 
+/**
+ * @brief calculate the maximum absolute value of the window [i - window_before, i + window_after)
+ * for each index i in O(N) with a monotonic deque. The value of an empty window is zero.
+ */
+std::vector<double> calcSlidingWindowMaxAbs(
+  const std::vector<double> & values, const size_t window_before, const size_t window_after);
+
 void applyMaximumVelocityLimit(
   const size_t from, const size_t to, const double max_vel, TrajectoryPoints & trajectory);
 
@@ -0,0 +1,89 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/velocity_smoother/deferred_debug_publisher.hpp"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+#include <vector>
+
+namespace autoware::velocity_smoother
+{
+DeferredDebugPublisher::DeferredDebugPublisher() : worker_([this]() { run(); })
+{
+#ifdef __linux__
+  // the debug data must not take the CPU from the planning threads
+  sched_param param{};
+  param.sched_priority = 0;
+  pthread_setschedparam(worker_.native_handle(), SCHED_IDLE, &param);
+#endif
+}
+
+DeferredDebugPublisher::~DeferredDebugPublisher()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  job_cv_.notify_all();
+  worker_.join();
+}
+
+void DeferredDebugPublisher::enqueue(const void * key, Job job)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = std::find_if(
+      jobs_.begin(), jobs_.end(), [&](const auto & queued) { return queued.first == key; });
+    if (it != jobs_.end()) {
+      it->second = std::move(job);
+    } else {
+      jobs_.emplace_back(key, std::move(job));
+    }
+  }
+  job_cv_.notify_one();
+}
+
+void DeferredDebugPublisher::run()
+{
+  std::vector<std::pair<const void *, Job>> jobs;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      job_cv_.wait(lock, [this]() { return stop_ || !jobs_.empty(); });
+      if (stop_) {
+        return;
+      }
+      jobs.swap(jobs_);
+    }
+
+    for (auto & job : jobs) {
+      try {
+        job.second();
+      } catch (const std::exception & e) {
+        RCLCPP_WARN(
+          rclcpp::get_logger("velocity_smoother").get_child("deferred_debug_publisher"),
+          "failed to publish the debug data: %s", e.what());
+      }
+    }
+    jobs.clear();
+  }
+}
+}  // namespace autoware::velocity_smoother
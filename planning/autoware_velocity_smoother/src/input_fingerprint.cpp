@@ -0,0 +1,61 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/velocity_smoother/input_fingerprint.hpp"
+
+namespace autoware::velocity_smoother
+{
+InputFingerprint & InputFingerprint::add(const geometry_msgs::msg::Pose & pose)
+{
+  return add(pose.position.x)
+    .add(pose.position.y)
+    .add(pose.position.z)
+    .add(pose.orientation.x)
+    .add(pose.orientation.y)
+    .add(pose.orientation.z)
+    .add(pose.orientation.w);
+}
+
+InputFingerprint & InputFingerprint::add(const TrajectoryPoint & point)
+{
+  return add(point.pose)
+    .add(point.time_from_start.sec)
+    .add(point.time_from_start.nanosec)
+    .add(point.longitudinal_velocity_mps)
+    .add(point.lateral_velocity_mps)
+    .add(point.acceleration_mps2)
+    .add(point.heading_rate_rps)
+    .add(point.front_wheel_angle_rad)
+    .add(point.rear_wheel_angle_rad);
+}
+
+InputFingerprint & InputFingerprint::add(const TrajectoryPoints & points)
+{
+  add(points.size());
+  for (const auto & point : points) {
+    add(point);
+  }
+  return *this;
+}
+
+void InputFingerprint::addBytes(const void * data, const size_t size)
+{
+  constexpr uint64_t prime = 1099511628211ULL;
+  const auto * bytes = static_cast<const unsigned char *>(data);
+  for (size_t i = 0; i < size; ++i) {
+    hash_ ^= bytes[i];
+    hash_ *= prime;
+  }
+}
+}  // namespace autoware::velocity_smoother
@@ -22,6 +22,7 @@
 #include <autoware_vehicle_info_utils/vehicle_info_utils.hpp>
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <limits>
 #include <map>
@@ -76,6 +77,8 @@ VelocitySmootherNode::VelocitySmootherNode(const rclcpp::NodeOptions & node_opti
   debug_closest_jerk_ = create_publisher<Float32Stamped>("~/closest_jerk", 1);
   debug_closest_max_velocity_ = create_publisher<Float32Stamped>("~/closest_max_velocity", 1);
   debug_calculation_time_ = create_publisher<Float64Stamped>("~/debug/processing_time_ms", 1);
+  debug_result_reuse_ratio_ = create_publisher<Float64Stamped>("~/debug/result_reuse_ratio", 1);
+  debug_warm_start_ratio_ = create_publisher<Float64Stamped>("~/debug/warm_start_ratio", 1);
   pub_trajectory_raw_ = create_publisher<Trajectory>("~/debug/trajectory_raw", 1);
   pub_trajectory_vel_lim_ =
     create_publisher<Trajectory>("~/debug/trajectory_external_velocity_limited", 1);
@@ -98,6 +101,7 @@ VelocitySmootherNode::VelocitySmootherNode(const rclcpp::NodeOptions & node_opti
 
   logger_configure_ = std::make_unique<autoware_utils_logging::LoggerLevelConfigure>(this);
   published_time_publisher_ = std::make_unique<autoware_utils_debug::PublishedTimePublisher>(this);
+  debug_publisher_ = std::make_unique<DeferredDebugPublisher>();
 }
 
 void VelocitySmootherNode::setupSmoother(const double wheelbase)
@@ -182,6 +186,7 @@ rcl_interfaces::msg::SetParametersResult VelocitySmootherNode::onParameter(
     update_param("ego_nearest_dist_threshold", p.ego_nearest_dist_threshold);
     update_param("ego_nearest_yaw_threshold", p.ego_nearest_yaw_threshold);
     update_param_bool("plan_from_ego_speed_on_manual_mode", p.plan_from_ego_speed_on_manual_mode);
+    update_param_bool("enable_result_reuse", p.enable_result_reuse);
   }
 
   {
@@ -259,6 +264,8 @@ rcl_interfaces::msg::SetParametersResult VelocitySmootherNode::onParameter(
       throw std::domain_error("[VelocitySmootherNode] invalid algorithm");
   }
 
+  ++parameter_version_;
+
   rcl_interfaces::msg::SetParametersResult result{};
   result.successful = true;
   result.reason = "success";
@@ -301,6 +308,7 @@ void VelocitySmootherNode::initCommonParam()
 
   p.plan_from_ego_speed_on_manual_mode =
     declare_parameter<bool>("plan_from_ego_speed_on_manual_mode");
+  p.enable_result_reuse = declare_parameter<bool>("enable_result_reuse");
 }
 
 void VelocitySmootherNode::publishTrajectory(const TrajectoryPoints & trajectory) const
@@ -487,7 +495,41 @@ void VelocitySmootherNode::onCurrentTrajectory(const Trajectory::ConstSharedPtr
     flipVelocity(input_points);
   }
 
-  const auto output = calcTrajectoryVelocity(input_points);
+  // When the inputs are the same as in the previous cycle, the result is the same. When only the
+  // ego state has changed, the optimization starts from the previous result.
+  const auto [input_hash, ego_hash] = calcInputFingerprint(input_points);
+  const bool is_same_input = node_param_.enable_result_reuse && result_cache_.is_valid &&
+                             input_hash == result_cache_.input_hash;
+  // the jerk filtered debug trajectories are not recorded while nobody subscribes to them
+  const bool is_debug_output_missing = isJerkFilteredDebugRequested() &&
+                                       !result_cache_.debug_outputs.has_jerk_filtered_trajectories;
+  TrajectoryPoints output;
+  if (is_same_input && ego_hash == result_cache_.ego_hash && !is_debug_output_missing) {
+    output = result_cache_.output;
+    if (result_cache_.is_stop_velocity_exceeded) {
+      diagnostics_interface_->add_key_value(
+        "The velocity on the stop point is larger than 0.",
+        *result_cache_.is_stop_velocity_exceeded);
+    }
+    ++result_reuse_statistics_.reused;
+  } else {
+    if (is_same_input && !prev_output_.empty()) {
+      smoother_->setWarmStartProfile(prev_output_);
+    }
+    is_stop_velocity_exceeded_ = std::nullopt;
+    debug_outputs_ = DebugOutputs{};
+    output = calcTrajectoryVelocity(input_points);
+    if (smoother_->isWarmStarted()) {
+      ++result_reuse_statistics_.warm_started;
+    } else {
+      ++result_reuse_statistics_.computed;
+    }
+    // the profile is not used when the optimization is skipped
+    smoother_->setWarmStartProfile({});
+    result_cache_ = {
+      true, input_hash, ego_hash, output, is_stop_velocity_exceeded_, std::move(debug_outputs_)};
+  }
+  publishDebugOutputs(result_cache_.debug_outputs);
   if (output.empty()) {
     RCLCPP_WARN(get_logger(), "Output Point is empty");
     return;
@@ -529,6 +571,32 @@ void VelocitySmootherNode::onCurrentTrajectory(const Trajectory::ConstSharedPtr
   RCLCPP_DEBUG(get_logger(), "========================== run() end ==========================\n\n");
 }
 
+std::pair<uint64_t, uint64_t> VelocitySmootherNode::calcInputFingerprint(
+  const TrajectoryPoints & input_points) const
+{
+  InputFingerprint input_fingerprint;
+  input_fingerprint.add(input_points)
+    .add(is_reverse_)
+    .add(external_velocity_limit_.velocity)
+    .add(external_velocity_limit_.dist)
+    .add(external_velocity_limit_.acceleration_request.request)
+    .add(external_velocity_limit_.acceleration_request.max_acceleration)
+    .add(external_velocity_limit_.acceleration_request.max_jerk)
+    .add(max_velocity_with_deceleration_)
+    .add(operation_mode_.mode)
+    .add(operation_mode_.is_autoware_control_enabled)
+    .add(parameter_version_);
+
+  // the previous output gives the initial motion and the velocity behind ego
+  InputFingerprint ego_fingerprint;
+  ego_fingerprint.add(current_odometry_ptr_->pose.pose)
+    .add(current_odometry_ptr_->twist.twist.linear.x)
+    .add(current_acceleration_ptr_->accel.accel.linear.x)
+    .add(prev_output_);
+
+  return {input_fingerprint.value(), ego_fingerprint.value()};
+}
+
 void VelocitySmootherNode::updateDataForExternalVelocityLimit()
 {
   autoware_utils_debug::ScopedTimeTrack st(__func__, *time_keeper_);
@@ -566,9 +634,7 @@ TrajectoryPoints VelocitySmootherNode::calcTrajectoryVelocity(
 
   // Debug
   if (publish_debug_trajs_) {
-    auto tmp = traj_extracted;
-    if (is_reverse_) flipVelocity(tmp);
-    pub_trajectory_raw_->publish(toTrajectoryMsg(tmp));
+    recordDebugTrajectory(pub_trajectory_raw_, traj_extracted);
   }
 
   // Apply external velocity limit
@@ -582,9 +648,7 @@ TrajectoryPoints VelocitySmootherNode::calcTrajectoryVelocity(
 
   // Debug
   if (publish_debug_trajs_) {
-    auto tmp = traj_extracted;
-    if (is_reverse_) flipVelocity(tmp);
-    pub_trajectory_vel_lim_->publish(toTrajectoryMsg(traj_extracted));
+    recordDebugTrajectory(pub_trajectory_vel_lim_, traj_extracted);
   }
 
   // Smoothing velocity
@@ -636,9 +700,11 @@ bool VelocitySmootherNode::smoothVelocity(
     traj_resampled.back().longitudinal_velocity_mps = 0.0;
   }
 
-  // Publish Closest Resample Trajectory Velocity
-  publishClosestVelocity(
-    traj_resampled, current_odometry_ptr_->pose.pose, debug_closest_max_velocity_);
+  // Closest Resample Trajectory Velocity
+  debug_outputs_.closest_max_velocity = std::max(
+    calcProjectedTrajectoryPoint(traj_resampled, current_odometry_ptr_->pose.pose)
+      .longitudinal_velocity_mps,
+    0.0f);
 
   // Clip trajectory from closest point
   TrajectoryPoints clipped;
@@ -657,10 +723,12 @@ bool VelocitySmootherNode::smoothVelocity(
   smoother_->setMaxAccel(smoother_max_acceleration);
   smoother_->setMaxJerk(smoother_max_jerk);
 
+  // the smoother only records the debug trajectories when they are published
+  const bool record_debug_trajs = isJerkFilteredDebugRequested();
   std::vector<TrajectoryPoints> debug_trajectories;
   if (!smoother_->apply(
         initial_motion.vel, initial_motion.acc, clipped, traj_smoothed, debug_trajectories,
-        publish_debug_trajs_)) {
+        record_debug_trajs)) {
     RCLCPP_WARN(get_logger(), "Fail to solve optimization.");
   }
 
@@ -684,32 +752,16 @@ bool VelocitySmootherNode::smoothVelocity(
 
   RCLCPP_DEBUG(get_logger(), "smoothVelocity : traj_smoothed.size() = %lu", traj_smoothed.size());
   if (publish_debug_trajs_) {
-    {
-      auto tmp = traj_lateral_acc_filtered;
-      if (is_reverse_) flipVelocity(tmp);
-      pub_trajectory_latacc_filtered_->publish(toTrajectoryMsg(tmp));
-    }
-    {
-      auto tmp = traj_resampled;
-      if (is_reverse_) flipVelocity(tmp);
-      pub_trajectory_resampled_->publish(toTrajectoryMsg(tmp));
-    }
-    {
-      auto tmp = traj_steering_rate_limited;
-      if (is_reverse_) flipVelocity(tmp);
-      pub_trajectory_steering_rate_limited_->publish(toTrajectoryMsg(tmp));
-    }
-
-    for (auto & debug_trajectory : debug_trajectories) {
-      debug_trajectory.insert(
-        debug_trajectory.begin(), traj_resampled.begin(),
-        traj_resampled.begin() + traj_resampled_closest);
-      for (size_t i = 0; i < traj_resampled_closest; ++i) {
-        debug_trajectory.at(i).longitudinal_velocity_mps =
-          debug_trajectory.at(traj_resampled_closest).longitudinal_velocity_mps;
-      }
+    recordDebugTrajectory(pub_trajectory_latacc_filtered_, traj_lateral_acc_filtered);
+    recordDebugTrajectory(pub_trajectory_resampled_, traj_resampled);
+    recordDebugTrajectory(pub_trajectory_steering_rate_limited_, traj_steering_rate_limited);
+    if (record_debug_trajs) {
+      debug_outputs_.has_jerk_filtered_trajectories = true;
+      debug_outputs_.jerk_filtered_trajectories = std::move(debug_trajectories);
+      debug_outputs_.behind_points =
+        TrajectoryPoints(traj_resampled.begin(), traj_resampled.begin() + traj_resampled_closest);
+      debug_outputs_.v0 = initial_motion.vel;
     }
-    publishDebugTrajectories(debug_trajectories);
   }
 
   return true;
@@ -908,6 +960,7 @@ void VelocitySmootherNode::overwriteStopPoint(
       input_stop_vel, output_stop_vel, over_stop_velocity_warn_thr_);
   }
 
+  is_stop_velocity_exceeded_ = is_stop_velocity_exceeded;
   diagnostics_interface_->add_key_value(
     "The velocity on the stop point is larger than 0.", is_stop_velocity_exceeded);
 }
@@ -943,10 +996,7 @@ void VelocitySmootherNode::applyExternalVelocityLimit(TrajectoryPoints & traj) c
 
   // create virtual wall
   if (std::abs(external_velocity_limit_.velocity) < 1e-3) {
-    const auto virtual_wall_marker = autoware::motion_utils::createStopVirtualWallMarker(
-      traj.at(*inserted_index).pose, external_velocity_limit_.sender, this->now(), 0,
-      base_link2front_);
-    pub_virtual_wall_->publish(virtual_wall_marker);
+    debug_outputs_.virtual_wall_pose = traj.at(*inserted_index).pose;
   }
 
   RCLCPP_DEBUG(
@@ -973,38 +1023,121 @@ void VelocitySmootherNode::applyStopApproachingVelocity(TrajectoryPoints & traj)
   }
 }
 
-void VelocitySmootherNode::publishDebugTrajectories(
-  const std::vector<TrajectoryPoints> & debug_trajectories) const
+void VelocitySmootherNode::recordDebugTrajectory(
+  const rclcpp::Publisher<Trajectory>::SharedPtr & pub, const TrajectoryPoints & points) const
 {
-  auto debug_trajectories_tmp = debug_trajectories;
-  if (node_param_.algorithm_type == AlgorithmType::JERK_FILTERED) {
-    if (debug_trajectories_tmp.size() != 3) {
-      RCLCPP_DEBUG(get_logger(), "Size of the debug trajectories is incorrect");
-      return;
-    }
-    if (is_reverse_) {
-      flipVelocity(debug_trajectories_tmp.at(0));
-      flipVelocity(debug_trajectories_tmp.at(1));
-      flipVelocity(debug_trajectories_tmp.at(2));
-    }
-    pub_forward_filtered_trajectory_->publish(toTrajectoryMsg(debug_trajectories_tmp.at(0)));
-    pub_backward_filtered_trajectory_->publish(toTrajectoryMsg(debug_trajectories_tmp.at(1)));
-    pub_merged_filtered_trajectory_->publish(toTrajectoryMsg(debug_trajectories_tmp.at(2)));
-    publishClosestVelocity(
-      debug_trajectories_tmp.at(2), current_odometry_ptr_->pose.pose, pub_closest_merged_velocity_);
+  // recorded even without subscribers, since they may subscribe while the result is reused
+  debug_outputs_.trajectories.emplace_back(pub, points);
+}
+
+bool VelocitySmootherNode::isJerkFilteredDebugRequested() const
+{
+  return publish_debug_trajs_ &&
+         (DeferredDebugPublisher::hasSubscribers(pub_forward_filtered_trajectory_) ||
+          DeferredDebugPublisher::hasSubscribers(pub_backward_filtered_trajectory_) ||
+          DeferredDebugPublisher::hasSubscribers(pub_merged_filtered_trajectory_) ||
+          DeferredDebugPublisher::hasSubscribers(pub_closest_merged_velocity_));
+}
+
+void VelocitySmootherNode::publishDebugOutputs(const DebugOutputs & debug_outputs) const
+{
+  if (debug_outputs.virtual_wall_pose) {
+    pub_virtual_wall_->publish(autoware::motion_utils::createStopVirtualWallMarker(
+      *debug_outputs.virtual_wall_pose, external_velocity_limit_.sender, this->now(), 0,
+      base_link2front_));
+  }
+
+  if (debug_outputs.closest_max_velocity) {
+    Float32Stamped vel_data{};
+    vel_data.stamp = this->now();
+    vel_data.data = *debug_outputs.closest_max_velocity;
+    debug_closest_max_velocity_->publish(vel_data);
+  }
+
+  for (const auto & [pub, points] : debug_outputs.trajectories) {
+    publishDebugTrajectory(pub, points);
+  }
+  if (debug_outputs.has_jerk_filtered_trajectories && isJerkFilteredDebugRequested()) {
+    publishDebugTrajectories(
+      debug_outputs.jerk_filtered_trajectories, debug_outputs.behind_points, debug_outputs.v0);
   }
 }
 
-void VelocitySmootherNode::publishClosestVelocity(
-  const TrajectoryPoints & trajectory, const Pose & current_pose,
-  const rclcpp::Publisher<Float32Stamped>::SharedPtr pub) const
+void VelocitySmootherNode::publishDebugTrajectory(
+  const rclcpp::Publisher<Trajectory>::SharedPtr & pub, const TrajectoryPoints & points) const
 {
-  const auto closest_point = calcProjectedTrajectoryPoint(trajectory, current_pose);
+  if (!DeferredDebugPublisher::hasSubscribers(pub)) {
+    return;
+  }
 
-  Float32Stamped vel_data{};
-  vel_data.stamp = this->now();
-  vel_data.data = std::max(closest_point.longitudinal_velocity_mps, static_cast<float>(0.0));
-  pub->publish(vel_data);
+  debug_publisher_->enqueue(
+    pub.get(), [this, pub, points, header = base_traj_raw_ptr_->header,
+                is_reverse = is_reverse_]() mutable {
+      if (is_reverse) flipVelocity(points);
+      pub->publish(toTrajectoryMsg(points, &header));
+    });
+}
+
+void VelocitySmootherNode::publishDebugTrajectories(
+  std::vector<TrajectoryPoints> debug_trajectories, TrajectoryPoints behind_points,
+  const double v0) const
+{
+  if (node_param_.algorithm_type != AlgorithmType::JERK_FILTERED) {
+    return;
+  }
+  if (debug_trajectories.size() != 3) {
+    RCLCPP_DEBUG(get_logger(), "Size of the debug trajectories is incorrect");
+    return;
+  }
+
+  // the jerk filtered trajectories are resampled and published on the worker thread
+  const std::array<rclcpp::Publisher<Trajectory>::SharedPtr, 3> pubs = {
+    pub_forward_filtered_trajectory_, pub_backward_filtered_trajectory_,
+    pub_merged_filtered_trajectory_};
+  debug_publisher_->enqueue(
+    pub_merged_filtered_trajectory_.get(),
+    [this, pubs, pub_closest = pub_closest_merged_velocity_,
+     debug_trajectories = std::move(debug_trajectories), behind_points = std::move(behind_points),
+     v0, resample_param = smoother_->getBaseParam().resample_param,
+     header = base_traj_raw_ptr_->header, is_reverse = is_reverse_,
+     current_pose = current_odometry_ptr_->pose.pose, stamp = this->now(),
+     nearest_dist_threshold = node_param_.ego_nearest_dist_threshold,
+     nearest_yaw_threshold = node_param_.ego_nearest_yaw_threshold]() mutable {
+      const bool publish_closest = DeferredDebugPublisher::hasSubscribers(pub_closest);
+      for (size_t i = 0; i < pubs.size(); ++i) {
+        const bool is_merged = i == pubs.size() - 1;
+        const bool publish_trajectory = DeferredDebugPublisher::hasSubscribers(pubs.at(i));
+        if (!publish_trajectory && !(is_merged && publish_closest)) {
+          continue;
+        }
+
+        auto debug_trajectory = JerkFilteredSmoother::resampleDebugTrajectory(
+          debug_trajectories.at(i), v0, resample_param);
+        debug_trajectory.insert(
+          debug_trajectory.begin(), behind_points.begin(), behind_points.end());
+        for (size_t j = 0; j < behind_points.size(); ++j) {
+          debug_trajectory.at(j).longitudinal_velocity_mps =
+            debug_trajectory.at(behind_points.size()).longitudinal_velocity_mps;
+        }
+        if (is_reverse) flipVelocity(debug_trajectory);
+        if (publish_trajectory) {
+          pubs.at(i)->publish(toTrajectoryMsg(debug_trajectory, &header));
+        }
+
+        if (is_merged && publish_closest) {
+          const size_t seg_idx =
+            autoware::motion_utils::findFirstNearestSegmentIndexWithSoftConstraints(
+              debug_trajectory, current_pose, nearest_dist_threshold, nearest_yaw_threshold);
+          const auto closest_point = trajectory_utils::calcInterpolatedTrajectoryPoint(
+            debug_trajectory, current_pose, seg_idx);
+          Float32Stamped vel_data{};
+          vel_data.stamp = stamp;
+          vel_data.data =
+            std::max(closest_point.longitudinal_velocity_mps, static_cast<float>(0.0));
+          pub_closest->publish(vel_data);
+        }
+      }
+    });
 }
 
 void VelocitySmootherNode::publishClosestState(const TrajectoryPoints & trajectory)
@@ -1122,6 +1255,23 @@ void VelocitySmootherNode::publishStopWatchTime()
   calculation_time_data.stamp = this->now();
   calculation_time_data.data = stop_watch_.toc();
   debug_calculation_time_->publish(calculation_time_data);
+
+  const auto & stats = result_reuse_statistics_;
+  const size_t cycles = stats.reused + stats.warm_started + stats.computed;
+  if (cycles == 0) {
+    return;
+  }
+  Float64Stamped reuse_ratio_data{};
+  reuse_ratio_data.stamp = calculation_time_data.stamp;
+  reuse_ratio_data.data = static_cast<double>(stats.reused) / cycles;
+  debug_result_reuse_ratio_->publish(reuse_ratio_data);
+  Float64Stamped warm_start_ratio_data{};
+  warm_start_ratio_data.stamp = calculation_time_data.stamp;
+  warm_start_ratio_data.data = static_cast<double>(stats.warm_started) / cycles;
+  debug_warm_start_ratio_->publish(warm_start_ratio_data);
+  RCLCPP_DEBUG(
+    get_logger(), "result reuse: reused = %lu, warm started = %lu, computed = %lu", stats.reused,
+    stats.warm_started, stats.computed);
 }
 
 TrajectoryPoint VelocitySmootherNode::calcProjectedTrajectoryPoint(
@@ -15,7 +15,6 @@
 #include "autoware/velocity_smoother/smoother/analytical_jerk_constrained_smoother/analytical_jerk_constrained_smoother.hpp"
 
 #include "autoware/motion_utils/resample/resample.hpp"
-#include "autoware/motion_utils/trajectory/conversion.hpp"
 #include "autoware/velocity_smoother/trajectory_utils.hpp"
 
 #include <autoware_utils_geometry/geometry.hpp>
@@ -300,12 +299,11 @@ TrajectoryPoints AnalyticalJerkConstrainedSmoother::applyLateralAccelerationFilt
   if (use_resampling) {
     std::vector<double> out_arclength;
     const std::vector<double> in_arclength = trajectory_utils::calcArclengthArray(input);
+    out_arclength.reserve(static_cast<size_t>(in_arclength.back() / points_interval) + 1);
     for (double s = 0; s < in_arclength.back(); s += points_interval) {
       out_arclength.push_back(s);
     }
-    const auto output_traj = autoware::motion_utils::resampleTrajectory(
-      autoware::motion_utils::convertToTrajectory(input), out_arclength);
-    output = autoware::motion_utils::convertToTrajectoryPointArray(output_traj);
+    autoware::motion_utils::resampleTrajectory(input, out_arclength, output);
     output.back() = input.back();  // keep the final speed.
   } else {
     output = input;
@@ -326,13 +324,12 @@ TrajectoryPoints AnalyticalJerkConstrainedSmoother::applyLateralAccelerationFilt
   const double max_lateral_accel_abs = std::fabs(base_param_.max_lateral_accel);
 
   std::vector<int> filtered_points;
+  // maximum curvature in [i - before_decel_index, i + after_decel_index)
+  const auto max_curvature_v =
+    trajectory_utils::calcSlidingWindowMaxAbs(curvature_v, before_decel_index, after_decel_index);
+
   for (size_t i = 0; i < output.size(); ++i) {
-    double curvature = 0.0;
-    const size_t start = i > before_decel_index ? i - before_decel_index : 0;
-    const size_t end = std::min(output.size(), i + after_decel_index);
-    for (size_t j = start; j < end; ++j) {
-      curvature = std::max(curvature, std::fabs(curvature_v.at(j)));
-    }
+    const double curvature = max_curvature_v.at(i);
     double v_curvature_max = std::sqrt(max_lateral_accel_abs / std::max(curvature, 1.0E-5));
     v_curvature_max = std::max(v_curvature_max, base_param_.min_curve_velocity);
     if (output.at(i).longitudinal_velocity_mps > v_curvature_max) {
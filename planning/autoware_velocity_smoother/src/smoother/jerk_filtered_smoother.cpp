@@ -18,6 +18,7 @@
 #include "autoware/velocity_smoother/trajectory_utils.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <algorithm>
 #include <chrono>
@@ -26,12 +27,43 @@
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <utility>
 #include <vector>
 
 #define VERBOSE_TRAJECTORY_VELOCITY false
 
 namespace autoware::velocity_smoother
 {
+namespace
+{
+constexpr int max_iteration = 20000;
+// the optimization from the warm start profile is only a correction of the previous solution
+constexpr int warm_start_max_iteration = 1000;
+
+// initial guess of [b, a, delta, sigma, gamma] given by the profile re-anchored on the first N
+// points. Both are ordered along the path, so the segment of the profile only moves forward.
+std::vector<double> calcInitialGuess(
+  const TrajectoryPoints & profile, const TrajectoryPoints & points, const size_t N)
+{
+  std::vector<double> x(5 * N, 0.0);
+  size_t seg_idx =
+    autoware::motion_utils::findNearestSegmentIndex(profile, points.front().pose.position);
+  for (size_t i = 0; i < N; ++i) {
+    const auto & pose = points.at(i).pose;
+    while (seg_idx + 2 < profile.size() &&
+           autoware::motion_utils::calcLongitudinalOffsetToSegment(
+             profile, seg_idx + 1, pose.position) > 0.0) {
+      ++seg_idx;
+    }
+    const auto point = trajectory_utils::calcInterpolatedTrajectoryPoint(profile, pose, seg_idx);
+    const double v = point.longitudinal_velocity_mps;
+    x.at(i) = v * v;
+    x.at(N + i) = point.acceleration_mps2;
+  }
+  return x;
+}
+}  // namespace
+
 JerkFilteredSmoother::JerkFilteredSmoother(
   rclcpp::Node & node, const std::shared_ptr<autoware_utils_debug::TimeKeeper> time_keeper)
 : SmootherBase(node, time_keeper)
@@ -44,7 +76,8 @@ JerkFilteredSmoother::JerkFilteredSmoother(
   p.jerk_filter_ds = node.declare_parameter<double>("jerk_filter_ds");
 
   qp_interface_ =
-    std::make_shared<autoware::qp_interface::ProxQPInterface>(false, 20000, 1.0e-8, 1.0e-6, false);
+    std::make_shared<autoware::qp_interface::ProxQPInterface>(
+      false, max_iteration, 1.0e-8, 1.0e-6, false);
 }
 
 void JerkFilteredSmoother::setParam(const Param & smoother_param)
@@ -57,12 +90,26 @@ JerkFilteredSmoother::Param JerkFilteredSmoother::getParam() const
   return smoother_param_;
 }
 
+void JerkFilteredSmoother::setWarmStartProfile(const TrajectoryPoints & profile)
+{
+  warm_start_profile_ = profile;
+}
+
+bool JerkFilteredSmoother::isWarmStarted() const
+{
+  return is_warm_started_;
+}
+
 bool JerkFilteredSmoother::apply(
   const double v0, const double a0, const TrajectoryPoints & input, TrajectoryPoints & output,
   std::vector<TrajectoryPoints> & debug_trajectories, const bool publish_debug_trajs)
 {
   autoware_utils_debug::ScopedTimeTrack st(__func__, *time_keeper_);
 
+  const auto warm_start_profile = std::exchange(warm_start_profile_, TrajectoryPoints{});
+  is_warm_started_ = false;
+  qp_iteration_number_ = 0;
+
   output = input;
 
   if (input.empty()) {
@@ -94,33 +141,32 @@ bool JerkFilteredSmoother::apply(
   const double over_a_weight = smoother_param_.over_a_weight;
 
   // jerk filter
-  const auto forward_filtered =
+  auto forward_filtered =
     forwardJerkFilter(v0, std::max(a0, a_min), a_max, a_stop_accel, j_max, input);
-  const auto backward_filtered = backwardJerkFilter(
+  auto backward_filtered = backwardJerkFilter(
     input.back().longitudinal_velocity_mps, a_stop_decel, a_min, a_stop_decel, j_min, input);
-  const auto filtered =
+  auto filtered =
     mergeFilteredTrajectory(v0, a0, a_min, j_min, forward_filtered, backward_filtered);
 
   // Resample TrajectoryPoints for Optimization
   // TODO(planning/control team) deal with overlapped lanes with the same direction
   const auto initial_traj_pose = filtered.front().pose;
 
-  const auto resample = [&](const auto & trajectory) {
+  auto opt_resampled_trajectory = [&]() {
     autoware_utils_debug::ScopedTimeTrack st("resample", *time_keeper_);
 
     return resampling::resampleTrajectory(
-      trajectory, v0, initial_traj_pose, std::numeric_limits<double>::max(),
+      filtered, v0, initial_traj_pose, std::numeric_limits<double>::max(),
       std::numeric_limits<double>::max(), base_param_.resample_param);
-  };
+  }();
 
-  auto opt_resampled_trajectory = resample(filtered);
-
-  // Set debug trajectories
+  // Set debug trajectories. They are not resampled here since the resampling is only needed when
+  // they are published, see resampleDebugTrajectory().
   if (publish_debug_trajs) {
     debug_trajectories.resize(3);
-    debug_trajectories[0] = resample(forward_filtered);
-    debug_trajectories[1] = resample(backward_filtered);
-    debug_trajectories[2] = resample(filtered);
+    debug_trajectories[0] = std::move(forward_filtered);
+    debug_trajectories[1] = std::move(backward_filtered);
+    debug_trajectories[2] = std::move(filtered);
   }
 
   // Ensure terminal velocity is zero
@@ -188,12 +234,16 @@ bool JerkFilteredSmoother::apply(
   const uint32_t l_constraints = 4 * N + 1;
 
   // the matrix size depends on constraint numbers.
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(l_constraints, l_variables);
+  // NOTE: the matrices are built from triplets so that the setup cost is linear in the number of
+  // nonzeros, and the sparsity pattern only depends on N (the QP structure can be reused).
+  std::vector<Eigen::Triplet<double>> A;
+  A.reserve(10 * N);
 
   std::vector<double> lower_bound(l_constraints, 0.0);
   std::vector<double> upper_bound(l_constraints, 0.0);
 
-  Eigen::MatrixXd P = Eigen::MatrixXd::Zero(l_variables, l_variables);
+  std::vector<Eigen::Triplet<double>> P;
+  P.reserve(7 * N);
   std::vector<double> q(l_variables, 0.0);
 
   /**************************************************************/
@@ -208,10 +258,11 @@ bool JerkFilteredSmoother::apply(
     const double ref_vel = 0.5 * (v_max_arr.at(i) + v_max_arr.at(i + 1));
     const double interval_dist = std::max(interval_dist_arr.at(i), 0.0001);
     const double w_x_ds_inv = (1.0 / interval_dist) * ref_vel;
-    P(IDX_A0 + i, IDX_A0 + i) += smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
-    P(IDX_A0 + i, IDX_A0 + i + 1) -= smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
-    P(IDX_A0 + i + 1, IDX_A0 + i) -= smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
-    P(IDX_A0 + i + 1, IDX_A0 + i + 1) += smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
+    const double jerk_cost = smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
+    P.emplace_back(IDX_A0 + i, IDX_A0 + i, jerk_cost);
+    P.emplace_back(IDX_A0 + i, IDX_A0 + i + 1, -jerk_cost);
+    P.emplace_back(IDX_A0 + i + 1, IDX_A0 + i, -jerk_cost);
+    P.emplace_back(IDX_A0 + i + 1, IDX_A0 + i + 1, jerk_cost);
   }
 
   // |v_max_i^2 - b_i|/v_max^2 -> minimize (-bi) * ds / v_max^2
@@ -224,9 +275,9 @@ bool JerkFilteredSmoother::apply(
       }
       q.at(IDX_B0 + i) += v_weight_term;
     }
-    P(IDX_DELTA0 + i, IDX_DELTA0 + i) += over_v_weight;  // over velocity cost
-    P(IDX_SIGMA0 + i, IDX_SIGMA0 + i) += over_a_weight;  // over acceleration cost
-    P(IDX_GAMMA0 + i, IDX_GAMMA0 + i) += over_j_weight;  // over jerk cost
+    P.emplace_back(IDX_DELTA0 + i, IDX_DELTA0 + i, over_v_weight);  // over velocity cost
+    P.emplace_back(IDX_SIGMA0 + i, IDX_SIGMA0 + i, over_a_weight);  // over acceleration cost
+    P.emplace_back(IDX_GAMMA0 + i, IDX_GAMMA0 + i, over_j_weight);  // over jerk cost
   }
 
   /**************************************************************/
@@ -247,16 +298,16 @@ bool JerkFilteredSmoother::apply(
 
   // Soft Constraint Velocity Limit: 0 < b - delta < v_max^2
   for (size_t i = 0; i < N; ++i, ++constr_idx) {
-    A(constr_idx, IDX_B0 + i) = 1.0;       // b_i
-    A(constr_idx, IDX_DELTA0 + i) = -1.0;  // -delta_i
+    A.emplace_back(constr_idx, IDX_B0 + i, 1.0);       // b_i
+    A.emplace_back(constr_idx, IDX_DELTA0 + i, -1.0);  // -delta_i
     upper_bound[constr_idx] = v_max_arr.at(i) * v_max_arr.at(i);
     lower_bound[constr_idx] = 0.0;
   }
 
   // Soft Constraint Acceleration Limit: a_min < a - sigma < a_max
   for (size_t i = 0; i < N; ++i, ++constr_idx) {
-    A(constr_idx, IDX_A0 + i) = 1.0;       // a_i
-    A(constr_idx, IDX_SIGMA0 + i) = -1.0;  // -sigma_i
+    A.emplace_back(constr_idx, IDX_A0 + i, 1.0);       // a_i
+    A.emplace_back(constr_idx, IDX_SIGMA0 + i, -1.0);  // -sigma_i
 
     constexpr double stop_vel = 1e-3;
     if (v_max_arr.at(i) < stop_vel) {
@@ -274,30 +325,30 @@ bool JerkFilteredSmoother::apply(
   for (size_t i = 0; i < N - 1; ++i, ++constr_idx) {
     const double ref_vel = 0.5 * (v_max_arr.at(i) + v_max_arr.at(i + 1));
     const double ds = interval_dist_arr.at(i);
-    A(constr_idx, IDX_A0 + i) = -ref_vel;     // -a[i] * ref_vel
-    A(constr_idx, IDX_A0 + i + 1) = ref_vel;  //  a[i+1] * ref_vel
-    A(constr_idx, IDX_GAMMA0 + i) = -ds;      // -gamma[i] * ds
+    A.emplace_back(constr_idx, IDX_A0 + i, -ref_vel);     // -a[i] * ref_vel
+    A.emplace_back(constr_idx, IDX_A0 + i + 1, ref_vel);  //  a[i+1] * ref_vel
+    A.emplace_back(constr_idx, IDX_GAMMA0 + i, -ds);      // -gamma[i] * ds
     upper_bound[constr_idx] = j_max * ds;     //  jerk_max * ds
     lower_bound[constr_idx] = j_min * ds;     //  jerk_min * ds
   }
 
   // b' = 2a ... (b(i+1) - b(i)) / ds = 2a(i)
   for (size_t i = 0; i < N - 1; ++i, ++constr_idx) {
-    A(constr_idx, IDX_B0 + i) = -1.0;                            // b(i)
-    A(constr_idx, IDX_B0 + i + 1) = 1.0;                         // b(i+1)
-    A(constr_idx, IDX_A0 + i) = -2.0 * interval_dist_arr.at(i);  // a(i) * ds
+    A.emplace_back(constr_idx, IDX_B0 + i, -1.0);                            // b(i)
+    A.emplace_back(constr_idx, IDX_B0 + i + 1, 1.0);                         // b(i+1)
+    A.emplace_back(constr_idx, IDX_A0 + i, -2.0 * interval_dist_arr.at(i));  // a(i) * ds
     upper_bound[constr_idx] = 0.0;
     lower_bound[constr_idx] = 0.0;
   }
 
   // initial condition
   {
-    A(constr_idx, IDX_B0) = 1.0;  // b0
+    A.emplace_back(constr_idx, IDX_B0, 1.0);  // b0
     upper_bound[constr_idx] = v0 * v0;
     lower_bound[constr_idx] = v0 * v0;
     ++constr_idx;
 
-    A(constr_idx, IDX_A0) = 1.0;  // a0
+    A.emplace_back(constr_idx, IDX_A0, 1.0);  // a0
     upper_bound[constr_idx] = a0;
     lower_bound[constr_idx] = a0;
     ++constr_idx;
@@ -306,7 +357,21 @@ bool JerkFilteredSmoother::apply(
 
   // execute optimization
   time_keeper_->start_track("optimize");
-  const auto optval = qp_interface_->optimize(P, A, q, lower_bound, upper_bound);
+  std::vector<double> optval;
+  if (warm_start_profile.size() > 1) {
+    // solve from scratch when the correction does not converge
+    qp_interface_->setInitialGuess(
+      calcInitialGuess(warm_start_profile, opt_resampled_trajectory, N));
+    qp_interface_->updateMaxIter(warm_start_max_iteration);
+    optval = qp_interface_->optimize(P, A, q, lower_bound, upper_bound);
+    qp_interface_->updateMaxIter(max_iteration);
+    qp_iteration_number_ += qp_interface_->getIterationNumber();
+    is_warm_started_ = qp_interface_->isSolved();
+  }
+  if (!is_warm_started_) {
+    optval = qp_interface_->optimize(P, A, q, lower_bound, upper_bound);
+    qp_iteration_number_ += qp_interface_->getIterationNumber();
+  }
   time_keeper_->end_track("optimize");
   if (!qp_interface_->isSolved()) {
     RCLCPP_WARN(logger_, "optimization failed : %s", qp_interface_->getStatus().c_str());
@@ -356,6 +421,18 @@ bool JerkFilteredSmoother::apply(
   return true;
 }
 
+TrajectoryPoints JerkFilteredSmoother::resampleDebugTrajectory(
+  const TrajectoryPoints & debug_trajectory, const double v0,
+  const resampling::ResampleParam & resample_param)
+{
+  if (debug_trajectory.size() < 2) {
+    return debug_trajectory;
+  }
+  return resampling::resampleTrajectory(
+    debug_trajectory, v0, debug_trajectory.front().pose, std::numeric_limits<double>::max(),
+    std::numeric_limits<double>::max(), resample_param);
+}
+
 TrajectoryPoints JerkFilteredSmoother::forwardJerkFilter(
   const double v0, const double a0, const double a_max, const double a_start, const double j_max,
   const TrajectoryPoints & input) const
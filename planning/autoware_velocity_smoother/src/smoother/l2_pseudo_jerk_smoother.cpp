@@ -17,11 +17,13 @@
 #include "autoware/velocity_smoother/trajectory_utils.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <algorithm>
 #include <chrono>
 #include <limits>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace autoware::velocity_smoother
@@ -34,12 +36,19 @@ L2PseudoJerkSmoother::L2PseudoJerkSmoother(
   p.pseudo_jerk_weight = node.declare_parameter<double>("pseudo_jerk_weight");
   p.over_v_weight = node.declare_parameter<double>("over_v_weight");
   p.over_a_weight = node.declare_parameter<double>("over_a_weight");
+  p.qp_solver_type = getQPSolverType(node.declare_parameter<std::string>("qp_solver_type"));
 
   qp_solver_.updateMaxIter(4000);
   qp_solver_.updateRhoInterval(0);  // 0 means automatic
   qp_solver_.updateEpsRel(1.0e-4);  // def: 1.0e-4
   qp_solver_.updateEpsAbs(1.0e-4);  // def: 1.0e-4
   qp_solver_.updateVerbose(false);
+
+  // same tolerances as OSQP. The solution is not polished.
+  banded_qp_solver_.updateMaxIter(4000);
+  banded_qp_solver_.updateEpsRel(1.0e-4);
+  banded_qp_solver_.updateEpsAbs(1.0e-4);
+  banded_qp_solver_.updateVerbose(false);
 }
 
 void L2PseudoJerkSmoother::setParam(const Param & smoother_param)
@@ -58,6 +67,7 @@ bool L2PseudoJerkSmoother::apply(
   [[maybe_unused]] const bool publish_debug_trajs)
 {
   debug_trajectories.clear();
+  qp_iteration_number_ = 0;
 
   const auto ts = std::chrono::system_clock::now();
 
@@ -91,13 +101,15 @@ bool L2PseudoJerkSmoother::apply(
   const uint32_t l_variables = 4 * N;
   const uint32_t l_constraints = 3 * N + 1;
 
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(
-    l_constraints, l_variables);  // the matrix size depends on constraint numbers.
+  // only the nonzero entries are stored, since each constraint couples neighboring points
+  std::vector<Eigen::Triplet<double>> A;
+  A.reserve(3 * l_constraints);
 
   std::vector<double> lower_bound(l_constraints, 0.0);
   std::vector<double> upper_bound(l_constraints, 0.0);
 
-  Eigen::MatrixXd P = Eigen::MatrixXd::Zero(l_variables, l_variables);
+  std::vector<Eigen::Triplet<double>> P;
+  P.reserve(2 * l_variables);
   std::vector<double> q(l_variables, 0.0);
 
   const double a_max = base_param_.max_accel;
@@ -115,18 +127,18 @@ bool L2PseudoJerkSmoother::apply(
   for (unsigned int i = N; i < 2 * N - 1; ++i) {
     unsigned int j = i - N;
     const double w_x_ds_inv = 1.0 / std::max(interval_dist_arr.at(j), 0.0001);
-    P(i, i) += w_x_ds_inv * w_x_ds_inv * smooth_weight;
-    P(i, i + 1) -= w_x_ds_inv * w_x_ds_inv * smooth_weight;
-    P(i + 1, i) -= w_x_ds_inv * w_x_ds_inv * smooth_weight;
-    P(i + 1, i + 1) += w_x_ds_inv * w_x_ds_inv * smooth_weight;
+    P.emplace_back(i, i, w_x_ds_inv * w_x_ds_inv * smooth_weight);
+    P.emplace_back(i, i + 1, -w_x_ds_inv * w_x_ds_inv * smooth_weight);
+    P.emplace_back(i + 1, i, -w_x_ds_inv * w_x_ds_inv * smooth_weight);
+    P.emplace_back(i + 1, i + 1, w_x_ds_inv * w_x_ds_inv * smooth_weight);
   }
 
   for (unsigned int i = 2 * N; i < 3 * N; ++i) {  // over velocity cost
-    P(i, i) += over_v_weight;
+    P.emplace_back(i, i, over_v_weight);
   }
 
   for (unsigned int i = 3 * N; i < 4 * N; ++i) {  // over acceleration cost
-    P(i, i) += over_a_weight;
+    P.emplace_back(i, i, over_a_weight);
   }
 
   /* design constraint matrix
@@ -139,8 +151,8 @@ bool L2PseudoJerkSmoother::apply(
   */
   for (unsigned int i = 0; i < N; ++i) {
     const int j = 2 * N + i;
-    A(i, i) = 1.0;   // b_i
-    A(i, j) = -1.0;  // -delta_i
+    A.emplace_back(i, i, 1.0);   // b_i
+    A.emplace_back(i, j, -1.0);  // -delta_i
     upper_bound[i] = v_max[i] * v_max[i];
     lower_bound[i] = 0.0;
   }
@@ -148,8 +160,8 @@ bool L2PseudoJerkSmoother::apply(
   // a_min < a - sigma < a_max
   for (unsigned int i = N; i < 2 * N; ++i) {
     const int j = 2 * N + i;
-    A(i, i) = 1.0;   // a_i
-    A(i, j) = -1.0;  // -sigma_i
+    A.emplace_back(i, i, 1.0);   // a_i
+    A.emplace_back(i, j, -1.0);  // -sigma_i
     if (i != N && v_max[i - N] < std::numeric_limits<double>::epsilon()) {
       upper_bound[i] = 0.0;
       lower_bound[i] = 0.0;
@@ -163,9 +175,9 @@ bool L2PseudoJerkSmoother::apply(
   for (unsigned int i = 2 * N; i < 3 * N - 1; ++i) {
     const unsigned int j = i - 2 * N;
     const double ds_inv = 1.0 / std::max(interval_dist_arr.at(j), 0.0001);
-    A(i, j) = -ds_inv;     // b(i)
-    A(i, j + 1) = ds_inv;  // b(i+1)
-    A(i, j + N) = -2.0;    // a(i)
+    A.emplace_back(i, j, -ds_inv);     // b(i)
+    A.emplace_back(i, j + 1, ds_inv);  // b(i+1)
+    A.emplace_back(i, j + N, -2.0);    // a(i)
     upper_bound[i] = 0.0;
     lower_bound[i] = 0.0;
   }
@@ -174,30 +186,47 @@ bool L2PseudoJerkSmoother::apply(
   const double v0 = initial_vel;
   {
     const unsigned int i = 3 * N - 1;
-    A(i, 0) = 1.0;  // b0
+    A.emplace_back(i, 0, 1.0);  // b0
     upper_bound[i] = v0 * v0;
     lower_bound[i] = v0 * v0;
 
-    A(i + 1, N) = 1.0;  // a0
+    A.emplace_back(i + 1, N, 1.0);  // a0
     upper_bound[i + 1] = initial_acc;
     lower_bound[i + 1] = initial_acc;
   }
 
+  Eigen::SparseMatrix<double> P_sparse(l_variables, l_variables);
+  P_sparse.setFromTriplets(P.begin(), P.end());
+  Eigen::SparseMatrix<double> A_sparse(l_constraints, l_variables);
+  A_sparse.setFromTriplets(A.begin(), A.end());
+
   const auto tf1 = std::chrono::system_clock::now();
   const double dt_ms1 =
     std::chrono::duration_cast<std::chrono::nanoseconds>(tf1 - ts).count() * 1.0e-6;
 
   // execute optimization
   const auto ts2 = std::chrono::system_clock::now();
-  const auto result = qp_solver_.optimize(P, A, q, lower_bound, upper_bound);
-
   // [b0, b1, ..., bN, |  a0, a1, ..., aN, |
   //  delta0, delta1, ..., deltaN, | sigma0, sigma1, ..., sigmaN]
-  const std::vector<double> optval = result.primal_solution;
-  const int status_val = result.solution_status;
-  if (status_val != 1) {
-    RCLCPP_WARN(logger_, "optimization failed : %s", qp_solver_.getStatusMessage().c_str());
-    return false;
+  std::vector<double> optval;
+  if (smoother_param_.qp_solver_type == QPSolverType::BANDED_ADMM) {
+    optval = banded_qp_solver_.optimize(P_sparse, A_sparse, q, lower_bound, upper_bound);
+    qp_iteration_number_ = banded_qp_solver_.getIterationNumber();
+    if (!banded_qp_solver_.isSolved()) {
+      RCLCPP_WARN(logger_, "optimization failed : %s", banded_qp_solver_.getStatus().c_str());
+      return false;
+    }
+  } else {
+    const auto result = qp_solver_.optimize(
+      Eigen::MatrixXd(P_sparse), Eigen::MatrixXd(A_sparse), q, lower_bound, upper_bound);
+    optval = result.primal_solution;
+    qp_iteration_number_ = static_cast<int>(qp_solver_.getTakenIter());
+    const int status_val = result.solution_status;
+    if (status_val != 1) {
+      RCLCPP_WARN(logger_, "optimization failed : %s", qp_solver_.getStatusMessage().c_str());
+      return false;
+    }
+    qp_solver_.logUnsolvedStatus("[autoware_velocity_smoother]");
   }
   const auto has_nan =
     std::any_of(optval.begin(), optval.end(), [](const auto v) { return std::isnan(v); });
@@ -227,8 +256,6 @@ bool L2PseudoJerkSmoother::apply(
   //     v_max[i], optval.at(i + N), optval.at(i), optval.at(i + 2 * N), optval.at(i + 3 * N));
   // }
 
-  qp_solver_.logUnsolvedStatus("[autoware_velocity_smoother]");
-
   const auto tf2 = std::chrono::system_clock::now();
   const double dt_ms2 =
     std::chrono::duration_cast<std::chrono::nanoseconds>(tf2 - ts2).count() * 1.0e-6;
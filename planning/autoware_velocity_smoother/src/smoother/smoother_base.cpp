@@ -15,7 +15,6 @@
 #include "autoware/velocity_smoother/smoother/smoother_base.hpp"
 
 #include "autoware/motion_utils/resample/resample.hpp"
-#include "autoware/motion_utils/trajectory/conversion.hpp"
 #include "autoware/motion_utils/trajectory/trajectory.hpp"
 #include "autoware/velocity_smoother/resample.hpp"
 #include "autoware/velocity_smoother/trajectory_utils.hpp"
@@ -27,6 +26,8 @@
 #include <cmath>
 #include <limits>
 #include <memory>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace autoware::velocity_smoother
@@ -38,8 +39,6 @@ TrajectoryPoints applyPreProcess(
   const TrajectoryPoints & input, const double interval, const bool use_resampling)
 {
   using autoware::motion_utils::calcArcLength;
-  using autoware::motion_utils::convertToTrajectory;
-  using autoware::motion_utils::convertToTrajectoryPointArray;
   using autoware::motion_utils::resampleTrajectory;
 
   if (!use_resampling) {
@@ -51,18 +50,30 @@ TrajectoryPoints applyPreProcess(
 
   // since the resampling takes a long time, omit the resampling when it is not requested
   const auto traj_length = calcArcLength(input);
+  arc_length.reserve(static_cast<size_t>(traj_length / interval) + 1);
   for (double s = 0; s < traj_length; s += interval) {
     arc_length.push_back(s);
   }
 
-  const auto points = resampleTrajectory(convertToTrajectory(input), arc_length);
-  output = convertToTrajectoryPointArray(points);
+  resampleTrajectory(input, arc_length, output);
   output.back() = input.back();  // keep the final speed.
 
   return output;
 }
 }  // namespace
 
+QPSolverType getQPSolverType(const std::string & solver_name)
+{
+  if (solver_name == "osqp") {
+    return QPSolverType::OSQP;
+  }
+  if (solver_name == "banded_admm") {
+    return QPSolverType::BANDED_ADMM;
+  }
+
+  throw std::domain_error("[SmootherBase] undesired QP solver is selected: " + solver_name);
+}
+
 SmootherBase::SmootherBase(
   rclcpp::Node & node, const std::shared_ptr<autoware_utils_debug::TimeKeeper> time_keeper)
 : time_keeper_(time_keeper)
@@ -152,23 +163,9 @@ TrajectoryPoints SmootherBase::applyLateralAccelerationFilter(
   }
 
   // Interpolate with constant interval distance for lateral acceleration calculation.
-  TrajectoryPoints output;
   const double points_interval =
     use_resampling ? base_param_.sample_ds : input_points_interval;  // [m]
-  // since the resampling takes a long time, omit the resampling when it is not requested
-  if (use_resampling) {
-    std::vector<double> out_arclength;
-    const auto traj_length = autoware::motion_utils::calcArcLength(input);
-    for (double s = 0; s < traj_length; s += points_interval) {
-      out_arclength.push_back(s);
-    }
-    const auto output_traj = autoware::motion_utils::resampleTrajectory(
-      autoware::motion_utils::convertToTrajectory(input), out_arclength);
-    output = autoware::motion_utils::convertToTrajectoryPointArray(output_traj);
-    output.back() = input.back();  // keep the final speed.
-  } else {
-    output = input;
-  }
+  auto output = applyPreProcess(input, points_interval, use_resampling);
 
   const size_t idx_dist = static_cast<size_t>(
     std::max(static_cast<int>((base_param_.curvature_calculation_distance) / points_interval), 1));
@@ -189,14 +186,12 @@ TrajectoryPoints SmootherBase::applyLateralAccelerationFilter(
                             base_param_.min_decel_for_lateral_acc_lim_filter)
                         : std::vector<double>{};
 
+  // maximum curvature in [i - after_decel_index, i + before_decel_index]
+  const auto max_curvature_v = trajectory_utils::calcSlidingWindowMaxAbs(
+    curvature_v, after_decel_index, before_decel_index + 1);
+
   for (size_t i = 0; i < output.size(); ++i) {
-    double curvature = 0.0;
-    const size_t start = i > after_decel_index ? i - after_decel_index : 0;
-    const size_t end = std::min(output.size(), i + before_decel_index + 1);
-    for (size_t j = start; j < end; ++j) {
-      if (j >= curvature_v.size()) return output;
-      curvature = std::max(curvature, std::fabs(curvature_v.at(j)));
-    }
+    const double curvature = max_curvature_v.at(i);
     double v_curvature_max = std::sqrt(max_lateral_accel_abs / std::max(curvature, 1.0E-5));
     v_curvature_max = std::max(v_curvature_max, base_param_.min_curve_velocity);
 
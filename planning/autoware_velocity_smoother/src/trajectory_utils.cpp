@@ -20,6 +20,8 @@
 #include <autoware_utils_geometry/geometry.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <deque>
 #include <limits>
 #include <map>
 #include <tuple>
@@ -220,6 +222,37 @@ std::vector<double> calcTrajectoryCurvatureFrom3Points(
   return k_arr;
 }
 
+std::vector<double> calcSlidingWindowMaxAbs(
+  const std::vector<double> & values, const size_t window_before, const size_t window_after)
+{
+  std::vector<double> max_abs(values.size(), 0.0);
+
+  // indices in the window whose absolute values are decreasing, the front is the maximum
+  std::deque<size_t> candidates;
+  size_t window_end = 0;
+  for (size_t i = 0; i < values.size(); ++i) {
+    for (; window_end < std::min(values.size(), i + window_after); ++window_end) {
+      const double value = std::fabs(values.at(window_end));
+      if (std::isnan(value)) {
+        continue;
+      }
+      while (!candidates.empty() && std::fabs(values.at(candidates.back())) <= value) {
+        candidates.pop_back();
+      }
+      candidates.push_back(window_end);
+    }
+
+    const size_t window_start = i > window_before ? i - window_before : 0;
+    while (!candidates.empty() && candidates.front() < window_start) {
+      candidates.pop_front();
+    }
+    if (!candidates.empty()) {
+      max_abs.at(i) = std::fabs(values.at(candidates.front()));
+    }
+  }
+  return max_abs;
+}
+
 void applyMaximumVelocityLimit(
   const size_t begin, const size_t end, const double max_vel, TrajectoryPoints & trajectory)
 {
@@ -0,0 +1,83 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/velocity_smoother/deferred_debug_publisher.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+
+using autoware::velocity_smoother::DeferredDebugPublisher;
+
+namespace
+{
+constexpr auto timeout = std::chrono::seconds(10);
+
+/// @brief keep the worker busy until release() so that the next jobs wait in the queue
+class WorkerBlocker
+{
+public:
+  explicit WorkerBlocker(DeferredDebugPublisher & publisher)
+  {
+    auto blocked = blocked_.get_future();
+    publisher.enqueue(this, [this, release = release_.get_future().share()]() {
+      blocked_.set_value();
+      release.wait();
+    });
+    blocked.wait();
+  }
+
+  void release() { release_.set_value(); }
+
+private:
+  std::promise<void> blocked_;
+  std::promise<void> release_;
+};
+}  // namespace
+
+TEST(TestDeferredDebugPublisher, EnqueueReplacesWaitingJobWithSameKey)
+{
+  DeferredDebugPublisher publisher;
+  WorkerBlocker blocker(publisher);
+
+  const int key = 0;
+  std::atomic<int> stale_job_count{0};
+  std::promise<void> latest_job_done;
+  publisher.enqueue(&key, [&stale_job_count]() { ++stale_job_count; });
+  publisher.enqueue(&key, [&latest_job_done]() { latest_job_done.set_value(); });
+  blocker.release();
+
+  // the jobs run in the order of their enqueue, so the stale job would have run before the latest
+  ASSERT_EQ(latest_job_done.get_future().wait_for(timeout), std::future_status::ready);
+  EXPECT_EQ(stale_job_count, 0);
+}
+
+TEST(TestDeferredDebugPublisher, EnqueueKeepsJobsWithOtherKeys)
+{
+  DeferredDebugPublisher publisher;
+  WorkerBlocker blocker(publisher);
+
+  const int first_key = 0;
+  const int second_key = 0;
+  std::atomic<int> first_job_count{0};
+  std::promise<void> second_job_done;
+  publisher.enqueue(&first_key, [&first_job_count]() { ++first_job_count; });
+  publisher.enqueue(&second_key, [&second_job_done]() { second_job_done.set_value(); });
+  blocker.release();
+
+  ASSERT_EQ(second_job_done.get_future().wait_for(timeout), std::future_status::ready);
+  EXPECT_EQ(first_job_count, 1);
+}
@@ -12,10 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "autoware/velocity_smoother/input_fingerprint.hpp"
 #include "autoware/velocity_smoother/trajectory_utils.hpp"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 using autoware::velocity_smoother::trajectory_utils::TrajectoryPoints;
@@ -61,3 +64,51 @@ TEST(TestTrajectoryUtils, CalcTrajectoryCurvatureFrom3Points)
     }
   }
 }
+
+TEST(TestTrajectoryUtils, CalcSlidingWindowMaxAbs)
+{
+  using autoware::velocity_smoother::trajectory_utils::calcSlidingWindowMaxAbs;
+
+  const std::vector<double> values = {0.1, -0.5, 0.2, 0.0, -0.3, 0.4, 0.1, -0.1, 0.05, 0.3};
+
+  // compare with the brute force search of the window [i - before, i + after)
+  for (size_t before = 0; before < 12; ++before) {
+    for (size_t after = 0; after < 12; ++after) {
+      const auto max_abs = calcSlidingWindowMaxAbs(values, before, after);
+      ASSERT_EQ(max_abs.size(), values.size());
+      for (size_t i = 0; i < values.size(); ++i) {
+        double expected = 0.0;
+        const size_t start = i > before ? i - before : 0;
+        const size_t end = std::min(values.size(), i + after);
+        for (size_t j = start; j < end; ++j) {
+          expected = std::max(expected, std::fabs(values.at(j)));
+        }
+        EXPECT_DOUBLE_EQ(max_abs.at(i), expected)
+          << "i = " << i << ", before = " << before << ", after = " << after;
+      }
+    }
+  }
+
+  EXPECT_TRUE(calcSlidingWindowMaxAbs({}, 1, 1).empty());
+}
+
+TEST(TestInputFingerprint, DetectChange)
+{
+  using autoware::velocity_smoother::InputFingerprint;
+
+  const auto trajectory = genStraightTrajectory(10);
+  const auto fingerprint = [](const TrajectoryPoints & points, const double value) {
+    return InputFingerprint{}.add(points).add(value).value();
+  };
+
+  EXPECT_EQ(fingerprint(trajectory, 1.0), fingerprint(trajectory, 1.0));
+  EXPECT_NE(fingerprint(trajectory, 1.0), fingerprint(trajectory, 2.0));
+
+  auto modified = trajectory;
+  modified.at(5).longitudinal_velocity_mps += 1.0e-6;
+  EXPECT_NE(fingerprint(trajectory, 1.0), fingerprint(modified, 1.0));
+
+  modified = trajectory;
+  modified.pop_back();
+  EXPECT_NE(fingerprint(trajectory, 1.0), fingerprint(modified, 1.0));
+}
@@ -20,8 +20,12 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cmath>
+#include <functional>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 using autoware::planning_test_manager::PlanningInterfaceTestManager;
@@ -35,11 +39,11 @@ std::shared_ptr<PlanningInterfaceTestManager> generateTestManager()
   return test_manager;
 }
 
-std::shared_ptr<VelocitySmootherNode> generateNode()
+std::shared_ptr<VelocitySmootherNode> generateNode(const bool publish_debug_trajs = false)
 {
   auto node_options = rclcpp::NodeOptions{};
   node_options.append_parameter_override("algorithm_type", "JerkFiltered");
-  node_options.append_parameter_override("publish_debug_trajs", false);
+  node_options.append_parameter_override("publish_debug_trajs", publish_debug_trajs);
   const auto autoware_test_utils_dir =
     ament_index_cpp::get_package_share_directory("autoware_test_utils");
   const auto velocity_smoother_dir =
@@ -113,3 +117,106 @@ TEST(PlanningModuleInterfaceTest, NodeTestWithOffTrackEgoPose)
 
   rclcpp::shutdown();
 }
+
+// the same trajectory is eventually reused as is, while the side outputs of the planning are still
+// published, and a different trajectory is planned from scratch
+TEST(PlanningModuleInterfaceTest, NodeTestWithResultReuse)
+{
+  using autoware_internal_debug_msgs::msg::Float32Stamped;
+  using autoware_internal_debug_msgs::msg::Float64Stamped;
+  using autoware_planning_msgs::msg::Trajectory;
+  using visualization_msgs::msg::MarkerArray;
+
+  rclcpp::init(0, nullptr);
+  auto test_manager = generateTestManager();
+  auto test_target_node = generateNode(true);
+  auto test_node = test_manager->getTestNode();
+
+  size_t trajectory_num = 0;
+  size_t virtual_wall_num = 0;
+  size_t closest_max_velocity_num = 0;
+  size_t cycle_num = 0;
+  double reuse_ratio = 0.0;
+  double warm_start_ratio = 0.0;
+  const auto sub_trajectory = test_node->create_subscription<Trajectory>(
+    "velocity_smoother/output/trajectory", rclcpp::QoS{10},
+    [&](const Trajectory::ConstSharedPtr) { ++trajectory_num; });
+  const auto sub_virtual_wall = test_node->create_subscription<MarkerArray>(
+    "velocity_smoother/virtual_wall", rclcpp::QoS{10},
+    [&](const MarkerArray::ConstSharedPtr) { ++virtual_wall_num; });
+  const auto sub_closest_max_velocity = test_node->create_subscription<Float32Stamped>(
+    "velocity_smoother/closest_max_velocity", rclcpp::QoS{10},
+    [&](const Float32Stamped::ConstSharedPtr) { ++closest_max_velocity_num; });
+  const auto sub_reuse_ratio = test_node->create_subscription<Float64Stamped>(
+    "velocity_smoother/debug/result_reuse_ratio", rclcpp::QoS{10},
+    [&](const Float64Stamped::ConstSharedPtr msg) {
+      ++cycle_num;
+      reuse_ratio = msg->data;
+    });
+  const auto sub_warm_start_ratio = test_node->create_subscription<Float64Stamped>(
+    "velocity_smoother/debug/warm_start_ratio", rclcpp::QoS{10},
+    [&](const Float64Stamped::ConstSharedPtr msg) { warm_start_ratio = msg->data; });
+
+  // a zero velocity limit from the stopped ego inserts a virtual wall
+  publishMandatoryTopics(test_manager, test_target_node);
+
+  const auto spin_until = [&](const std::function<bool()> & is_done) {
+    for (int i = 0; i < 200 && !is_done(); ++i) {
+      rclcpp::spin_some(test_target_node);
+      rclcpp::spin_some(test_node);
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return is_done();
+  };
+  struct Counts
+  {
+    size_t reused;
+    size_t warm_started;
+    size_t trajectory;
+    size_t virtual_wall;
+    size_t closest_max_velocity;
+  };
+  // run one planning cycle with the trajectory and return the counts after it
+  const auto plan = [&](const Trajectory & trajectory) {
+    const size_t expected_cycle_num = cycle_num + 1;
+    test_manager->publishInput(
+      test_target_node, "velocity_smoother/input/trajectory", trajectory, 1);
+    EXPECT_TRUE(spin_until([&]() {
+      return cycle_num >= expected_cycle_num && trajectory_num >= expected_cycle_num &&
+             virtual_wall_num >= expected_cycle_num &&
+             closest_max_velocity_num >= expected_cycle_num;
+    }));
+    const auto n = static_cast<double>(cycle_num);
+    return Counts{
+      static_cast<size_t>(std::lround(reuse_ratio * n)),
+      static_cast<size_t>(std::lround(warm_start_ratio * n)), trajectory_num, virtual_wall_num,
+      closest_max_velocity_num};
+  };
+
+  // the previous output is an input of the planning, so the result is reused once it converges
+  const auto trajectory = autoware::test_utils::generateTrajectory<Trajectory>(20, 1.0, 1.0);
+  Counts counts = plan(trajectory);
+  EXPECT_EQ(counts.reused, 0U);
+  bool is_reused = false;
+  for (size_t i = 0; i < 10 && !is_reused; ++i) {
+    const auto prev_counts = counts;
+    counts = plan(trajectory);
+    is_reused = counts.reused > prev_counts.reused;
+    // every cycle publishes the output and the side outputs, whether the result is reused or not
+    EXPECT_EQ(counts.trajectory, prev_counts.trajectory + 1);
+    EXPECT_EQ(counts.virtual_wall, prev_counts.virtual_wall + 1);
+    EXPECT_EQ(counts.closest_max_velocity, prev_counts.closest_max_velocity + 1);
+  }
+  EXPECT_TRUE(is_reused);
+  EXPECT_GE(counts.warm_started, 1U);
+
+  // a changed trajectory is neither reused nor warm started
+  const auto prev_counts = counts;
+  counts = plan(autoware::test_utils::generateTrajectory<Trajectory>(20, 1.1, 1.0));
+  EXPECT_EQ(counts.reused, prev_counts.reused);
+  EXPECT_EQ(counts.warm_started, prev_counts.warm_started);
+  EXPECT_EQ(counts.trajectory, prev_counts.trajectory + 1);
+  EXPECT_EQ(counts.virtual_wall, prev_counts.virtual_wall + 1);
+
+  rclcpp::shutdown();
+}
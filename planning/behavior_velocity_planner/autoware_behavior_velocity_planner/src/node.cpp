@@ -272,6 +272,8 @@ bool BehaviorVelocityPlannerNode::processData(rclcpp::Clock clock)
   const auto map_data = sub_lanelet_map_.take_data();
   if (map_data) {
     planner_data_.route_handler_ = std::make_shared<route_handler::RouteHandler>(*map_data);
+    planner_data_.partition_index_ =
+      std::make_shared<const PartitionIndex>(planner_data_.route_handler_->getLaneletMapPtr());
   }
 
   // planner_data_.external_velocity_limit is std::optional type variable.
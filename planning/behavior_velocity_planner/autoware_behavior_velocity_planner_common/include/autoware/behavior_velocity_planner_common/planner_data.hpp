@@ -15,6 +15,7 @@
 #ifndef AUTOWARE__BEHAVIOR_VELOCITY_PLANNER_COMMON__PLANNER_DATA_HPP_
 #define AUTOWARE__BEHAVIOR_VELOCITY_PLANNER_COMMON__PLANNER_DATA_HPP_
 
+#include "autoware/behavior_velocity_planner_common/utilization/partition_index.hpp"
 #include "autoware/behavior_velocity_planner_common/utilization/util.hpp"
 #include "autoware/route_handler/route_handler.hpp"
 #include "autoware/velocity_smoother/smoother/smoother_base.hpp"
@@ -68,6 +69,8 @@ struct PlannerData
 
   std::shared_ptr<autoware::velocity_smoother::SmootherBase> velocity_smoother_;
   std::shared_ptr<autoware::route_handler::RouteHandler> route_handler_;
+  // spatial index of the map partitions, rebuilt each time a new map is received
+  std::shared_ptr<const PartitionIndex> partition_index_;
   autoware::vehicle_info_utils::VehicleInfo vehicle_info_;
 
   double max_stop_acceleration_threshold;
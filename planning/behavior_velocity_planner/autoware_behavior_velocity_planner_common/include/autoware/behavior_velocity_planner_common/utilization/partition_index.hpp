@@ -0,0 +1,89 @@
+// Copyright 2025 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__PARTITION_INDEX_HPP_
+#define AUTOWARE__BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__PARTITION_INDEX_HPP_
+
+#include "autoware/behavior_velocity_planner_common/utilization/util.hpp"
+
+#include <autoware_utils_geometry/boost_geometry.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <lanelet2_core/LaneletMap.h>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace autoware::behavior_velocity_planner
+{
+/// @brief spatial index over the partition polygons of a lanelet map
+/// @details each partition is stored as in `planning_utils::getAllPartitionLanelets` and its edges
+/// (including the closing edge) are packed into an rtree keyed by their envelopes. Queries first
+/// collect the candidate edges intersecting the query box, then refine them with the exact
+/// point-to-segment distance. A second rtree over the partition envelopes is used to detect query
+/// points lying inside a partition, for which the distance is zero.
+class PartitionIndex
+{
+public:
+  /// @brief node of the edge rtree: envelope of the edge and (partition index, edge index)
+  using EdgeNode = std::pair<autoware_utils_geometry::Box2d, std::pair<size_t, size_t>>;
+  /// @brief node of the envelope rtree: envelope of the partition and partition index
+  using EnvelopeNode = std::pair<autoware_utils_geometry::Box2d, size_t>;
+  using EdgeRtree = boost::geometry::index::rtree<EdgeNode, boost::geometry::index::rstar<16>>;
+  using EnvelopeRtree =
+    boost::geometry::index::rtree<EnvelopeNode, boost::geometry::index::rstar<16>>;
+
+  PartitionIndex() = default;
+
+  /// @brief build the index from all the partitions of the given map
+  /// @param lanelet_map lanelet map
+  explicit PartitionIndex(const lanelet::LaneletMapConstPtr & lanelet_map);
+
+  /// @brief build the index from already extracted partitions
+  /// @param partitions partition polygons (e.g., from `planning_utils::getAllPartitionLanelets`)
+  explicit PartitionIndex(BasicPolygons2d partitions);
+
+  /// @brief get the indexes of the partitions closer than the given radius to a point
+  /// @param point query point
+  /// @param radius [m] query radius (exclusive)
+  /// @return indexes into `partitions()`, in increasing order
+  [[nodiscard]] std::vector<size_t> query_indices(
+    const autoware_utils_geometry::Point2d & point, const double radius) const;
+
+  /// @brief get the partitions closer than the given radius to a point
+  /// @param point query point
+  /// @param radius [m] query radius (exclusive)
+  /// @param [out] close_partitions partitions within the radius, in the order of `partitions()`
+  void query(
+    const autoware_utils_geometry::Point2d & point, const double radius,
+    BasicPolygons2d & close_partitions) const;
+
+  /// @brief all partitions of the index
+  [[nodiscard]] const BasicPolygons2d & partitions() const { return partitions_; }
+
+  /// @brief true if the index contains no partition
+  [[nodiscard]] bool empty() const { return partitions_.empty(); }
+
+private:
+  void build();
+
+  BasicPolygons2d partitions_;
+  EdgeRtree edge_rtree_;
+  EnvelopeRtree envelope_rtree_;
+};
+}  // namespace autoware::behavior_velocity_planner
+
+#endif  // AUTOWARE__BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__PARTITION_INDEX_HPP_
@@ -72,6 +72,8 @@ using autoware_internal_planning_msgs::msg::PathPointWithLaneId;
 using autoware_internal_planning_msgs::msg::PathWithLaneId;
 using autoware_perception_msgs::msg::PredictedObjects;
 
+class PartitionIndex;
+
 namespace planning_utils
 {
 size_t calcSegmentIndexFromPointIndex(
@@ -90,6 +92,17 @@ void extractClosePartition(
   const geometry_msgs::msg::Point position, const BasicPolygons2d & all_partitions,
   BasicPolygons2d & close_partition, const double distance_thresh = 30.0);
 
+/**
+ * @brief Extract the partitions close to a position using a prebuilt spatial index
+ * @param position Query position
+ * @param partition_index Spatial index of all the partitions of the map
+ * @param close_partition [out] Partitions closer than distance_thresh, in the map order
+ * @param distance_thresh Distance threshold [m]
+ */
+void extractClosePartition(
+  const geometry_msgs::msg::Point position, const PartitionIndex & partition_index,
+  BasicPolygons2d & close_partition, const double distance_thresh = 30.0);
+
 void getAllPartitionLanelets(const lanelet::LaneletMapConstPtr & ll, BasicPolygons2d & polys);
 
 void setVelocityFromIndex(const size_t begin_idx, const double vel, PathWithLaneId * input);
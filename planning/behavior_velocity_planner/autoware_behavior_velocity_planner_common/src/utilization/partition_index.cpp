@@ -0,0 +1,146 @@
+// Copyright 2025 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/behavior_velocity_planner_common/utilization/partition_index.hpp"
+
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/iterator/function_output_iterator.hpp>
+
+#include <lanelet2_core/geometry/Polygon.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace autoware::behavior_velocity_planner
+{
+namespace
+{
+namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+double calc_squared_distance_to_segment(
+  const double px, const double py, const lanelet::BasicPoint2d & a,
+  const lanelet::BasicPoint2d & b)
+{
+  const double abx = b.x() - a.x();
+  const double aby = b.y() - a.y();
+  const double apx = px - a.x();
+  const double apy = py - a.y();
+  const double squared_length = abx * abx + aby * aby;
+  const double t =
+    squared_length > 0.0 ? std::clamp((apx * abx + apy * aby) / squared_length, 0.0, 1.0) : 0.0;
+  const double dx = apx - t * abx;
+  const double dy = apy - t * aby;
+  return dx * dx + dy * dy;
+}
+
+autoware_utils_geometry::Box2d make_box(
+  const lanelet::BasicPoint2d & a, const lanelet::BasicPoint2d & b)
+{
+  return autoware_utils_geometry::Box2d{
+    autoware_utils_geometry::Point2d{std::min(a.x(), b.x()), std::min(a.y(), b.y())},
+    autoware_utils_geometry::Point2d{std::max(a.x(), b.x()), std::max(a.y(), b.y())}};
+}
+}  // namespace
+
+PartitionIndex::PartitionIndex(const lanelet::LaneletMapConstPtr & lanelet_map)
+{
+  planning_utils::getAllPartitionLanelets(lanelet_map, partitions_);
+  build();
+}
+
+PartitionIndex::PartitionIndex(BasicPolygons2d partitions) : partitions_(std::move(partitions))
+{
+  build();
+}
+
+void PartitionIndex::build()
+{
+  std::vector<EdgeNode> edge_nodes;
+  std::vector<EnvelopeNode> envelope_nodes;
+  envelope_nodes.reserve(partitions_.size());
+  for (size_t i = 0; i < partitions_.size(); ++i) {
+    const auto & partition = partitions_[i];
+    if (partition.empty()) {
+      continue;
+    }
+    // the partition is treated as a closed polygon, so the edge from the last to the first point is
+    // also indexed
+    for (size_t j = 0; j < partition.size(); ++j) {
+      const auto & next = partition[(j + 1) % partition.size()];
+      edge_nodes.emplace_back(make_box(partition[j], next), std::make_pair(i, j));
+    }
+    autoware_utils_geometry::Box2d envelope;
+    bg::envelope(partition, envelope);
+    envelope_nodes.emplace_back(envelope, i);
+  }
+  // the range constructors use the packing algorithm
+  edge_rtree_ = EdgeRtree(edge_nodes.begin(), edge_nodes.end());
+  envelope_rtree_ = EnvelopeRtree(envelope_nodes.begin(), envelope_nodes.end());
+}
+
+std::vector<size_t> PartitionIndex::query_indices(
+  const autoware_utils_geometry::Point2d & point, const double radius) const
+{
+  std::vector<size_t> indices;
+  if (partitions_.empty() || radius <= 0.0) {
+    return indices;
+  }
+  const double squared_radius = radius * radius;
+  std::vector<bool> is_close(partitions_.size(), false);
+
+  const autoware_utils_geometry::Box2d query_box{
+    autoware_utils_geometry::Point2d{point.x() - radius, point.y() - radius},
+    autoware_utils_geometry::Point2d{point.x() + radius, point.y() + radius}};
+  edge_rtree_.query(
+    bgi::intersects(query_box),
+    boost::make_function_output_iterator([&](const EdgeNode & node) {
+      const auto [partition_idx, edge_idx] = node.second;
+      if (is_close[partition_idx]) {
+        return;
+      }
+      const auto & partition = partitions_[partition_idx];
+      const auto & a = partition[edge_idx];
+      const auto & b = partition[(edge_idx + 1) % partition.size()];
+      if (calc_squared_distance_to_segment(point.x(), point.y(), a, b) < squared_radius) {
+        is_close[partition_idx] = true;
+        indices.push_back(partition_idx);
+      }
+    }));
+
+  // a point inside a partition polygon is at a zero distance from it even if its edges are far
+  envelope_rtree_.query(
+    bgi::intersects(point), boost::make_function_output_iterator([&](const EnvelopeNode & node) {
+      if (!is_close[node.second] && bg::distance(point, partitions_[node.second]) < radius) {
+        is_close[node.second] = true;
+        indices.push_back(node.second);
+      }
+    }));
+
+  std::sort(indices.begin(), indices.end());
+  return indices;
+}
+
+void PartitionIndex::query(
+  const autoware_utils_geometry::Point2d & point, const double radius,
+  BasicPolygons2d & close_partitions) const
+{
+  close_partitions.clear();
+  for (const auto idx : query_indices(point, radius)) {
+    close_partitions.push_back(partitions_[idx]);
+  }
+}
+}  // namespace autoware::behavior_velocity_planner
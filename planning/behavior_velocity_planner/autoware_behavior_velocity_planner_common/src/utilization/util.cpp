@@ -15,6 +15,7 @@
 #include "autoware/behavior_velocity_planner_common/utilization/util.hpp"
 
 #include "autoware/behavior_velocity_planner_common/utilization/boost_geometry_helper.hpp"
+#include "autoware/behavior_velocity_planner_common/utilization/partition_index.hpp"
 #include "autoware/motion_utils/trajectory/trajectory.hpp"
 
 #include <autoware/lanelet2_utils/topology.hpp>
@@ -244,6 +245,13 @@ void extractClosePartition(
   }
 }
 
+void extractClosePartition(
+  const geometry_msgs::msg::Point position, const PartitionIndex & partition_index,
+  BasicPolygons2d & close_partition, const double distance_thresh)
+{
+  partition_index.query(Point2d(position.x, position.y), distance_thresh, close_partition);
+}
+
 void getAllPartitionLanelets(const lanelet::LaneletMapConstPtr & ll, BasicPolygons2d & polys)
 {
   const lanelet::ConstLineStrings3d partitions = lanelet::utils::query::getAllPartitions(ll);
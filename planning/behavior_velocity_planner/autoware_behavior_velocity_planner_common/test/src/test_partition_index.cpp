@@ -0,0 +1,123 @@
+// Copyright 2025 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/behavior_velocity_planner_common/utilization/partition_index.hpp>
+#include <autoware/behavior_velocity_planner_common/utilization/util.hpp>
+
+#include <geometry_msgs/msg/point.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+using autoware::behavior_velocity_planner::BasicPolygons2d;
+using autoware::behavior_velocity_planner::PartitionIndex;
+using autoware::behavior_velocity_planner::Point2d;
+namespace planning_utils = autoware::behavior_velocity_planner::planning_utils;
+
+namespace
+{
+geometry_msgs::msg::Point createPoint(const double x, const double y)
+{
+  geometry_msgs::msg::Point p;
+  p.x = x;
+  p.y = y;
+  return p;
+}
+
+lanelet::BasicPolygon2d createPartition(const std::vector<std::pair<double, double>> & points)
+{
+  lanelet::BasicPolygon2d partition;
+  for (const auto & [x, y] : points) {
+    partition.emplace_back(x, y);
+  }
+  return partition;
+}
+
+void expectSamePartitions(const BasicPolygons2d & expected, const BasicPolygons2d & actual)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(expected[i].size(), actual[i].size());
+    for (size_t j = 0; j < expected[i].size(); ++j) {
+      EXPECT_DOUBLE_EQ(expected[i][j].x(), actual[i][j].x());
+      EXPECT_DOUBLE_EQ(expected[i][j].y(), actual[i][j].y());
+    }
+  }
+}
+}  // namespace
+
+TEST(PartitionIndexTest, empty)
+{
+  const PartitionIndex index{BasicPolygons2d{}};
+  EXPECT_TRUE(index.empty());
+  EXPECT_TRUE(index.query_indices(Point2d(0.0, 0.0), 100.0).empty());
+
+  BasicPolygons2d close_partitions{createPartition({{0.0, 0.0}})};
+  planning_utils::extractClosePartition(createPoint(0.0, 0.0), index, close_partitions);
+  EXPECT_TRUE(close_partitions.empty());
+}
+
+TEST(PartitionIndexTest, queryIndices)
+{
+  BasicPolygons2d partitions;
+  partitions.push_back(createPartition({{0.0, 0.0}, {10.0, 0.0}}));
+  partitions.push_back(createPartition({{0.0, 20.0}, {10.0, 20.0}}));
+  partitions.push_back(createPartition({{100.0, 0.0}, {110.0, 10.0}, {100.0, 10.0}}));
+  const PartitionIndex index{partitions};
+
+  EXPECT_EQ(index.query_indices(Point2d(5.0, 1.0), 2.0), (std::vector<size_t>{0}));
+  EXPECT_EQ(index.query_indices(Point2d(5.0, 10.0), 10.5), (std::vector<size_t>{0, 1}));
+  // the distance threshold is exclusive
+  EXPECT_TRUE(index.query_indices(Point2d(5.0, 10.0), 10.0).empty());
+  // a point inside the closed polygon is at a zero distance from it
+  EXPECT_EQ(index.query_indices(Point2d(105.0, 8.0), 0.1), (std::vector<size_t>{2}));
+  EXPECT_TRUE(index.query_indices(Point2d(50.0, 50.0), 10.0).empty());
+}
+
+TEST(PartitionIndexTest, sameResultAsLinearScan)
+{
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> position(-500.0, 500.0);
+  std::uniform_real_distribution<double> step(-20.0, 20.0);
+  std::uniform_int_distribution<size_t> size(2, 8);
+
+  BasicPolygons2d partitions;
+  for (size_t i = 0; i < 300; ++i) {
+    lanelet::BasicPolygon2d partition;
+    double x = position(gen);
+    double y = position(gen);
+    const auto nb_points = size(gen);
+    for (size_t j = 0; j < nb_points; ++j) {
+      partition.emplace_back(x, y);
+      x += step(gen);
+      y += step(gen);
+    }
+    partitions.push_back(partition);
+  }
+  const PartitionIndex index{partitions};
+
+  for (size_t i = 0; i < 200; ++i) {
+    const auto query_point = createPoint(position(gen), position(gen));
+    for (const double threshold : {1.0, 10.0, 30.0, 100.0}) {
+      BasicPolygons2d expected;
+      BasicPolygons2d actual;
+      planning_utils::extractClosePartition(query_point, partitions, expected, threshold);
+      planning_utils::extractClosePartition(query_point, index, actual, threshold);
+      expectSamePartitions(expected, actual);
+    }
+  }
+}
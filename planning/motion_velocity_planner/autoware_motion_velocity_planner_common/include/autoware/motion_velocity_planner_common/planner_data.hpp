@@ -18,6 +18,7 @@
 #include <autoware/motion_utils/distance/distance.hpp>
 #include <autoware/motion_utils/trajectory/trajectory.hpp>
 #include <autoware/motion_velocity_planner_common/collision_checker.hpp>
+#include <autoware/point_types/voxel_grid_downsampler.hpp>
 #include <autoware/route_handler/route_handler.hpp>
 #include <autoware/velocity_smoother/smoother/smoother_base.hpp>
 #include <autoware_utils_geometry/boost_polygon_utils.hpp>
@@ -37,7 +38,6 @@
 
 #include <lanelet2_core/Forward.h>
 #include <pcl/common/transforms.h>
-#include <pcl/filters/voxel_grid.h>
 #include <pcl/kdtree/kdtree_flann.h>
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
@@ -49,6 +49,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -155,10 +156,26 @@ public:
       const autoware::motion_velocity_planner::TrajectoryPoints & trajectory_points,
       const autoware::vehicle_info_utils::VehicleInfo & vehicle_info) const;
 
+    /// @brief downsampler shared by the copies of this pointcloud, not to be used while filtering
+    const autoware::point_types::VoxelGridDownsampler & get_voxel_grid_downsampler() const
+    {
+      return voxel_grid_->downsampler;
+    }
+
   private:
     mutable std::optional<pcl::PointCloud<pcl::PointXYZ>::Ptr> filtered_pointcloud_ptr;
     mutable std::optional<std::vector<pcl::PointIndices>> cluster_indices;
 
+    // The node copies the planner data every cycle, so the downsampler is shared by the copies to
+    // reuse its voxel table across the cycles. Filtering mutates the shared downsampler, hence the
+    // mutex even though the filtering is const.
+    struct SharedVoxelGrid
+    {
+      std::mutex mutex;
+      autoware::point_types::VoxelGridDownsampler downsampler;
+    };
+    std::shared_ptr<SharedVoxelGrid> voxel_grid_{std::make_shared<SharedVoxelGrid>()};
+
     PointcloudObstacleFilteringParam pointcloud_obstacle_filtering_param_;
     double mask_lat_margin_{};
 
@@ -29,6 +29,7 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -399,14 +400,14 @@ PlannerData::Pointcloud::filter_and_cluster_point_clouds(
 
   // 3. downsample & cluster pointcloud
   pcl::PointCloud<pcl::PointXYZ>::Ptr filtered_points_ptr(new pcl::PointCloud<pcl::PointXYZ>);
-  pcl::VoxelGrid<pcl::PointXYZ> filter;
-
-  filter.setInputCloud(far_away_pointcloud_ptr);
-  filter.setLeafSize(
-    pointcloud_obstacle_filtering_param_.pointcloud_voxel_grid_x,
-    pointcloud_obstacle_filtering_param_.pointcloud_voxel_grid_y,
-    pointcloud_obstacle_filtering_param_.pointcloud_voxel_grid_z);
-  filter.filter(*filtered_points_ptr);
+  {
+    std::lock_guard<std::mutex> lock(voxel_grid_->mutex);
+    voxel_grid_->downsampler.set_leaf_size(
+      static_cast<float>(pointcloud_obstacle_filtering_param_.pointcloud_voxel_grid_x),
+      static_cast<float>(pointcloud_obstacle_filtering_param_.pointcloud_voxel_grid_y),
+      static_cast<float>(pointcloud_obstacle_filtering_param_.pointcloud_voxel_grid_z));
+    voxel_grid_->downsampler.filter(*far_away_pointcloud_ptr, *filtered_points_ptr);
+  }
 
   pcl::search::KdTree<pcl::PointXYZ>::Ptr tree(new pcl::search::KdTree<pcl::PointXYZ>);
   tree->setInputCloud(filtered_points_ptr);
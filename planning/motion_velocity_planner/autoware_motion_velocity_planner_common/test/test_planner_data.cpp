@@ -0,0 +1,142 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/motion_velocity_planner_common/planner_data.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+using autoware::motion_velocity_planner::PlannerData;
+using autoware::motion_velocity_planner::TrajectoryPoints;
+
+namespace
+{
+std::shared_ptr<rclcpp::Node> create_node()
+{
+  rclcpp::NodeOptions options;
+  options.parameter_overrides({
+    {"wheel_radius", 0.39},
+    {"wheel_width", 0.42},
+    {"wheel_base", 2.74},
+    {"wheel_tread", 1.63},
+    {"front_overhang", 1.0},
+    {"rear_overhang", 1.03},
+    {"left_overhang", 0.1},
+    {"right_overhang", 0.1},
+    {"vehicle_height", 2.5},
+    {"max_steer_angle", 0.7},
+    {"ego_nearest_dist_threshold", 3.0},
+    {"ego_nearest_yaw_threshold", 1.046},
+    {"trajectory_polygon_collision_check.decimate_trajectory_step_length", 2.0},
+    {"trajectory_polygon_collision_check.goal_extended_trajectory_length", 6.0},
+    {"trajectory_polygon_collision_check.consider_current_pose.enable_to_consider_current_pose",
+     true},
+    {"trajectory_polygon_collision_check.consider_current_pose.time_to_convergence", 1.5},
+    {"pointcloud.pointcloud_voxel_grid_x", 0.5},
+    {"pointcloud.pointcloud_voxel_grid_y", 0.5},
+    {"pointcloud.pointcloud_voxel_grid_z", 0.5},
+    {"pointcloud.pointcloud_cluster_tolerance", 1.0},
+    {"pointcloud.pointcloud_min_cluster_size", 1},
+    {"pointcloud.pointcloud_max_cluster_size", 100},
+    {"pointcloud.mask_lat_margin", 0.0},
+  });
+  return std::make_shared<rclcpp::Node>("test_planner_data", options);
+}
+
+TrajectoryPoints create_straight_trajectory()
+{
+  TrajectoryPoints trajectory;
+  for (int i = 0; i <= 20; ++i) {
+    autoware_planning_msgs::msg::TrajectoryPoint point;
+    point.pose.position.x = static_cast<double>(i);
+    point.pose.orientation.w = 1.0;
+    trajectory.push_back(point);
+  }
+  return trajectory;
+}
+
+pcl::PointCloud<pcl::PointXYZ> create_pointcloud(const std::vector<pcl::PointXYZ> & points)
+{
+  pcl::PointCloud<pcl::PointXYZ> pointcloud;
+  for (const auto & point : points) {
+    pointcloud.push_back(point);
+  }
+  return pointcloud;
+}
+}  // namespace
+
+class PlannerDataTest : public ::testing::Test
+{
+protected:
+  void SetUp() override { rclcpp::init(0, nullptr); }
+  void TearDown() override { rclcpp::shutdown(); }
+};
+
+// the node copies the planner data every cycle, the copies must share the downsampler and each
+// copy must only get the points of its own pointcloud
+TEST_F(PlannerDataTest, VoxelGridSharedByCopies)
+{
+  const auto node = create_node();
+  PlannerData planner_data(*node);
+  const auto trajectory = create_straight_trajectory();
+
+  planner_data.no_ground_pointcloud.set_pointcloud(
+    create_pointcloud({{2.1f, 0.1f, 0.1f}, {2.2f, 0.1f, 0.1f}, {5.1f, 0.1f, 0.1f}}));
+  const auto first_cycle_data = std::make_shared<const PlannerData>(planner_data);
+  const auto & first_pointcloud = first_cycle_data->no_ground_pointcloud;
+  const auto first_points =
+    first_pointcloud.get_filtered_pointcloud_ptr(trajectory, first_cycle_data->vehicle_info_);
+  ASSERT_EQ(first_points->size(), 2u);
+  EXPECT_EQ(
+    first_pointcloud.get_cluster_indices(trajectory, first_cycle_data->vehicle_info_).size(), 2u);
+
+  // the point at y = 50 is far from the trajectory and is removed before the downsampling
+  planner_data.no_ground_pointcloud.set_pointcloud(create_pointcloud(
+    {{10.1f, 0.1f, 0.1f},
+     {10.2f, 0.1f, 0.1f},
+     {10.3f, 0.1f, 0.1f},
+     {14.1f, 0.1f, 0.1f},
+     {14.2f, 0.1f, 0.1f},
+     {10.1f, 50.0f, 0.1f}}));
+  const auto second_cycle_data = std::make_shared<const PlannerData>(planner_data);
+  const auto & second_pointcloud = second_cycle_data->no_ground_pointcloud;
+  EXPECT_EQ(
+    &first_pointcloud.get_voxel_grid_downsampler(),
+    &second_pointcloud.get_voxel_grid_downsampler());
+
+  const auto second_points =
+    second_pointcloud.get_filtered_pointcloud_ptr(trajectory, second_cycle_data->vehicle_info_);
+  ASSERT_EQ(second_points->size(), 2u);
+  for (const auto & point : second_points->points) {
+    EXPECT_GT(point.x, 10.0f);
+  }
+  EXPECT_EQ(
+    second_pointcloud.get_cluster_indices(trajectory, second_cycle_data->vehicle_info_).size(),
+    2u);
+  // the last filtering through the shared downsampler was the one of the second copy
+  EXPECT_EQ(second_pointcloud.get_voxel_grid_downsampler().get_point_voxel_indices().size(), 5u);
+
+  // the first copy keeps its own result
+  const auto first_points_again =
+    first_pointcloud.get_filtered_pointcloud_ptr(trajectory, first_cycle_data->vehicle_info_);
+  ASSERT_EQ(first_points_again->size(), 2u);
+  for (const auto & point : first_points_again->points) {
+    EXPECT_LT(point.x, 6.0f);
+  }
+}
@@ -17,6 +17,9 @@
 #ifndef AUTOWARE__CROP_BOX_FILTER__CROP_BOX_FILTER_NODE_HPP_
 #define AUTOWARE__CROP_BOX_FILTER__CROP_BOX_FILTER_NODE_HPP_
 
+#include "autoware/crop_box_filter/pointcloud_buffer_pool.hpp"
+
+#include <autoware/point_types/layout.hpp>
 #include <autoware/point_types/types.hpp>
 #include <autoware_utils_debug/debug_publisher.hpp>
 #include <autoware_utils_debug/published_time_publisher.hpp>
@@ -102,6 +105,18 @@ private:
   std::unique_ptr<autoware_utils_debug::DebugPublisher> debug_publisher_;
   std::unique_ptr<autoware_utils_debug::PublishedTimePublisher> published_time_publisher_;
 
+  /** \brief The layouts of the input pointclouds, looked up once per message. The checks against
+   * the point types run once per distinct field list. */
+  autoware::point_types::PointCloudLayoutCache layout_cache_;
+
+  /** \brief Whether the output is published with intra-process communication, which is set by
+   * use_intra_process_comms of the node options. */
+  bool use_intra_process_comms_{false};
+
+  /** \brief The output messages, which are reused unless intra-process communication is used. A
+   * buffer is returned right after publish(), so one buffer is enough. */
+  PointCloud2BufferPool output_buffer_pool_{1};
+
   // function declaration *************************************
 
   void publish_crop_box_polygon();
@@ -111,23 +126,12 @@ private:
   /** \brief Parameter service callback */
   rcl_interfaces::msg::SetParametersResult param_callback(const std::vector<rclcpp::Parameter> & p);
 
-  /** \brief Return whether the input PointCloud2 data has the same layout than PointXYZI. That is
-   * to say whether you can memcpy from the PointCloud2 data buffer to a PointXYZI */
-  bool is_data_layout_compatible_with_point_xyzi(const PointCloud2 & input);
-
-  /** \brief Return whether the input PointCloud2 data has the same layout than PointXYZIRC. That is
-   * to say whether you can memcpy from the PointCloud2 data buffer to a PointXYZIRC */
-  bool is_data_layout_compatible_with_point_xyzirc(const PointCloud2 & input);
-
-  /** \brief Return whether the input PointCloud2 data has the same layout than PointXYZIRADRT. That
-   * is to say whether you can memcpy from the PointCloud2 data buffer to a PointXYZIRADRT */
-  bool is_data_layout_compatible_with_point_xyziradrt(const PointCloud2 & input);
-
-  /** \brief Return whether the input PointCloud2 data has the same layout than PointXYZIRCAEDT.
-   * That is to say whether you can memcpy from the PointCloud2 data buffer to a PointXYZIRCAEDT */
-  bool is_data_layout_compatible_with_point_xyzircaedt(const PointCloud2 & input);
+  bool is_valid(
+    const PointCloud2ConstPtr & cloud, const autoware::point_types::PointCloudLayout & layout);
 
-  bool is_valid(const PointCloud2ConstPtr & cloud);
+  void filter_pointcloud(
+    const PointCloud2ConstPtr & cloud, const autoware::point_types::PointCloudLayout & layout,
+    PointCloud2 & output);
 
   /** \brief For parameter service callback */
   template <typename T>
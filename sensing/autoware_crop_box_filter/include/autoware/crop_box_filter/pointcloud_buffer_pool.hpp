@@ -0,0 +1,76 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__CROP_BOX_FILTER__POINTCLOUD_BUFFER_POOL_HPP_
+#define AUTOWARE__CROP_BOX_FILTER__POINTCLOUD_BUFFER_POOL_HPP_
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace autoware::crop_box_filter
+{
+
+/** \brief Pool of the output PointCloud2 messages. The data buffers are reserved to the largest
+ * input size seen so far, so that a message taken from the pool is filled without reallocation.
+ * Only the messages which are copied when published can be released back to the pool. */
+class PointCloud2BufferPool
+{
+public:
+  explicit PointCloud2BufferPool(const std::size_t max_buffer_num) : max_buffer_num_(max_buffer_num)
+  {
+    buffers_.reserve(max_buffer_num_);
+  }
+
+  /** \brief Take a message whose data capacity is at least the high-water mark of data_size */
+  std::unique_ptr<sensor_msgs::msg::PointCloud2> acquire(const std::size_t data_size)
+  {
+    high_water_mark_ = std::max(high_water_mark_, data_size);
+
+    std::unique_ptr<sensor_msgs::msg::PointCloud2> buffer;
+    if (buffers_.empty()) {
+      buffer = std::make_unique<sensor_msgs::msg::PointCloud2>();
+    } else {
+      buffer = std::move(buffers_.back());
+      buffers_.pop_back();
+    }
+    buffer->data.reserve(high_water_mark_);
+    return buffer;
+  }
+
+  /** \brief Give back a message which is no longer used. It is dropped if the pool is full. */
+  void release(std::unique_ptr<sensor_msgs::msg::PointCloud2> buffer)
+  {
+    if (buffer && buffers_.size() < max_buffer_num_) {
+      buffers_.push_back(std::move(buffer));
+    }
+  }
+
+  std::size_t high_water_mark() const { return high_water_mark_; }
+
+  std::size_t available_buffer_num() const { return buffers_.size(); }
+
+private:
+  std::size_t max_buffer_num_;
+  std::size_t high_water_mark_{0};
+  std::vector<std::unique_ptr<sensor_msgs::msg::PointCloud2>> buffers_;
+};
+
+}  // namespace autoware::crop_box_filter
+
+#endif  // AUTOWARE__CROP_BOX_FILTER__POINTCLOUD_BUFFER_POOL_HPP_
@@ -107,6 +107,8 @@ CropBoxFilter::CropBoxFilter(const rclcpp::NodeOptions & node_options)
     pub_options.qos_overriding_options = rclcpp::QosOverridingOptions::with_default_policies();
     pub_output_ = this->create_publisher<PointCloud2>(
       "output", rclcpp::SensorDataQoS().keep_last(max_queue_size_), pub_options);
+    // the publisher follows the intra-process setting of the node
+    use_intra_process_comms_ = node_options.use_intra_process_comms();
   }
 
   // set additional publishers
@@ -136,9 +138,16 @@ CropBoxFilter::CropBoxFilter(const rclcpp::NodeOptions & node_options)
 
 void CropBoxFilter::filter_pointcloud(const PointCloud2ConstPtr & cloud, PointCloud2 & output)
 {
-  int x_offset = cloud->fields[pcl::getFieldIndex(*cloud, "x")].offset;
-  int y_offset = cloud->fields[pcl::getFieldIndex(*cloud, "y")].offset;
-  int z_offset = cloud->fields[pcl::getFieldIndex(*cloud, "z")].offset;
+  filter_pointcloud(cloud, layout_cache_.get(*cloud), output);
+}
+
+void CropBoxFilter::filter_pointcloud(
+  const PointCloud2ConstPtr & cloud, const autoware::point_types::PointCloudLayout & layout,
+  PointCloud2 & output)
+{
+  const auto x_offset = layout.x.offset;
+  const auto y_offset = layout.y.offset;
+  const auto z_offset = layout.z.offset;
 
   output.data.resize(cloud->data.size());
   size_t output_size = 0;
@@ -220,8 +229,11 @@ void CropBoxFilter::filter_pointcloud(const PointCloud2ConstPtr & cloud, PointCl
 
 void CropBoxFilter::pointcloud_callback(const PointCloud2ConstPtr cloud)
 {
+  // the layout is looked up once, and shared by the check and the filtering
+  const auto layout = layout_cache_.get(*cloud);
+
   // check whether the pointcloud is valid
-  if (!is_valid(cloud)) {
+  if (!is_valid(cloud, layout)) {
     RCLCPP_ERROR(this->get_logger(), "[input_pointcloud_callback] Invalid input pointcloud!");
     return;
   }
@@ -233,14 +245,17 @@ void CropBoxFilter::pointcloud_callback(const PointCloud2ConstPtr cloud)
     cloud->width * cloud->height, cloud->header.frame_id.c_str());
   // pointcloud check finished
 
-  // pointcloud processing
-  auto output = PointCloud2();
-
   std::scoped_lock lock(mutex_);
   stop_watch_ptr_->toc("processing_time", true);
 
+  // pointcloud processing. The output published by intra-process communication is handed over to
+  // the subscribers and does not come back, so only the inter-process output is taken from the
+  // pool and a plain message is used otherwise, without the reserve to the high-water mark.
+  auto output = use_intra_process_comms_ ? std::make_unique<sensor_msgs::msg::PointCloud2>()
+                                         : output_buffer_pool_.acquire(cloud->data.size());
+
   // filtering
-  filter_pointcloud(cloud, output);
+  filter_pointcloud(cloud, layout, *output);
 
   // publish polygon if subscribers exist
   if (crop_box_polygon_pub_->get_subscription_count() > 0) {
@@ -265,8 +280,15 @@ void CropBoxFilter::pointcloud_callback(const PointCloud2ConstPtr cloud)
       "debug/pipeline_latency_ms", pipeline_latency_ms);
   }
 
-  // publish result pointcloud
-  pub_output_->publish(std::move(output));
+  // publish result pointcloud. With intra-process communication, the message is handed over to
+  // the intra-process subscribers without a copy, and rclcpp serializes it for the others.
+  // Otherwise the message is serialized in publish() and is returned to the pool.
+  if (use_intra_process_comms_) {
+    pub_output_->publish(std::move(output));
+  } else {
+    pub_output_->publish(*output);
+    output_buffer_pool_.release(std::move(output));
+  }
   published_time_publisher_->publish_if_subscribed(pub_output_, cloud->header.stamp);
 }
 
@@ -347,214 +369,23 @@ rcl_interfaces::msg::SetParametersResult CropBoxFilter::param_callback(
   return result;
 }
 
-bool CropBoxFilter::is_data_layout_compatible_with_point_xyzi(const PointCloud2 & input)
-{
-  using PointIndex = autoware::point_types::PointXYZIIndex;
-  using autoware::point_types::PointXYZI;
-  if (input.fields.size() < 4) {
-    return false;
-  }
-  bool same_layout = true;
-  const auto & field_x = input.fields.at(static_cast<size_t>(PointIndex::X));
-  same_layout &= field_x.name == "x";
-  same_layout &= field_x.offset == offsetof(PointXYZI, x);
-  same_layout &= field_x.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_x.count == 1;
-  const auto & field_y = input.fields.at(static_cast<size_t>(PointIndex::Y));
-  same_layout &= field_y.name == "y";
-  same_layout &= field_y.offset == offsetof(PointXYZI, y);
-  same_layout &= field_y.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_y.count == 1;
-  const auto & field_z = input.fields.at(static_cast<size_t>(PointIndex::Z));
-  same_layout &= field_z.name == "z";
-  same_layout &= field_z.offset == offsetof(PointXYZI, z);
-  same_layout &= field_z.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_z.count == 1;
-  const auto & field_intensity = input.fields.at(static_cast<size_t>(PointIndex::Intensity));
-  same_layout &= field_intensity.name == "intensity";
-  same_layout &= field_intensity.offset == offsetof(PointXYZI, intensity);
-  same_layout &= field_intensity.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_intensity.count == 1;
-  return same_layout;
-}
-
-bool CropBoxFilter::is_data_layout_compatible_with_point_xyzirc(const PointCloud2 & input)
-{
-  using PointIndex = autoware::point_types::PointXYZIRCIndex;
-  using autoware::point_types::PointXYZIRC;
-  if (input.fields.size() < 6) {
-    return false;
-  }
-  bool same_layout = true;
-  const auto & field_x = input.fields.at(static_cast<size_t>(PointIndex::X));
-  same_layout &= field_x.name == "x";
-  same_layout &= field_x.offset == offsetof(PointXYZIRC, x);
-  same_layout &= field_x.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_x.count == 1;
-  const auto & field_y = input.fields.at(static_cast<size_t>(PointIndex::Y));
-  same_layout &= field_y.name == "y";
-  same_layout &= field_y.offset == offsetof(PointXYZIRC, y);
-  same_layout &= field_y.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_y.count == 1;
-  const auto & field_z = input.fields.at(static_cast<size_t>(PointIndex::Z));
-  same_layout &= field_z.name == "z";
-  same_layout &= field_z.offset == offsetof(PointXYZIRC, z);
-  same_layout &= field_z.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_z.count == 1;
-  const auto & field_intensity = input.fields.at(static_cast<size_t>(PointIndex::Intensity));
-  same_layout &= field_intensity.name == "intensity";
-  same_layout &= field_intensity.offset == offsetof(PointXYZIRC, intensity);
-  same_layout &= field_intensity.datatype == sensor_msgs::msg::PointField::UINT8;
-  same_layout &= field_intensity.count == 1;
-  const auto & field_return_type = input.fields.at(static_cast<size_t>(PointIndex::ReturnType));
-  same_layout &= field_return_type.name == "return_type";
-  same_layout &= field_return_type.offset == offsetof(PointXYZIRC, return_type);
-  same_layout &= field_return_type.datatype == sensor_msgs::msg::PointField::UINT8;
-  same_layout &= field_return_type.count == 1;
-  const auto & field_ring = input.fields.at(static_cast<size_t>(PointIndex::Channel));
-  same_layout &= field_ring.name == "channel";
-  same_layout &= field_ring.offset == offsetof(PointXYZIRC, channel);
-  same_layout &= field_ring.datatype == sensor_msgs::msg::PointField::UINT16;
-  same_layout &= field_ring.count == 1;
-
-  return same_layout;
-}
-
-bool CropBoxFilter::is_data_layout_compatible_with_point_xyziradrt(const PointCloud2 & input)
-{
-  using PointIndex = autoware::point_types::PointXYZIRADRTIndex;
-  using autoware::point_types::PointXYZIRADRT;
-  if (input.fields.size() < 9) {
-    return false;
-  }
-  bool same_layout = true;
-  const auto & field_x = input.fields.at(static_cast<size_t>(PointIndex::X));
-  same_layout &= field_x.name == "x";
-  same_layout &= field_x.offset == offsetof(PointXYZIRADRT, x);
-  same_layout &= field_x.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_x.count == 1;
-  const auto & field_y = input.fields.at(static_cast<size_t>(PointIndex::Y));
-  same_layout &= field_y.name == "y";
-  same_layout &= field_y.offset == offsetof(PointXYZIRADRT, y);
-  same_layout &= field_y.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_y.count == 1;
-  const auto & field_z = input.fields.at(static_cast<size_t>(PointIndex::Z));
-  same_layout &= field_z.name == "z";
-  same_layout &= field_z.offset == offsetof(PointXYZIRADRT, z);
-  same_layout &= field_z.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_z.count == 1;
-  const auto & field_intensity = input.fields.at(static_cast<size_t>(PointIndex::Intensity));
-  same_layout &= field_intensity.name == "intensity";
-  same_layout &= field_intensity.offset == offsetof(PointXYZIRADRT, intensity);
-  same_layout &= field_intensity.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_intensity.count == 1;
-  const auto & field_ring = input.fields.at(static_cast<size_t>(PointIndex::Ring));
-  same_layout &= field_ring.name == "ring";
-  same_layout &= field_ring.offset == offsetof(PointXYZIRADRT, ring);
-  same_layout &= field_ring.datatype == sensor_msgs::msg::PointField::UINT16;
-  same_layout &= field_ring.count == 1;
-  const auto & field_azimuth = input.fields.at(static_cast<size_t>(PointIndex::Azimuth));
-  same_layout &= field_azimuth.name == "azimuth";
-  same_layout &= field_azimuth.offset == offsetof(PointXYZIRADRT, azimuth);
-  same_layout &= field_azimuth.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_azimuth.count == 1;
-  const auto & field_distance = input.fields.at(static_cast<size_t>(PointIndex::Distance));
-  same_layout &= field_distance.name == "distance";
-  same_layout &= field_distance.offset == offsetof(PointXYZIRADRT, distance);
-  same_layout &= field_distance.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_distance.count == 1;
-  const auto & field_return_type = input.fields.at(static_cast<size_t>(PointIndex::ReturnType));
-  same_layout &= field_return_type.name == "return_type";
-  same_layout &= field_return_type.offset == offsetof(PointXYZIRADRT, return_type);
-  same_layout &= field_return_type.datatype == sensor_msgs::msg::PointField::UINT8;
-  same_layout &= field_return_type.count == 1;
-  const auto & field_time_stamp = input.fields.at(static_cast<size_t>(PointIndex::TimeStamp));
-  same_layout &= field_time_stamp.name == "time_stamp";
-  same_layout &= field_time_stamp.offset == offsetof(PointXYZIRADRT, time_stamp);
-  same_layout &= field_time_stamp.datatype == sensor_msgs::msg::PointField::FLOAT64;
-  same_layout &= field_time_stamp.count == 1;
-  return same_layout;
-}
-
-bool CropBoxFilter::is_data_layout_compatible_with_point_xyzircaedt(const PointCloud2 & input)
-{
-  using PointIndex = autoware::point_types::PointXYZIRCAEDTIndex;
-  using autoware::point_types::PointXYZIRCAEDT;
-  if (input.fields.size() != 10) {
-    return false;
-  }
-  bool same_layout = true;
-  const auto & field_x = input.fields.at(static_cast<size_t>(PointIndex::X));
-  same_layout &= field_x.name == "x";
-  same_layout &= field_x.offset == offsetof(PointXYZIRCAEDT, x);
-  same_layout &= field_x.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_x.count == 1;
-  const auto & field_y = input.fields.at(static_cast<size_t>(PointIndex::Y));
-  same_layout &= field_y.name == "y";
-  same_layout &= field_y.offset == offsetof(PointXYZIRCAEDT, y);
-  same_layout &= field_y.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_y.count == 1;
-  const auto & field_z = input.fields.at(static_cast<size_t>(PointIndex::Z));
-  same_layout &= field_z.name == "z";
-  same_layout &= field_z.offset == offsetof(PointXYZIRCAEDT, z);
-  same_layout &= field_z.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_z.count == 1;
-  const auto & field_intensity = input.fields.at(static_cast<size_t>(PointIndex::Intensity));
-  same_layout &= field_intensity.name == "intensity";
-  same_layout &= field_intensity.offset == offsetof(PointXYZIRCAEDT, intensity);
-  same_layout &= field_intensity.datatype == sensor_msgs::msg::PointField::UINT8;
-  same_layout &= field_intensity.count == 1;
-  const auto & field_return_type = input.fields.at(static_cast<size_t>(PointIndex::ReturnType));
-  same_layout &= field_return_type.name == "return_type";
-  same_layout &= field_return_type.offset == offsetof(PointXYZIRCAEDT, return_type);
-  same_layout &= field_return_type.datatype == sensor_msgs::msg::PointField::UINT8;
-  same_layout &= field_return_type.count == 1;
-  const auto & field_ring = input.fields.at(static_cast<size_t>(PointIndex::Channel));
-  same_layout &= field_ring.name == "channel";
-  same_layout &= field_ring.offset == offsetof(PointXYZIRCAEDT, channel);
-  same_layout &= field_ring.datatype == sensor_msgs::msg::PointField::UINT16;
-  same_layout &= field_ring.count == 1;
-  const auto & field_azimuth = input.fields.at(static_cast<size_t>(PointIndex::Azimuth));
-  same_layout &= field_azimuth.name == "azimuth";
-  same_layout &= field_azimuth.offset == offsetof(PointXYZIRCAEDT, azimuth);
-  same_layout &= field_azimuth.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_azimuth.count == 1;
-  const auto & field_elevation = input.fields.at(static_cast<size_t>(PointIndex::Elevation));
-  same_layout &= field_elevation.name == "elevation";
-  same_layout &= field_elevation.offset == offsetof(PointXYZIRCAEDT, elevation);
-  same_layout &= field_elevation.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_elevation.count == 1;
-  const auto & field_distance = input.fields.at(static_cast<size_t>(PointIndex::Distance));
-  same_layout &= field_distance.name == "distance";
-  same_layout &= field_distance.offset == offsetof(PointXYZIRCAEDT, distance);
-  same_layout &= field_distance.datatype == sensor_msgs::msg::PointField::FLOAT32;
-  same_layout &= field_distance.count == 1;
-  const auto & field_time_stamp = input.fields.at(static_cast<size_t>(PointIndex::TimeStamp));
-  same_layout &= field_time_stamp.name == "time_stamp";
-  same_layout &= field_time_stamp.offset == offsetof(PointXYZIRCAEDT, time_stamp);
-  same_layout &= field_time_stamp.datatype == sensor_msgs::msg::PointField::UINT32;
-  same_layout &= field_time_stamp.count == 1;
-  return same_layout;
-}
-
-bool CropBoxFilter::is_valid(const PointCloud2ConstPtr & cloud)
+bool CropBoxFilter::is_valid(
+  const PointCloud2ConstPtr & cloud, const autoware::point_types::PointCloudLayout & layout)
 {
   // firstly check the fields of the point cloud
-  if (
-    !is_data_layout_compatible_with_point_xyzircaedt(*cloud) &&
-    !is_data_layout_compatible_with_point_xyzirc(*cloud)) {
+  if (!layout.is_xyzircaedt && !layout.is_xyzirc) {
     RCLCPP_ERROR(
       get_logger(),
       "The pointcloud layout is not compatible with PointXYZIRCAEDT or PointXYZIRC. Aborting");
 
-    if (is_data_layout_compatible_with_point_xyziradrt(*cloud)) {
+    if (layout.is_xyziradrt) {
       RCLCPP_ERROR(
         get_logger(),
         "The pointcloud layout is compatible with PointXYZIRADRT. You may be using legacy "
         "code/data");
     }
 
-    if (is_data_layout_compatible_with_point_xyzi(*cloud)) {
+    if (layout.is_xyzi) {
       RCLCPP_ERROR(
         get_logger(),
         "The pointcloud layout is compatible with PointXYZI. You may be using legacy "
@@ -19,6 +19,7 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <utility>
 
 TEST(CropBoxFilterTest, checkOutputPointcloud)
 {
@@ -99,6 +100,33 @@ TEST(CropBoxFilterTest, checkOutputPointcloud)
   }
 }
 
+TEST(PointCloud2BufferPoolTest, reuseBuffers)
+{
+  autoware::crop_box_filter::PointCloud2BufferPool pool(1);
+
+  // a new buffer is reserved to the requested size
+  auto buffer = pool.acquire(100);
+  EXPECT_GE(buffer->data.capacity(), 100U);
+  const auto * data_ptr = buffer->data.data();
+
+  // the released buffer is reused without reallocation
+  pool.release(std::move(buffer));
+  EXPECT_EQ(pool.available_buffer_num(), 1U);
+  buffer = pool.acquire(50);
+  EXPECT_EQ(buffer->data.data(), data_ptr);
+  EXPECT_EQ(pool.available_buffer_num(), 0U);
+
+  // the buffer is reserved to the high-water mark
+  auto another_buffer = pool.acquire(10);
+  EXPECT_EQ(pool.high_water_mark(), 100U);
+  EXPECT_GE(another_buffer->data.capacity(), 100U);
+
+  // the buffers beyond the size of the pool are dropped
+  pool.release(std::move(buffer));
+  pool.release(std::move(another_buffer));
+  EXPECT_EQ(pool.available_buffer_num(), 1U);
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -14,6 +14,8 @@
 #ifndef AUTOWARE__GNSS_POSER__GNSS_POSER_NODE_HPP_
 #define AUTOWARE__GNSS_POSER__GNSS_POSER_NODE_HPP_
 
+#include "autoware/gnss_poser/sliding_window_statistics.hpp"
+
 #include <rclcpp/rclcpp.hpp>
 #include <tf2/transform_datatypes.hpp>
 
@@ -25,8 +27,6 @@
 #include <sensor_msgs/msg/nav_sat_fix.hpp>
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
 
-#include <boost/circular_buffer.hpp>
-
 #include <tf2_ros/transform_broadcaster.h>
 #include <tf2_ros/transform_listener.h>
 
@@ -48,10 +48,7 @@ private:
 
   static bool is_fixed(const sensor_msgs::msg::NavSatStatus & nav_sat_status_msg);
   static bool can_get_covariance(const sensor_msgs::msg::NavSatFix & nav_sat_fix_msg);
-  static geometry_msgs::msg::Point get_median_position(
-    const boost::circular_buffer<geometry_msgs::msg::Point> & position_buffer);
-  static geometry_msgs::msg::Point get_average_position(
-    const boost::circular_buffer<geometry_msgs::msg::Point> & position_buffer);
+  geometry_msgs::msg::Point get_buffered_position() const;
   static geometry_msgs::msg::Quaternion get_quaternion_by_heading(const int heading);
   static geometry_msgs::msg::Quaternion get_quaternion_by_position_difference(
     const geometry_msgs::msg::Point & point, const geometry_msgs::msg::Point & prev_point);
@@ -87,7 +84,9 @@ private:
   bool received_map_projector_info_ = false;
   bool use_gnss_ins_orientation_;
 
-  boost::circular_buffer<geometry_msgs::msg::Point> position_buffer_;
+  SlidingWindowStatistics position_x_buffer_;
+  SlidingWindowStatistics position_y_buffer_;
+  SlidingWindowStatistics position_z_buffer_;
 
   autoware_sensing_msgs::msg::GnssInsOrientationStamped::SharedPtr
     msg_gnss_ins_orientation_stamped_;
@@ -0,0 +1,77 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef AUTOWARE__GNSS_POSER__SLIDING_WINDOW_STATISTICS_HPP_
+#define AUTOWARE__GNSS_POSER__SLIDING_WINDOW_STATISTICS_HPP_
+
+#include <boost/circular_buffer.hpp>
+
+#include <array>
+#include <cstddef>
+#include <set>
+
+namespace autoware::gnss_poser
+{
+/**
+ * @brief mean, median, and trimmed mean of the latest values of a stream, updated in O(log w)
+ * @details the values of the window are kept in four ordered partitions: the trimmed lowest
+ * values, the lower and upper halves of the remaining values, and the trimmed highest values. Each
+ * new value is inserted in its partition and the partitions are rebalanced with a constant number
+ * of moves, so the median is read at the boundary of the halves and the trimmed mean from the sums
+ * of the halves.
+ */
+class SlidingWindowStatistics
+{
+public:
+  /**
+   * @param capacity number of values in the window, at least 1
+   * @param trim_ratio ratio of the values discarded at each end by the trimmed mean, in [0, 0.5)
+   */
+  explicit SlidingWindowStatistics(const size_t capacity = 1, const double trim_ratio = 0.0);
+
+  /// @brief add a value, discarding the oldest one if the window is full
+  void push(const double value);
+  void clear();
+
+  size_t size() const { return values_.size(); }
+  size_t capacity() const { return values_.capacity(); }
+  bool empty() const { return values_.empty(); }
+  bool full() const { return values_.full(); }
+
+  /// @brief mean of the window, which must not be empty
+  double mean() const;
+  /// @brief median of the window (mean of the two middle values for an even size)
+  double median() const;
+  /// @brief mean of the window without the floor(trim_ratio * size) lowest and highest values
+  double trimmed_mean() const;
+
+private:
+  static constexpr size_t num_partitions = 4;
+
+  void insert(const double value);
+  void erase(const double value);
+  void rebalance();
+  void move_max(const size_t from, const size_t to);
+  void move_min(const size_t from, const size_t to);
+  void recompute_sums();
+
+  double trim_ratio_;
+  boost::circular_buffer<double> values_;
+  std::array<std::multiset<double>, num_partitions> partitions_;
+  std::array<double, num_partitions> sums_{};
+  // the sums are recomputed once per window so that rounding errors do not accumulate
+  size_t num_updates_since_recompute_{0};
+};
+}  // namespace autoware::gnss_poser
+
+#endif  // AUTOWARE__GNSS_POSER__SLIDING_WINDOW_STATISTICS_HPP_
@@ -22,7 +22,6 @@
 #include <algorithm>
 #include <memory>
 #include <string>
-#include <vector>
 
 namespace autoware::gnss_poser
 {
@@ -43,9 +42,13 @@ GNSSPoser::GNSSPoser(const rclcpp::NodeOptions & node_options)
     "/map/map_projector_info", rclcpp::QoS{1}.transient_local(),
     std::bind(&GNSSPoser::callback_map_projector_info, this, std::placeholders::_1));
 
-  // Set up position buffer
-  int buff_epoch = static_cast<int>(declare_parameter<int>("buff_epoch"));
-  position_buffer_.set_capacity(buff_epoch);
+  // Set up position buffer (a buffer of zero epoch works as a buffer of one epoch)
+  const int buff_epoch = std::max(static_cast<int>(declare_parameter<int>("buff_epoch")), 1);
+  const double trimmed_mean_ratio =
+    gnss_pose_pub_method_ == 3 ? declare_parameter<double>("trimmed_mean_ratio") : 0.0;
+  position_x_buffer_ = SlidingWindowStatistics(static_cast<size_t>(buff_epoch), trimmed_mean_ratio);
+  position_y_buffer_ = SlidingWindowStatistics(static_cast<size_t>(buff_epoch), trimmed_mean_ratio);
+  position_z_buffer_ = SlidingWindowStatistics(static_cast<size_t>(buff_epoch), trimmed_mean_ratio);
 
   // Set subscribers and publishers
   nav_sat_fix_sub_ = create_subscription<sensor_msgs::msg::NavSatFix>(
@@ -129,17 +132,17 @@ void GNSSPoser::callback_nav_sat_fix(
     gnss_antenna_pose.position = position;
   } else {
     // fill position buffer
-    position_buffer_.push_front(position);
-    if (!position_buffer_.full()) {
+    position_x_buffer_.push(position.x);
+    position_y_buffer_.push(position.y);
+    position_z_buffer_.push(position.z);
+    if (!position_x_buffer_.full()) {
       RCLCPP_WARN_STREAM_THROTTLE(
         this->get_logger(), *this->get_clock(), std::chrono::milliseconds(1000).count(),
         "Buffering Position. Output Skipped.");
       return;
     }
-    // publish average pose or median pose of position buffer
-    gnss_antenna_pose.position = (gnss_pose_pub_method_ == 1)
-                                   ? get_average_position(position_buffer_)
-                                   : get_median_position(position_buffer_);
+    // publish average pose, median pose, or trimmed average pose of position buffer
+    gnss_antenna_pose.position = get_buffered_position();
   }
 
   // calc gnss antenna orientation
@@ -225,54 +228,23 @@ bool GNSSPoser::can_get_covariance(const sensor_msgs::msg::NavSatFix & nav_sat_f
          sensor_msgs::msg::NavSatFix::COVARIANCE_TYPE_UNKNOWN;
 }
 
-geometry_msgs::msg::Point GNSSPoser::get_median_position(
-  const boost::circular_buffer<geometry_msgs::msg::Point> & position_buffer)
+geometry_msgs::msg::Point GNSSPoser::get_buffered_position() const
 {
-  auto get_median = [](std::vector<double> array) {
-    std::sort(std::begin(array), std::end(array));
-    const size_t median_index = array.size() / 2;
-    double median = (array.size() % 2)
-                      ? (array.at(median_index))
-                      : ((array.at(median_index) + array.at(median_index - 1)) / 2);
-    return median;
+  const auto get_statistic = [this](const SlidingWindowStatistics & buffer) {
+    if (gnss_pose_pub_method_ == 1) {
+      return buffer.mean();
+    }
+    if (gnss_pose_pub_method_ == 3) {
+      return buffer.trimmed_mean();
+    }
+    return buffer.median();
   };
 
-  std::vector<double> array_x;
-  std::vector<double> array_y;
-  std::vector<double> array_z;
-  for (const auto & position : position_buffer) {
-    array_x.push_back(position.x);
-    array_y.push_back(position.y);
-    array_z.push_back(position.z);
-  }
-
-  geometry_msgs::msg::Point median_point;
-  median_point.x = get_median(array_x);
-  median_point.y = get_median(array_y);
-  median_point.z = get_median(array_z);
-  return median_point;
-}
-
-geometry_msgs::msg::Point GNSSPoser::get_average_position(
-  const boost::circular_buffer<geometry_msgs::msg::Point> & position_buffer)
-{
-  std::vector<double> array_x;
-  std::vector<double> array_y;
-  std::vector<double> array_z;
-  for (const auto & position : position_buffer) {
-    array_x.push_back(position.x);
-    array_y.push_back(position.y);
-    array_z.push_back(position.z);
-  }
-
-  geometry_msgs::msg::Point average_point;
-  average_point.x =
-    std::reduce(array_x.begin(), array_x.end()) / static_cast<double>(array_x.size());
-  average_point.y =
-    std::reduce(array_y.begin(), array_y.end()) / static_cast<double>(array_y.size());
-  average_point.z =
-    std::reduce(array_z.begin(), array_z.end()) / static_cast<double>(array_z.size());
-  return average_point;
+  geometry_msgs::msg::Point buffered_point;
+  buffered_point.x = get_statistic(position_x_buffer_);
+  buffered_point.y = get_statistic(position_y_buffer_);
+  buffered_point.z = get_statistic(position_z_buffer_);
+  return buffered_point;
 }
 
 geometry_msgs::msg::Quaternion GNSSPoser::get_quaternion_by_heading(const int heading)
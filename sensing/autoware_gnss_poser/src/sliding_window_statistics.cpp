@@ -0,0 +1,175 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/gnss_poser/sliding_window_statistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <numeric>
+
+namespace autoware::gnss_poser
+{
+namespace
+{
+enum Partition : size_t { LOWER_TRIMMED = 0, LOWER_HALF = 1, UPPER_HALF = 2, UPPER_TRIMMED = 3 };
+}  // namespace
+
+SlidingWindowStatistics::SlidingWindowStatistics(const size_t capacity, const double trim_ratio)
+: trim_ratio_(std::clamp(trim_ratio, 0.0, 0.5)), values_(std::max<size_t>(capacity, 1))
+{
+}
+
+void SlidingWindowStatistics::push(const double value)
+{
+  if (values_.full()) {
+    erase(values_.front());
+  }
+  values_.push_back(value);
+  insert(value);
+  rebalance();
+
+  if (++num_updates_since_recompute_ >= values_.capacity()) {
+    recompute_sums();
+  }
+}
+
+void SlidingWindowStatistics::clear()
+{
+  values_.clear();
+  for (auto & partition : partitions_) {
+    partition.clear();
+  }
+  sums_.fill(0.0);
+  num_updates_since_recompute_ = 0;
+}
+
+double SlidingWindowStatistics::mean() const
+{
+  return std::accumulate(sums_.begin(), sums_.end(), 0.0) / static_cast<double>(size());
+}
+
+double SlidingWindowStatistics::median() const
+{
+  if (size() % 2) {
+    return *partitions_[LOWER_HALF].rbegin();
+  }
+  return (*partitions_[UPPER_HALF].begin() + *partitions_[LOWER_HALF].rbegin()) / 2;
+}
+
+double SlidingWindowStatistics::trimmed_mean() const
+{
+  const size_t num_values = partitions_[LOWER_HALF].size() + partitions_[UPPER_HALF].size();
+  return (sums_[LOWER_HALF] + sums_[UPPER_HALF]) / static_cast<double>(num_values);
+}
+
+void SlidingWindowStatistics::insert(const double value)
+{
+  // the first partition whose maximum is not lower than the value, or the last non-empty one
+  size_t target = LOWER_HALF;
+  for (size_t i = 0; i < num_partitions; ++i) {
+    if (partitions_[i].empty()) {
+      continue;
+    }
+    target = i;
+    if (value <= *partitions_[i].rbegin()) {
+      break;
+    }
+  }
+  partitions_[target].insert(value);
+  sums_[target] += value;
+}
+
+void SlidingWindowStatistics::erase(const double value)
+{
+  for (size_t i = 0; i < num_partitions; ++i) {
+    auto & partition = partitions_[i];
+    if (partition.empty() || *partition.rbegin() < value) {
+      continue;
+    }
+    partition.erase(partition.find(value));
+    sums_[i] -= value;
+    return;
+  }
+}
+
+void SlidingWindowStatistics::rebalance()
+{
+  const size_t num_values = size();
+  const size_t num_trimmed = std::min(
+    static_cast<size_t>(std::floor(trim_ratio_ * static_cast<double>(num_values))),
+    num_values == 0 ? 0 : (num_values - 1) / 2);
+  const size_t num_middle = num_values - 2 * num_trimmed;
+  // number of values expected in the partitions up to each boundary
+  const std::array<size_t, num_partitions - 1> expected_prefix_sizes = {
+    num_trimmed, num_trimmed + (num_middle + 1) / 2, num_values - num_trimmed};
+
+  bool balanced = false;
+  while (!balanced) {
+    balanced = true;
+    size_t prefix_size = 0;
+    for (size_t boundary = 0; boundary + 1 < num_partitions; ++boundary) {
+      prefix_size += partitions_[boundary].size();
+      if (prefix_size == expected_prefix_sizes[boundary]) {
+        continue;
+      }
+      balanced = false;
+      if (prefix_size > expected_prefix_sizes[boundary]) {
+        // move the largest value below the boundary to the partition right above it
+        size_t from = boundary;
+        while (partitions_[from].empty()) {
+          --from;
+        }
+        move_max(from, boundary + 1);
+      } else {
+        // move the smallest value above the boundary to the partition right below it
+        size_t from = boundary + 1;
+        while (partitions_[from].empty()) {
+          ++from;
+        }
+        move_min(from, boundary);
+      }
+      break;
+    }
+  }
+}
+
+void SlidingWindowStatistics::move_max(const size_t from, const size_t to)
+{
+  const auto it = std::prev(partitions_[from].end());
+  const double value = *it;
+  partitions_[from].erase(it);
+  sums_[from] -= value;
+  partitions_[to].insert(value);
+  sums_[to] += value;
+}
+
+void SlidingWindowStatistics::move_min(const size_t from, const size_t to)
+{
+  const auto it = partitions_[from].begin();
+  const double value = *it;
+  partitions_[from].erase(it);
+  sums_[from] -= value;
+  partitions_[to].insert(value);
+  sums_[to] += value;
+}
+
+void SlidingWindowStatistics::recompute_sums()
+{
+  for (size_t i = 0; i < num_partitions; ++i) {
+    sums_[i] = std::accumulate(partitions_[i].begin(), partitions_[i].end(), 0.0);
+  }
+  num_updates_since_recompute_ = 0;
+}
+}  // namespace autoware::gnss_poser
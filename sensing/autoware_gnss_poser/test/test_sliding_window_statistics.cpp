@@ -0,0 +1,102 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/gnss_poser/sliding_window_statistics.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+// sort-based computation previously used by GNSSPoser
+double calc_median(std::vector<double> array)
+{
+  std::sort(std::begin(array), std::end(array));
+  const size_t median_index = array.size() / 2;
+  return (array.size() % 2) ? (array.at(median_index))
+                            : ((array.at(median_index) + array.at(median_index - 1)) / 2);
+}
+
+double calc_mean(const std::vector<double> & array)
+{
+  return std::reduce(array.begin(), array.end()) / static_cast<double>(array.size());
+}
+
+double calc_trimmed_mean(std::vector<double> array, const double trim_ratio)
+{
+  std::sort(std::begin(array), std::end(array));
+  const auto num_trimmed = std::min(
+    static_cast<size_t>(std::floor(trim_ratio * static_cast<double>(array.size()))),
+    (array.size() - 1) / 2);
+  return std::accumulate(array.begin() + num_trimmed, array.end() - num_trimmed, 0.0) /
+         static_cast<double>(array.size() - 2 * num_trimmed);
+}
+}  // namespace
+
+TEST(SlidingWindowStatistics, SameAsSortBasedComputation)
+{
+  using autoware::gnss_poser::SlidingWindowStatistics;
+
+  std::mt19937 engine(0);
+  std::normal_distribution<double> noise(0.0, 1.0);
+  std::uniform_int_distribution<int> coarse(-3, 3);
+
+  for (const size_t capacity : {1, 2, 3, 4, 5, 10, 33, 64}) {
+    for (const double trim_ratio : {0.0, 0.1, 0.25, 0.4}) {
+      SlidingWindowStatistics statistics(capacity, trim_ratio);
+      std::deque<double> window;
+      for (size_t i = 0; i < 500; ++i) {
+        // map-scale coordinates with noise, and coarse values to have duplicates
+        const double value = (i % 3 == 0) ? static_cast<double>(coarse(engine))
+                                          : 40000.0 + 0.01 * static_cast<double>(i) + noise(engine);
+        statistics.push(value);
+        window.push_back(value);
+        if (window.size() > capacity) {
+          window.pop_front();
+        }
+
+        const std::vector<double> array(window.begin(), window.end());
+        ASSERT_EQ(statistics.size(), array.size());
+        EXPECT_EQ(statistics.full(), array.size() == capacity);
+        EXPECT_DOUBLE_EQ(statistics.median(), calc_median(array));
+        EXPECT_NEAR(statistics.mean(), calc_mean(array), 1e-9);
+        EXPECT_NEAR(statistics.trimmed_mean(), calc_trimmed_mean(array, trim_ratio), 1e-9);
+      }
+    }
+  }
+}
+
+TEST(SlidingWindowStatistics, TrimmedMeanDiscardsOutliers)
+{
+  autoware::gnss_poser::SlidingWindowStatistics statistics(10, 0.1);
+  for (const double value : {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 1000.0}) {
+    statistics.push(value);
+  }
+  EXPECT_TRUE(statistics.full());
+  EXPECT_DOUBLE_EQ(statistics.trimmed_mean(), 5.5);
+  EXPECT_DOUBLE_EQ(statistics.median(), 5.5);
+  EXPECT_DOUBLE_EQ(statistics.mean(), 104.5);
+
+  statistics.clear();
+  EXPECT_TRUE(statistics.empty());
+  statistics.push(2.0);
+  EXPECT_DOUBLE_EQ(statistics.median(), 2.0);
+  EXPECT_DOUBLE_EQ(statistics.trimmed_mean(), 2.0);
+}